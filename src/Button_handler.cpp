@@ -0,0 +1,161 @@
+#include "Button_handler.h"
+#include "SpscRing.h"
+#include "Log.h"
+
+static const uint8_t buttonPins[BUTTON_COUNT] = {BTN1, BTN2, BTN3, BTN4};
+static bool *const levels[BUTTON_COUNT] = {&btn1, &btn2, &btn3, &btn4};
+
+static const GestureConfig gestureConfigs[BUTTON_COUNT] = {
+  //lockout, short, long, double, repeat delay, repeat interval
+  {BUTTON_LOCKOUT_MS, BUTTON_SHORT_PRESS_MS, BUTTON_LONG_PRESS_MS, 0, 0, 0},                                                 // Drive mode, configuration menu
+  {BUTTON_LOCKOUT_MS, BUTTON_SHORT_PRESS_MS, BUTTON_LONG_PRESS_MS, 0, BUTTON_REPEAT_DELAY_MS, BUTTON_REPEAT_INTERVAL_MS},    // Menu up
+  {BUTTON_LOCKOUT_MS, BUTTON_SHORT_PRESS_MS, BUTTON_LONG_PRESS_MS, 0, BUTTON_REPEAT_DELAY_MS, BUTTON_REPEAT_INTERVAL_MS},    // Menu down
+  {BUTTON_LOCKOUT_MS, BUTTON_SHORT_PRESS_MS, BUTTON4_LONG_PRESS_MS, 0, 0, 0}                                                 // Shutdown
+};
+
+uint8_t buttonGestures[BUTTON_COUNT];
+
+// Edge capture, shared by the interrupt handlers and the resync in button_update(). Protected by buttonLock.
+static SpscRing<ButtonEvent, BUTTON_QUEUE_LEN> buttonQueue;
+static portMUX_TYPE buttonLock = portMUX_INITIALIZER_UNLOCKED;
+static uint8_t edgeLevels[BUTTON_COUNT];
+static uint32_t edgeTimes[BUTTON_COUNT];
+static bool bounceRejected[BUTTON_COUNT];
+static ButtonStats buttonStats = {};
+
+// Gesture recognition, only accessed by the control task
+static bool buttonLevels[BUTTON_COUNT];
+static GestureState gestureStates[BUTTON_COUNT];
+
+static void IRAM_ATTR queue_edge(uint8_t button, uint8_t level, uint32_t time){
+  /* Queues an accepted edge. Called with buttonLock taken.
+    Arguments:
+      - uint8_t button: Index of the button
+      - uint8_t level: Level after the edge
+      - uint32_t time: micros() of the edge
+    Returns:
+      - void
+  */
+  ButtonEvent event;
+  event.time = time;
+  event.button = button;
+  event.level = level;
+  edgeLevels[button] = level;
+  edgeTimes[button] = time;
+  if(buttonQueue.push(event)) buttonStats.edges++;
+  else buttonStats.overflows++;
+}
+
+static void IRAM_ATTR button_isr(uint8_t button){
+  /* Interrupt handler for both edges of a button. Edges that do not change the level or follow the last accepted edge within
+  BUTTON_DEBOUNCE_US are contact bounce and are dropped.
+    Arguments:
+      - uint8_t button: Index of the button
+    Returns:
+      - void
+  */
+  uint32_t time = micros();
+  uint8_t level = digitalRead(buttonPins[button]);
+  portENTER_CRITICAL_ISR(&buttonLock);
+  if(level != edgeLevels[button]){
+    if(time - edgeTimes[button] < BUTTON_DEBOUNCE_US){
+      bounceRejected[button] = true;
+      buttonStats.bounces++;
+    }
+    else queue_edge(button, level, time);
+  }
+  portEXIT_CRITICAL_ISR(&buttonLock);
+}
+
+static void IRAM_ATTR button1_isr(){ button_isr(0); }
+static void IRAM_ATTR button2_isr(){ button_isr(1); }
+static void IRAM_ATTR button3_isr(){ button_isr(2); }
+static void IRAM_ATTR button4_isr(){ button_isr(3); }
+
+void button_begin(){
+  /* Takes the current button levels and attaches the edge interrupts. The pins must already be configured as inputs.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  static void (*const handlers[BUTTON_COUNT])() = {button1_isr, button2_isr, button3_isr, button4_isr};
+  uint32_t now = micros();
+  for(int i = 0; i < BUTTON_COUNT; i++){
+    edgeLevels[i] = digitalRead(buttonPins[i]);
+    edgeTimes[i] = now;
+    buttonLevels[i] = edgeLevels[i];
+    *levels[i] = edgeLevels[i];
+    attachInterrupt(digitalPinToInterrupt(buttonPins[i]), handlers[i], CHANGE);
+  }
+}
+
+static void resync(uint8_t button, uint32_t now){
+  /* If the last edge of a bounce was rejected, the debounced level can differ from the pin's level until the next edge. Once the bounce is
+  over, the pin is read and a missing edge is queued with the current time.
+    Arguments:
+      - uint8_t button: Index of the button
+      - uint32_t now: Current micros()
+    Returns:
+      - void
+  */
+  if(!bounceRejected[button] || now - edgeTimes[button] < BUTTON_DEBOUNCE_US) return;
+  uint8_t level = digitalRead(buttonPins[button]);
+  portENTER_CRITICAL(&buttonLock);
+  bounceRejected[button] = false;
+  if(level != edgeLevels[button]){
+    queue_edge(button, level, now);
+    buttonStats.resyncs++;
+  }
+  portEXIT_CRITICAL(&buttonLock);
+}
+
+static void log_gestures(uint8_t button, uint8_t gestures){
+  if(gestures & GESTURE_SHORT) LOG_INFO("Btn %d short press detected.", button + 1);
+  if(gestures & GESTURE_DOUBLE) LOG_INFO("Btn %d double press detected.", button + 1);
+  if(gestures & GESTURE_LONG) LOG_INFO("Btn %d long press detected.", button + 1);
+  if(gestures & GESTURE_REPEAT) LOG_DEBUG("Btn %d repeat.", button + 1);
+}
+
+void button_update(){
+  /* Takes the queued edges, runs the gesture recognizers and sets btn1-btn4 and buttonGestures for this iteration of main_loop(). A long
+  press is reported as soon as the button has been held for its long press time, without waiting for the release.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  uint32_t resyncTime = micros();
+  for(int i = 0; i < BUTTON_COUNT; i++){
+    buttonGestures[i] = 0;
+    resync(i, resyncTime);
+  }
+
+  ButtonEvent event;
+  while(buttonQueue.pop(event)){
+    if((bool)event.level == buttonLevels[event.button]) continue;
+    buttonLevels[event.button] = event.level;
+    buttonGestures[event.button] |= gesture_edge(&gestureStates[event.button], &gestureConfigs[event.button], event.level, event.time);
+  }
+
+  //Taken after the queue was drained, so no edge fed to the recognizers is newer. An edge queued meanwhile waits for the next update.
+  uint32_t now = micros();
+  for(int i = 0; i < BUTTON_COUNT; i++){
+    buttonGestures[i] |= gesture_tick(&gestureStates[i], &gestureConfigs[i], now);
+    *levels[i] = buttonLevels[i];
+    if(buttonGestures[i]) log_gestures(i, buttonGestures[i]);
+  }
+}
+
+ButtonStats button_get_stats(){
+  /* Returns the edge counters since boot
+    Arguments:
+      - void
+    Returns:
+      - ButtonStats: The counters
+  */
+  portENTER_CRITICAL(&buttonLock);
+  ButtonStats stats = buttonStats;
+  portEXIT_CRITICAL(&buttonLock);
+  return stats;
+}
@@ -0,0 +1,54 @@
+#ifndef BUTTON_HANDLER_H
+#define BUTTON_HANDLER_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "Gesture.h"
+
+/*Button capture. Edge interrupts on BTN1-BTN4 put debounced, microsecond timestamped edges in a queue, the control task takes them in
+button_update() and runs each button's gesture recognizer (Gesture.h) on them. Nothing waits for a button, a held button never stalls
+main_loop().*/
+#define BUTTON_QUEUE_LEN 32               // Edges, must be a power of 2
+#define BUTTON_DEBOUNCE_US 5000           // Edges closer than this to the last accepted edge of the button are contact bounce
+
+//Gesture timings, see the table in Button_handler.cpp
+#define BUTTON_LOCKOUT_MS 300             // A press within this time after a release is ignored
+#define BUTTON_SHORT_PRESS_MS 500         // A release within this time after the press is a short press
+#define BUTTON_LONG_PRESS_MS 1200         // A button held for this long is a long press
+#define BUTTON4_LONG_PRESS_MS 2000        // Long press time of BTN4, which shuts the wheelchair down
+#define BUTTON_REPEAT_DELAY_MS 500        // Menu navigation: a held button repeats after this time...
+#define BUTTON_REPEAT_INTERVAL_MS 150     // ...and then at this interval
+
+enum BUTTON{
+  BUTTON_1,
+  BUTTON_2,
+  BUTTON_3,
+  BUTTON_4,
+  BUTTON_COUNT
+};
+
+struct ButtonEvent{
+  uint32_t time;          // micros() of the edge
+  uint8_t button;         // BUTTON
+  uint8_t level;          // Level after the edge, HIGH = pressed
+};
+
+struct ButtonStats{
+  uint32_t edges;         // Accepted edges
+  uint32_t bounces;       // Edges rejected by the debounce
+  uint32_t resyncs;       // Levels corrected because the last edge of a bounce was rejected
+  uint32_t overflows;     // Edges lost because the queue was full
+};
+
+//GESTURE bits recognized in the current iteration of main_loop(), per BUTTON
+extern uint8_t buttonGestures[BUTTON_COUNT];
+
+void button_begin();
+void button_update();
+ButtonStats button_get_stats();
+
+static inline bool button_gesture(uint8_t button, uint8_t gestures){
+  return (buttonGestures[button] & gestures) != 0;
+}
+
+#endif
@@ -0,0 +1,379 @@
+#include "Control_handler.h"
+#include "TWAI_handler.h"
+#include "TWAI_rx.h"
+#include "TWAI_tx.h"
+#include "TWAI_recovery.h"
+#include "VESC_status.h"
+#include "PID_Controller.h"
+#include "Profiler.h"
+#include "Latency.h"
+#include "Trace.h"
+#include "Recorder.h"
+#include "Log.h"
+#include "Button_handler.h"
+
+//Initialize pid controllers
+PID pid_left(0, 0, 0), pid_right(0, 0, 0);
+
+twai_message_t transmittedVESCMessage[5];
+Seqlock<ScreenState> screenState;
+//micros() of the last joystick sample, carried by the setpoints computed from it (Latency.h)
+static uint32_t joystickSampledAt = 0;
+
+void get_joystick_position(int &xval, int &yval){
+  /* This joystick maps the position of the joystick to RPM values for the motors, to be read by the arcade_drive() function.
+      Arguments:
+        - int &xval: Reference to an int variable which will store the RPM value for x_axis movement
+        - int &yval: Reference to an int variable which will store the RPM value for y_axis movement
+      Returns:
+        - void
+  */
+  joystickSampledAt = latency_sample();
+  int x = analogRead(JOYSTICKX);
+  int y = analogRead(JOYSTICKY);
+  TRACE_ADC(x, y);
+
+  //Correct the values according to thresholds and maximum/ minimum values
+  if(x >= xMidLevel && x < xUpperThresh) x = xUpperThresh;
+  if(x < xMidLevel && x > xLowerThresh) x = xLowerThresh;
+  if(y >= yMidLevel && y < yUpperThresh) y = yUpperThresh;
+  if(y < yMidLevel && y > yLowerThresh) y = yLowerThresh;
+
+  if(x >= xMax) x = xMax;
+  if(x <= xMin) x = xMin;
+  if(y>= yMax) y = yMax;
+  if(y<= yMin) y = yMin;
+
+  //Set value of x and y axi within the range (-1000, 1000)
+  if(x <= xLowerThresh) xval = map(x, (long)xMin, (long)xLowerThresh, -3000, 0);
+  if(x >= xUpperThresh) xval = map(x, (long)xUpperThresh, (long)xMax, 0, 3000);
+  if(y <= yLowerThresh) yval = map(y, (long)yMin, (long)yLowerThresh, -3000, 0);
+  if(y >= yUpperThresh) yval = map(y, (long)yUpperThresh, (long)yMax, 0, 3000);
+};
+
+void arcade_drive(int x_axis, int y_axis, int& left_motor, int& right_motor){
+  /* Function that calculates the motor inputs according to arcade drive mode. The algorithm and more information on arcade driving
+  can be found at: "https://xiaoxiae.github.io/Robotics-Simplified-Website/drivetrain-control/arcade-drive/".
+    Arguments:
+      - int x_axis: The joystick's x axis value
+      - int y_axis: The joystick's y axis value
+      - int &left_motor: Reference to integer variable that stores the left motor input value
+      - int &right_motor: Reference to integer variable that stores the right motor input value 
+    Returns:
+      - void    
+  */
+  int maximum = max(abs(x_axis), abs(y_axis));
+  int sum = y_axis + x_axis, difference = y_axis - x_axis;
+
+  if(y_axis >= 0){
+    if(x_axis >= 0){
+      left_motor = maximum;
+      right_motor = difference;
+    }
+    else{
+      left_motor = sum;
+      right_motor = maximum;
+    }
+  }
+  else{
+    if(x_axis >= 0){
+      left_motor = sum;
+      right_motor = -maximum;
+    }
+    else{
+      left_motor = -maximum;
+      right_motor = difference;
+    }
+  }
+}
+
+void stair_climbing_mode(int& left_assembly, int& right_assembly){
+  /* This function implements the stair climbing mote. The current algorithm controls each of the three assemblies' rotations based on certain input.
+    The joystick's y axis controls the left assembly, x axis controlls the right assembly and the left and right buttons control the rear assembly.
+      Arguments:
+        - int& left_assembly: Reference to the integer variable which stores the left assembly's motor speed
+        - int& right_assembly: Reference to the integer variable which stores the right assembly's motor speed
+      Returns:
+        - void
+  */
+  int y_val = analogRead(JOYSTICKY);
+  int x_val = analogRead(JOYSTICKX);
+  TRACE_ADC(x_val, y_val);
+  if(y_val > yMax-200){
+    left_assembly = 1500;
+    right_assembly = 1500;
+  }
+  else if(y_val < yMin + 200){
+    left_assembly = -1500;
+    right_assembly = - 1500;
+  }
+  else {left_assembly = 0; right_assembly = 0;}
+
+  if(x_val > xMax - 200){
+    rear_assembly = 1500;
+  }
+  else if(x_val < xMin + 200){
+    rear_assembly = -1500;
+  }
+  else rear_assembly = 0;
+
+  if(btn2){
+    left_motor = 2000;
+    right_motor = 2000;
+  }
+  else if(btn3){
+    left_motor = -2000;
+    right_motor = -2000;
+  }
+  else {left_motor = 0; right_motor = 0;};
+}
+
+void configuration_menu(){
+  /* This function implements the configuration menu's functionality: menu navigation, joystick calibration and the backrest/ footrest actuator
+  commands. It runs in the control task, the menu itself is drawn by configureMode() in the render task.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  if(button_gesture(BUTTON_2, GESTURE_SHORT | GESTURE_REPEAT)){
+    if(selection == 0) selection = 2;
+    else selection--;
+  }
+  if(button_gesture(BUTTON_3, GESTURE_SHORT | GESTURE_REPEAT)){
+    if(selection == 2) selection = 0;
+    else selection++;
+  }
+
+  switch(selection){
+    case 0:
+      //Calibration menu
+      if(!calibrating){
+        calibrationStage = CALIBRATION_IDLE;
+        if(button_gesture(BUTTON_1, GESTURE_SHORT)){
+          //If a short press is detected, toggle calibration flag on
+          calibrating = true;
+          LOG_INFO("Starting to calibrate");
+          startingTime = millis(); // Keep track of starting time
+          LOG_INFO("Starting time: %u", startingTime);
+        }
+      }else{
+        //Keep track of current time
+        currentTime = millis();
+        if((uint16_t)(currentTime - startingTime) < 8000){
+          if(!calibrationBegin){
+            yUpperThresh = INT_MIN;
+            yLowerThresh = INT_MAX;
+            yMin = INT_MAX;
+            yMax = INT_MIN;
+            calibrationBegin = true;
+          }
+
+          //Begin the calibration process
+          if((uint16_t)(currentTime - startingTime) < 4000){
+            calibrationStage = CALIBRATION_REST;
+            x_value = analogRead(JOYSTICKX);
+            y_value = analogRead(JOYSTICKY);
+            if(x_value>xUpperThresh) xUpperThresh = x_value;
+            if(x_value<xLowerThresh) xLowerThresh = x_value;
+            if(y_value>yUpperThresh) yUpperThresh = y_value;
+            if(y_value<yLowerThresh) yLowerThresh = y_value;
+            xMidLevel = (xUpperThresh + xLowerThresh)/2;
+            yMidLevel = (yUpperThresh + yLowerThresh)/2;
+          }
+          else{
+            calibrationStage = CALIBRATION_RANGE;
+            x_value = analogRead(JOYSTICKX);
+            y_value = analogRead(JOYSTICKY);
+            if(x_value>xMax) xMax = x_value;
+            if(x_value<xMin) xMin = x_value;
+            if(y_value>yMax) yMax = y_value;
+            if(y_value<yMin) yMin = y_value;
+          }
+        }
+        else{
+          calibrationBegin = false;
+          calibrating = false; //When the calibration is done, toggle calibration mode off
+          calibrationStage = CALIBRATION_IDLE;
+          yUpperThresh = yUpperThresh + 50;
+          yLowerThresh = yLowerThresh - 50;
+          yMax = yMax - 75;
+          yMin = yMin + 75;
+          xUpperThresh = xUpperThresh + 50;
+          xLowerThresh = xLowerThresh - 50;
+          xMax = xMax - 75;
+          xMin = xMin + 75;
+          LOG_INFO("Calibration finished");
+        }
+      }
+      break;
+    case 1:
+    case 2:
+      //Backrest (1)/ footrest (2) adjust menu. Change the angle depending on the joystick input
+      if(analogRead(JOYSTICKY)>yMax-400) actuatorAction = ACTUATOR_EXTEND;
+      else if(analogRead(JOYSTICKY)<yMin+400) actuatorAction = ACTUATOR_RETRACT;
+      else actuatorAction = ACTUATOR_STOP;
+      transmittedActuatorsMessage = createActuatorsMessage(ACTUATORS_MESSAGE_ID, selection == 1, (ACTUATOR_ACTION)actuatorAction);
+      if(backAngle>=maxBackAngle) backAngle = maxBackAngle;
+      if(backAngle<=minBackAngle) backAngle = minBackAngle;
+      if(footAngle>=maxFootAngle) footAngle = maxFootAngle;
+      if(footAngle<=minFootAngle) footAngle = minFootAngle;
+      break;
+    default:
+      break;
+  }
+}
+
+void publish_screen_state(){
+  /* Publishes the part of the control state that is shown on the screen. The render task reads it through screenState, so it never sees
+  a half updated state.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  ScreenState state;
+  speed = vesc_speed_kph(micros()) + 0.5f;
+  state.speed = speed;
+  state.driveMode = driveMode;
+  state.configMode = configMode;
+  state.voltage1 = voltage1;
+  state.voltage2 = voltage2;
+  state.selection = selection;
+  state.calibrating = calibrating;
+  state.calibrationStage = calibrationStage;
+  state.actuatorAction = actuatorAction;
+  screenState.write(state);
+}
+
+void main_loop() {
+  /* This is the body of the control task. It is called once per period of the control task (CONTROL_LOOP_HZ) and must not draw on the screen
+  or wait on anything but the TWAI driver.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  PROFILE_START(STAGE_LOOP);
+
+  // Set the TWAI communication's error flag to true on each iteration
+  flag = true;
+
+  //Take the button edges captured by the interrupts and detect short and long presses
+  PROFILE_START(STAGE_BUTTONS);
+  button_update();
+  TRACE_BUTTONS(btn1 | btn2 << 1 | btn3 << 2 | btn4 << 3);
+  PROFILE_END(STAGE_BUTTONS);
+
+  //Take the latest values received from the actuators controller. The frames are received and decoded by the RX task, so this never blocks.
+  //The RX task writes them on this core at a lower priority: if this task preempted it in the middle of a write, the values of the last
+  //iteration are kept.
+  PROFILE_START(STAGE_CAN_RX);
+  static ActuatorsControllerData received = {};
+  actuatorsControllerData.try_read(received);
+  voltage1 = received.voltage1;
+  voltage2 = received.voltage2;
+  temperature = received.temperature;
+  left_assembly_angle = received.left_assembly_angle;
+  right_assembly_angle = received.right_assembly_angle;
+  PROFILE_END(STAGE_CAN_RX);
+
+  //Get the joysticks position
+  PROFILE_START(STAGE_JOYSTICK);
+  get_joystick_position(x_value, y_value);
+  PROFILE_END(STAGE_JOYSTICK);
+
+  // Implement functionality for configureation mode, drive mode and stair climbing mode.
+  if(!configMode){
+    if(driveMode){
+      /*This is the drive mode. It reads the joysticks position, calculates the motor speeds and constructs the TWAI messages to control the motors. The assemblies are only 
+        controlled by the PID control loops and not from user input*/
+
+      /*The following code is commented out for troubleshooting purposes. *_assembly_target sets the target angle for the two front assemblies, to be used 
+        in the PID control loop. The algorithm has a margin of 10 degrees of error, which can be adjusted in the following lines.*/
+      // float left_assembly_target = 90.0;
+      // float right_assembly_target = 90.0;
+
+      // if(abs(left_assembly_target - left_assembly_angle) < 10) left_assembly = 0;
+      // else left_assembly = pid_left.PID_Control(left_assembly_angle, left_assembly_target);
+
+      // if(abs(right_assembly_target - right_assembly_target) < 10) right_assembly = 0;
+      // else right_assembly = pid_right.PID_Control(right_assembly_angle, right_assembly_target);
+      PROFILE_START(STAGE_DRIVE);
+      arcade_drive(x_value, y_value, left_motor, right_motor);
+      PROFILE_END(STAGE_DRIVE);
+      PROFILE_START(STAGE_VESC_MESSAGE);
+      encode_vesc_fixed<7, CAN_PACKET_SET_RPM>(&transmittedVESCMessage[0], 0);
+      encode_vesc_fixed<8, CAN_PACKET_SET_RPM>(&transmittedVESCMessage[1], 0);
+      encode_vesc_fixed<9, CAN_PACKET_SET_RPM>(&transmittedVESCMessage[2], -right_motor);
+      encode_vesc_fixed<10, CAN_PACKET_SET_RPM>(&transmittedVESCMessage[3], 0);
+      encode_vesc_fixed<11, CAN_PACKET_SET_RPM>(&transmittedVESCMessage[4], -left_motor);
+      PROFILE_END(STAGE_VESC_MESSAGE);
+    }
+    else{
+      /*This is the stair climbing mode. It calculates the assemblies motors' speeds according to the joystick's position and constructs 
+      the TWAI controls to be transmitted. The wheelchair can not be driven or steered in this mode*/
+      PROFILE_START(STAGE_DRIVE);
+      stair_climbing_mode(left_assembly, right_assembly);
+      PROFILE_END(STAGE_DRIVE);
+      PROFILE_START(STAGE_VESC_MESSAGE);
+      encode_vesc_fixed<7, CAN_PACKET_SET_RPM>(&transmittedVESCMessage[0], rear_assembly);
+      encode_vesc_fixed<8, CAN_PACKET_SET_RPM>(&transmittedVESCMessage[1], left_assembly);
+      encode_vesc_fixed<9, CAN_PACKET_SET_RPM>(&transmittedVESCMessage[2], -right_motor);
+      encode_vesc_fixed<10, CAN_PACKET_SET_RPM>(&transmittedVESCMessage[3], right_assembly);
+      encode_vesc_fixed<11, CAN_PACKET_SET_RPM>(&transmittedVESCMessage[4], -left_motor);
+      PROFILE_END(STAGE_VESC_MESSAGE);
+    }
+  }
+  else{
+    /*This is the configure mode. If the user enters configure mode, the motors' speed is set to 0 for safety reasons*/
+    PROFILE_START(STAGE_VESC_MESSAGE);
+    encode_vesc_fixed<7, CAN_PACKET_SET_RPM>(&transmittedVESCMessage[0], 0);
+    encode_vesc_fixed<8, CAN_PACKET_SET_RPM>(&transmittedVESCMessage[1], 0);
+    encode_vesc_fixed<9, CAN_PACKET_SET_RPM>(&transmittedVESCMessage[2], 0);
+    encode_vesc_fixed<10, CAN_PACKET_SET_RPM>(&transmittedVESCMessage[3], 0);
+    encode_vesc_fixed<11, CAN_PACKET_SET_RPM>(&transmittedVESCMessage[4], 0);
+    PROFILE_END(STAGE_VESC_MESSAGE);
+  }
+
+  //Put the new setpoints in the TX mailboxes, replacing any frame of the previous iterations that was not sent yet. Unchanged setpoints are
+  //only resent every TX_KEEPALIVE_MS. The black box records the setpoints that changed.
+  for(int i = 0; i < 5; i++){
+    recorder_setpoint(&transmittedVESCMessage[i]);
+    tx_submit(&transmittedVESCMessage[i], joystickSampledAt);
+  }
+  /*The line below is commented out. It puts the actuators' TWAI message in its mailbox, it is then sent to the actuators controller after the
+  VESC setpoints. Uncomment when the actuators controller's behavior is as desired*/
+  // tx_submit(&transmittedActuatorsMessage, joystickSampledAt);
+
+  //Bus errors are handled by the recovery task (TWAI_recovery.h). While the bus is down the setpoints wait in their mailboxes.
+  PROFILE_START(STAGE_TWAI_STATUS);
+  flag = twai_recovery_bus_up();
+  //A restarted driver has lost the frames in its TX queue
+  static uint32_t handledRestarts = 0;
+  uint32_t driverRestarts = twai_recovery_restarts();
+  if(driverRestarts != handledRestarts){
+    handledRestarts = driverRestarts;
+    tx_resend();
+  }
+  PROFILE_END(STAGE_TWAI_STATUS);
+
+  //The TX task hands the mailboxes to the driver in their slots (TWAI_schedule.h), the drive motors' in the slot after this release
+  if (flag) {
+    // Execute this block only if the TWAI error flag is true
+    twai_get_status_info(&status_info); // Update the TWAI bus status info
+  }
+
+  //Toggle drive mode and configure mode depending on short or long button press detection
+  if(!configMode && button_gesture(BUTTON_1, GESTURE_SHORT)) driveMode = !driveMode;
+  if(lastMode==configMode && button_gesture(BUTTON_1, GESTURE_LONG)) configMode = !configMode;
+
+  //Run the configuration menu if configMode is true. The screen itself is drawn by the render task
+  if(configMode) configuration_menu();
+
+  //Save the current mode
+  lastMode = configMode;
+
+  publish_screen_state();
+  PROFILE_END(STAGE_LOOP);
+}
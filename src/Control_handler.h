@@ -0,0 +1,32 @@
+#ifndef CONTROL_HANDLER_H
+#define CONTROL_HANDLER_H
+
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "config.h"
+#include "Seqlock.h"
+
+//Snapshot of the control state that is drawn on the screen. Published by the control task, read by the render task.
+struct ScreenState{
+  uint16_t speed;
+  bool driveMode;
+  bool configMode;
+  float voltage1;
+  float voltage2;
+  uint8_t selection;
+  bool calibrating;
+  uint8_t calibrationStage;
+  uint8_t actuatorAction;
+};
+
+extern twai_message_t transmittedVESCMessage[5];
+extern Seqlock<ScreenState> screenState;
+
+void get_joystick_position(int &xval, int &yval);
+void arcade_drive(int x_axis, int y_axis, int& left_motor, int& right_motor);
+void stair_climbing_mode(int& left_assembly, int& right_assembly);
+void configuration_menu();
+void publish_screen_state();
+void main_loop();
+
+#endif
@@ -0,0 +1,104 @@
+#include "Gesture.h"
+
+static inline uint32_t us(uint16_t ms){
+  return (uint32_t)ms * 1000;
+}
+
+static inline int32_t elapsed(uint32_t now, uint32_t since){
+  //Signed, for deadlines that can still be ahead
+  return (int32_t)(now - since);
+}
+
+static inline uint32_t since(uint32_t now, uint32_t past){
+  //Time since a past event, right for up to 71.6 min (2^32 us)
+  return now - past;
+}
+
+static uint32_t advance(GestureState *state, uint32_t now){
+  //A time shortly before the newest one is out of order, no time passed since the newest one. Otherwise it is the new newest time.
+  if(state->latest - now <= GESTURE_MAX_SKEW_US) return state->latest;
+  state->latest = now;
+  return now;
+}
+
+uint8_t gesture_tick(GestureState *state, const GestureConfig *config, uint32_t now){
+  /* Advances a button's state machine to the given time: reports a short press whose double press window expired, and the long press and
+  repeats of a held button.
+    Arguments:
+      - GestureState *state: The button's state
+      - const GestureConfig *config: The button's parameters
+      - uint32_t now: Current time in us
+    Returns:
+      - uint8_t: The GESTURE bits that were recognized
+  */
+  now = advance(state, now);
+  uint8_t gestures = 0;
+  //Once the lockout is over the release no longer matters, so a long idle time cannot wrap into it
+  if(state->released && since(now, state->released_at) > us(config->lockout_ms)) state->released = false;
+  if(state->phase == GESTURE_WAIT_DOUBLE && since(now, state->released_at) > us(config->double_ms)){
+    state->phase = GESTURE_IDLE;
+    gestures |= GESTURE_SHORT;
+  }
+  if(state->phase != GESTURE_PRESSED) return gestures;
+
+  if(!state->long_reported && since(now, state->pressed_at) >= us(config->long_ms)){
+    state->long_reported = true;
+    gestures |= GESTURE_LONG;
+  }
+  if(config->repeat_delay_ms > 0 && elapsed(now, state->next_repeat) >= 0){
+    state->repeated = true;
+    gestures |= GESTURE_REPEAT;
+    //At most one repeat per call, a late call does not report the missed ones
+    state->next_repeat += us(config->repeat_interval_ms);
+    if(elapsed(now, state->next_repeat) >= 0) state->next_repeat = now + us(config->repeat_interval_ms);
+  }
+  return gestures;
+}
+
+uint8_t gesture_edge(GestureState *state, const GestureConfig *config, bool pressed, uint32_t time){
+  /* Feeds a debounced edge of a button to its state machine. The edges of a button must be given in time order, and the state is first
+  advanced to the edge's time with gesture_tick().
+    Arguments:
+      - GestureState *state: The button's state
+      - const GestureConfig *config: The button's parameters
+      - bool pressed: true for a press, false for a release
+      - uint32_t time: Time of the edge in us
+    Returns:
+      - uint8_t: The GESTURE bits that were recognized
+  */
+  uint8_t gestures = gesture_tick(state, config, time);
+  time = state->latest;
+
+  if(pressed){
+    //Before the first release there is nothing to lock out
+    if(state->phase == GESTURE_IDLE && state->released && since(time, state->released_at) <= us(config->lockout_ms)){
+      state->phase = GESTURE_IGNORED;
+    }
+    else if(state->phase == GESTURE_IDLE || state->phase == GESTURE_WAIT_DOUBLE){
+      state->second = state->phase == GESTURE_WAIT_DOUBLE;
+      state->phase = GESTURE_PRESSED;
+      state->long_reported = false;
+      state->repeated = false;
+      state->pressed_at = time;
+      state->next_repeat = time + us(config->repeat_delay_ms);
+    }
+    return gestures;
+  }
+
+  if(state->phase == GESTURE_IGNORED){
+    state->phase = GESTURE_IDLE;
+    state->released = true;
+    state->released_at = time;
+  }
+  if(state->phase != GESTURE_PRESSED) return gestures;
+
+  state->phase = GESTURE_IDLE;
+  state->released = true;
+  state->released_at = time;
+  //A press that already reported a long press or repeats, or that was held too long, is not a short press
+  if(state->long_reported || state->repeated || since(time, state->pressed_at) >= us(config->short_ms)) return gestures;
+  if(state->second) gestures |= GESTURE_DOUBLE;
+  else if(config->double_ms > 0) state->phase = GESTURE_WAIT_DOUBLE;
+  else gestures |= GESTURE_SHORT;
+  return gestures;
+}
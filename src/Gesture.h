@@ -0,0 +1,52 @@
+#ifndef GESTURE_H
+#define GESTURE_H
+
+#include <stdint.h>
+
+/*Button gesture recognizer. One state machine per button, parameterized by a GestureConfig, turns the button's debounced edges and the
+passing time into gestures. It only uses the times it is given (32 bit microseconds, differences are wrap safe as long as the state
+is ticked at least every 71 min), so it runs the same on the ESP32 and on a host with synthetic edge sequences. A time up to
+GESTURE_MAX_SKEW_US before the newest time the state was given, e.g. a tick at a time taken before an edge that was queued meanwhile, is
+taken as that newest time. Each call is O(1) and nothing is allocated.*/
+#define GESTURE_MAX_SKEW_US 1000000
+
+//Gestures, as bits: a call can report several, e.g. a double press window expiring and a long press of the next press
+enum GESTURE{
+  GESTURE_SHORT = 1 << 0,     // Released within short_ms (and, if double presses are enabled, not pressed again within double_ms)
+  GESTURE_LONG = 1 << 1,      // Held for long_ms, reported once while the button is still held
+  GESTURE_DOUBLE = 1 << 2,    // Second short press starting within double_ms of the release of the first one
+  GESTURE_REPEAT = 1 << 3     // Held for repeat_delay_ms, then again every repeat_interval_ms while held
+};
+
+struct GestureConfig{
+  uint16_t lockout_ms;          // A press within this time after a release is ignored (does not apply to the second press of a double press)
+  uint16_t short_ms;
+  uint16_t long_ms;
+  uint16_t double_ms;           // 0 disables double presses, short presses are then reported on release without delay
+  uint16_t repeat_delay_ms;     // 0 disables hold to repeat
+  uint16_t repeat_interval_ms;
+};
+
+enum GESTURE_PHASE{
+  GESTURE_IDLE,
+  GESTURE_PRESSED,            // Press that can become a gesture
+  GESTURE_IGNORED,            // Press within the lockout, ignored until released
+  GESTURE_WAIT_DOUBLE         // Short press released, waiting for a second press
+};
+
+struct GestureState{
+  uint8_t phase;
+  bool second;                // The current press is the second press of a double press
+  bool long_reported;         // A long press or repeats were reported for the current press, its release is not a short press
+  bool repeated;
+  bool released;              // released_at is valid and the lockout after it may not be over
+  uint32_t pressed_at;
+  uint32_t released_at;
+  uint32_t next_repeat;
+  uint32_t latest;            // Newest time of an edge or tick
+};
+
+uint8_t gesture_edge(GestureState *state, const GestureConfig *config, bool pressed, uint32_t time);
+uint8_t gesture_tick(GestureState *state, const GestureConfig *config, uint32_t now);
+
+#endif
@@ -0,0 +1,122 @@
+#include "Latency.h"
+
+// Recorded by the control task, read by the service loop
+static LatencyStats latencyStats[VESC_NODE_COUNT];
+static portMUX_TYPE latencyStatsLock = portMUX_INITIALIZER_UNLOCKED;
+
+static uint8_t bucket(uint32_t us){
+  //Exact below LATENCY_EXACT_US, then LATENCY_SUB_BUCKETS buckets of equal width per power of two
+  if(us < LATENCY_EXACT_US) return us;
+  if(us >= LATENCY_MAX_US) return LATENCY_BUCKETS - 1;
+  uint8_t exponent = 31 - __builtin_clz(us);
+  uint8_t sub = (us >> (exponent - 3)) & (LATENCY_SUB_BUCKETS - 1);
+  return LATENCY_EXACT_US + (exponent - 4) * LATENCY_SUB_BUCKETS + sub;
+}
+
+static uint32_t bucket_upper(uint8_t index){
+  //Highest latency counted in a bucket, UINT32_MAX for the last one
+  if(index < LATENCY_EXACT_US) return index;
+  if(index == LATENCY_BUCKETS - 1) return UINT32_MAX;
+  uint8_t exponent = 4 + (index - LATENCY_EXACT_US) / LATENCY_SUB_BUCKETS;
+  uint8_t sub = (index - LATENCY_EXACT_US) % LATENCY_SUB_BUCKETS;
+  uint32_t width = (uint32_t)1 << (exponent - 3);
+  return (LATENCY_SUB_BUCKETS + sub) * width + width - 1;
+}
+
+void latency_begin(){
+  /* Configures the debug pin, if there is one
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  if(LATENCY_DEBUG_PIN < 0) return;
+  pinMode(LATENCY_DEBUG_PIN, OUTPUT);
+  digitalWrite(LATENCY_DEBUG_PIN, LOW);
+}
+
+uint32_t latency_sample(){
+  /* Marks the joystick's ADC sample: raises the debug pin and returns the time the setpoints computed from the sample carry
+    Arguments:
+      - void
+    Returns:
+      - uint32_t: micros() of the sample
+  */
+  if(LATENCY_DEBUG_PIN >= 0) digitalWrite(LATENCY_DEBUG_PIN, HIGH);
+  return micros();
+}
+
+void latency_record(uint8_t index, uint32_t sampled_at, uint32_t now){
+  /* Adds the latency of a frame handed to the driver
+    Arguments:
+      - uint8_t index: The VESC's mailbox, 0 for VESC_FIRST_NODE
+      - uint32_t sampled_at: micros() of the ADC sample the frame's setpoint was computed from
+      - uint32_t now: micros() of the handoff to the driver
+    Returns:
+      - void
+  */
+  if(index >= VESC_NODE_COUNT) return;
+  uint32_t latency = now - sampled_at;
+  portENTER_CRITICAL(&latencyStatsLock);
+  LatencyStats *stats = &latencyStats[index];
+  stats->count++;
+  stats->last_us = latency;
+  stats->total_us += latency;
+  if(latency > stats->max_us) stats->max_us = latency;
+  stats->histogram[bucket(latency)]++;
+  portEXIT_CRITICAL(&latencyStatsLock);
+}
+
+void latency_tx_done(){
+  //A transmission completed on the bus
+  if(LATENCY_DEBUG_PIN >= 0) digitalWrite(LATENCY_DEBUG_PIN, LOW);
+}
+
+uint32_t latency_percentile(const LatencyStats *stats, float percent){
+  /* Calculates a percentile from the histogram. It is the upper end of the bucket that holds it, at most the maximum latency.
+    Arguments:
+      - const LatencyStats *stats: The statistics of one VESC
+      - float percent: The percentile, e.g. 99
+    Returns:
+      - uint32_t: The latency in us, 0 without measurements
+  */
+  if(stats->count == 0) return 0;
+  uint32_t rank = (uint32_t)ceilf(stats->count * percent / 100);
+  if(rank < 1) rank = 1;
+  uint32_t seen = 0;
+  for(uint8_t i = 0; i < LATENCY_BUCKETS; i++){
+    seen += stats->histogram[i];
+    if(seen >= rank) return min(bucket_upper(i), stats->max_us);
+  }
+  return stats->max_us;
+}
+
+LatencyStats get_latency_stats(uint8_t index){
+  LatencyStats stats;
+  portENTER_CRITICAL(&latencyStatsLock);
+  stats = latencyStats[index];
+  portEXIT_CRITICAL(&latencyStatsLock);
+  stats.node = VESC_FIRST_NODE + index;
+  return stats;
+}
+
+void latency_reset(){
+  portENTER_CRITICAL(&latencyStatsLock);
+  memset(latencyStats, 0, sizeof(latencyStats));
+  portEXIT_CRITICAL(&latencyStatsLock);
+}
+
+void print_latency_stats(){
+  /* This function prints the joystick to TX latency of every VESC in the Serial Monitor
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  for(uint8_t i = 0; i < VESC_NODE_COUNT; i++){
+    LatencyStats stats = get_latency_stats(i);
+    Serial.printf("Latency VESC %u: %u frames, mean %u us, p50 %u us, p99 %u us, max %u us\n", stats.node, stats.count,
+                  stats.count > 0 ? (uint32_t)(stats.total_us / stats.count) : 0, latency_percentile(&stats, 50),
+                  latency_percentile(&stats, 99), stats.max_us);
+  }
+}
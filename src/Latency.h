@@ -0,0 +1,45 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "config.h"
+
+/*End-to-end latency of the VESC setpoints: from the joystick's ADC sample in get_joystick_position(), through arcade_drive() or the stair
+climbing mode and the TX mailboxes, to the moment tx_flush_due() hands the frame to twai_transmit(). The sample time travels with the setpoint
+into its mailbox, so a frame that waited there for a full driver queue or a bus recovery is measured from the sample it was computed from.
+Frames resent after a driver restart (tx_resend()) repeat an old setpoint and are not measured.
+
+The latencies are kept per VESC in a log-linear histogram, LATENCY_SUB_BUCKETS buckets per power of two, so p50 and p99 are reported to
+within 1/LATENCY_SUB_BUCKETS of their value without storing the samples. The maximum is exact.
+
+With LATENCY_DEBUG_PIN set to a GPIO the pin goes high at the ADC sample and low when the driver reports the next completed transmission
+(TWAI_ALERT_TX_SUCCESS, read by the recovery task), so the sample to bus latency can be checked with a logic analyzer on the pin and CAN_TX.*/
+#define LATENCY_DEBUG_PIN -1          // GPIO toggled on the sample and the TX completion, -1 to disable
+#define LATENCY_SUB_BUCKETS 8         // Histogram buckets per power of two, a power of two
+#define LATENCY_MAX_US (1UL << 20)    // Latencies from here on are counted in the last bucket
+#define LATENCY_EXACT_US (2 * LATENCY_SUB_BUCKETS)   // Latencies below this have a bucket each
+#define LATENCY_BUCKETS (LATENCY_EXACT_US + (20 - 4) * LATENCY_SUB_BUCKETS + 1)
+#define LATENCY_TX_ALERTS (LATENCY_DEBUG_PIN >= 0 ? TWAI_ALERT_TX_SUCCESS : 0)
+
+static_assert(LATENCY_SUB_BUCKETS == 8 && LATENCY_MAX_US == 1UL << 20, "LATENCY_BUCKETS assumes 8 buckets per octave up to 2^20 us");
+
+struct LatencyStats{
+  uint8_t node;
+  uint32_t count;
+  uint32_t last_us;
+  uint32_t max_us;
+  uint64_t total_us;
+  uint32_t histogram[LATENCY_BUCKETS];
+};
+
+void latency_begin();
+uint32_t latency_sample();
+void latency_record(uint8_t index, uint32_t sampled_at, uint32_t now);
+void latency_tx_done();
+uint32_t latency_percentile(const LatencyStats *stats, float percent);
+LatencyStats get_latency_stats(uint8_t index);
+void latency_reset();
+void print_latency_stats();
+
+#endif
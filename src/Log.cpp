@@ -0,0 +1,192 @@
+#include <atomic>
+#include "Log.h"
+
+volatile uint8_t logLevel = LOG_LEVEL_INFO;
+
+/*Bounded multi producer, single consumer ring. Each slot has a sequence number: 2 * lap while the slot is free for the lap'th write to
+it, 2 * lap + 1 once that write is complete. Producers claim a position with a compare and swap on head and publish the record with the
+sequence number, the log task (the only consumer) reads at tail and frees the slot for the next lap. All zero is a valid empty ring, so
+records can be written before anything is initialized.*/
+struct LogSlot{
+  std::atomic<uint32_t> sequence;
+  LogRecord record;
+};
+
+static LogSlot ring[LOG_RING_SIZE];
+static std::atomic<uint32_t> head(0);
+static uint32_t tail = 0;
+static std::atomic<uint32_t> written(0);
+static std::atomic<uint32_t> dropped(0);
+static TaskHandle_t logTaskHandle = NULL;
+
+static const char levelLetters[LOG_LEVEL_COUNT] = {'E', 'W', 'I', 'D'};
+
+static inline uint32_t lap_of(uint32_t position){
+  return position / LOG_RING_SIZE;
+}
+
+void log_push(uint8_t level, const char *format, uint8_t argc, const uint32_t *args){
+  /* Writes a record in the ring. Never blocks: if the ring is full the record is dropped and counted. Called through the LOG_* macros.
+    Arguments:
+      - uint8_t level: The record's LOG_LEVEL
+      - const char *format: printf format of the message, must be a string literal
+      - uint8_t argc: Number of arguments
+      - const uint32_t *args: The arguments, see log_word()
+    Returns:
+      - void
+  */
+  uint32_t position = head.load(std::memory_order_relaxed);
+  LogSlot *slot;
+  while(1){
+    slot = &ring[position % LOG_RING_SIZE];
+    uint32_t sequence = slot->sequence.load(std::memory_order_acquire);
+    int32_t difference = (int32_t)(sequence - 2 * lap_of(position));
+    if(difference == 0){
+      if(head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+    }
+    else if(difference < 0){
+      //The slot still holds the record of the previous lap, the log task did not catch up
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    else position = head.load(std::memory_order_relaxed);
+  }
+
+  slot->record.time = micros();
+  slot->record.format = format;
+  slot->record.level = level;
+  slot->record.argc = argc;
+  memcpy(slot->record.args, args, argc * sizeof(uint32_t));
+  slot->sequence.store(2 * lap_of(position) + 1, std::memory_order_release);
+  written.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool log_pop(LogRecord *record){
+  /* Takes the oldest record out of the ring. Only called by the log task.
+    Arguments:
+      - LogRecord *record: The record
+    Returns:
+      - bool: false if the ring is empty
+  */
+  LogSlot *slot = &ring[tail % LOG_RING_SIZE];
+  if(slot->sequence.load(std::memory_order_acquire) != 2 * lap_of(tail) + 1) return false;
+  *record = slot->record;
+  slot->sequence.store(2 * (lap_of(tail) + 1), std::memory_order_release);
+  tail++;
+  return true;
+}
+
+int log_format(const LogRecord *record, char *line, size_t size){
+  /* Formats a record as a text line (without line ending): time in s, level and message. Each conversion of the format takes the next
+  argument, as a double for the float conversions and as a 32 bit integer for the others. Length modifiers are ignored.
+    Arguments:
+      - const LogRecord *record: The record
+      - char *line: Buffer for the line
+      - size_t size: Size of the buffer, the line is truncated to fit
+    Returns:
+      - int: Length of the line
+  */
+  int length = snprintf(line, size, "%lu.%06lu %c ", (unsigned long)(record->time / 1000000), (unsigned long)(record->time % 1000000),
+                        record->level < LOG_LEVEL_COUNT ? levelLetters[record->level] : '?');
+  int arg = 0;
+  const char *c = record->format;
+  while(*c && length < (int)size - 1){
+    if(*c != '%'){
+      line[length++] = *c++;
+      continue;
+    }
+    if(c[1] == '%'){
+      line[length++] = '%';
+      c += 2;
+      continue;
+    }
+
+    //Copy the conversion without its length modifiers
+    char conversion[16];
+    int n = 0;
+    conversion[n++] = *c++;
+    while(*c && strchr("-+ #0123456789.", *c) && n < (int)sizeof(conversion) - 2) conversion[n++] = *c++;
+    while(*c && strchr("hlLqjzt", *c)) c++;
+    if(*c == '\0') break;
+    char type = *c++;
+    conversion[n++] = type;
+    conversion[n] = '\0';
+
+    uint32_t word = arg < record->argc ? record->args[arg] : 0;
+    arg++;
+    int printed;
+    if(strchr("fFeEgGaA", type)){
+      float value;
+      memcpy(&value, &word, sizeof(value));
+      printed = snprintf(line + length, size - length, conversion, (double)value);
+    }
+    else if(strchr("di", type)) printed = snprintf(line + length, size - length, conversion, (int)word);
+    else if(strchr("ouxXc", type)) printed = snprintf(line + length, size - length, conversion, (unsigned int)word);
+    else printed = snprintf(line + length, size - length, "?");
+    if(printed > 0) length += printed;
+  }
+  if(length > (int)size - 1) length = size - 1;
+  line[length] = '\0';
+  return length;
+}
+
+uint32_t log_drain(){
+  /* Formats and prints all the records in the ring, and reports the records dropped since the last call. Called by the log task (and by
+  the native program, which has no tasks).
+    Arguments:
+      - void
+    Returns:
+      - uint32_t: Number of records printed
+  */
+  static uint32_t reportedDrops = 0;
+  char line[LOG_LINE_LENGTH];
+  LogRecord record;
+  uint32_t count = 0;
+  while(log_pop(&record)){
+    log_format(&record, line, sizeof(line));
+    Serial.println(line);
+    count++;
+  }
+  uint32_t drops = dropped.load(std::memory_order_relaxed);
+  if(drops != reportedDrops){
+    Serial.printf("Log: %u records dropped\n", (unsigned int)(drops - reportedDrops));
+    reportedDrops = drops;
+  }
+  return count;
+}
+
+static void log_task(void *parameters){
+  /* Task that writes the log on the serial port, every LOG_DRAIN_INTERVAL_MS
+    Arguments:
+      - void *parameters: Unused
+    Returns:
+      - void
+  */
+  while(1){
+    log_drain();
+    vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_INTERVAL_MS));
+  }
+}
+
+void start_log_task(){
+  /* Creates the log task
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  xTaskCreatePinnedToCore(log_task, "log", LOG_TASK_STACK, NULL, LOG_TASK_PRIORITY, &logTaskHandle, LOG_TASK_CORE);
+}
+
+LogStats log_get_stats(){
+  /* Returns the number of written and dropped records since boot
+    Arguments:
+      - void
+    Returns:
+      - LogStats: The counters
+  */
+  LogStats stats;
+  stats.written = written.load(std::memory_order_relaxed);
+  stats.dropped = dropped.load(std::memory_order_relaxed);
+  return stats;
+}
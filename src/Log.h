@@ -0,0 +1,81 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <Arduino.h>
+#include <string.h>
+#include <type_traits>
+
+/*Asynchronous logging. LOG_ERROR()/LOG_WARN()/LOG_INFO()/LOG_DEBUG() take a printf format and up to LOG_MAX_ARGS integer or float
+arguments and only put a binary record (timestamp, format pointer, arguments) in a lock-free ring buffer, so the control and RX tasks never
+wait on the UART. The log task formats the records and writes them on the serial port. When the ring is full the record is dropped and
+counted, the caller never blocks. The format must be a string literal, %s is not supported.*/
+#define LOG_ERROR(...) log_write(LOG_LEVEL_ERROR, __VA_ARGS__)
+#define LOG_WARN(...) log_write(LOG_LEVEL_WARN, __VA_ARGS__)
+#define LOG_INFO(...) log_write(LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_DEBUG(...) log_write(LOG_LEVEL_DEBUG, __VA_ARGS__)
+
+#define LOG_MAX_ARGS 6
+#define LOG_RING_SIZE 128         // Records, must be a power of 2
+#define LOG_LINE_LENGTH 160
+#define LOG_TASK_PRIORITY 1
+#define LOG_TASK_CORE 0
+#define LOG_TASK_STACK 4096
+#define LOG_DRAIN_INTERVAL_MS 10
+
+enum LOG_LEVEL{
+  LOG_LEVEL_ERROR,
+  LOG_LEVEL_WARN,
+  LOG_LEVEL_INFO,
+  LOG_LEVEL_DEBUG,
+  LOG_LEVEL_COUNT
+};
+
+struct LogRecord{
+  uint32_t time;            // micros() when the record was written
+  const char *format;
+  uint8_t level;
+  uint8_t argc;
+  uint32_t args[LOG_MAX_ARGS];
+};
+
+struct LogStats{
+  uint32_t written;
+  uint32_t dropped;         // Records lost because the ring was full
+};
+
+//Records above this level are discarded by the caller. Set at runtime with the '0'-'3' serial commands.
+extern volatile uint8_t logLevel;
+
+void log_push(uint8_t level, const char *format, uint8_t argc, const uint32_t *args);
+bool log_pop(LogRecord *record);
+int log_format(const LogRecord *record, char *line, size_t size);
+uint32_t log_drain();
+void start_log_task();
+LogStats log_get_stats();
+
+//Arguments are stored as 32 bit words: integers as they are, floats as their bit pattern
+template <typename T>
+inline uint32_t log_word(T value){
+  static_assert(std::is_integral<T>::value || std::is_enum<T>::value, "Only integer and float arguments can be logged");
+  return (uint32_t)value;
+}
+
+inline uint32_t log_word(float value){
+  uint32_t word;
+  memcpy(&word, &value, sizeof(word));
+  return word;
+}
+
+inline uint32_t log_word(double value){
+  return log_word((float)value);
+}
+
+template <typename... Args>
+inline void log_write(uint8_t level, const char *format, Args... args){
+  static_assert(sizeof...(Args) <= LOG_MAX_ARGS, "Too many log arguments");
+  if(level > logLevel) return;
+  const uint32_t words[] = {0, log_word(args)...};
+  log_push(level, format, sizeof...(Args), words + 1);
+}
+
+#endif
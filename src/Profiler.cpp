@@ -0,0 +1,71 @@
+#include <Arduino.h>
+#include "Profiler.h"
+
+static StageProfile profiles[STAGE_COUNT];
+
+static const char *stageNames[STAGE_COUNT] = {
+  "loop", "buttons", "can_rx", "joystick", "drive", "vesc_message", "twai_status", "tx", "screen"
+};
+
+static uint32_t ticks_per_us(){
+#ifdef ESP_PLATFORM
+  return getCpuFrequencyMhz();
+#else
+  return 1000;
+#endif
+}
+
+void profiler_record(enum PROFILE_STAGE stage, uint32_t ticks){
+  /* Adds one measurement to a stage's statistics. Each stage must only be recorded from one task.
+    Arguments:
+      - enum PROFILE_STAGE stage: The profiled stage
+      - uint32_t ticks: The stage's duration in CPU cycles (ESP32) or nanoseconds (host)
+    Returns:
+      - void
+  */
+  StageProfile &profile = profiles[stage];
+  if(profile.count == 0 || ticks < profile.min) profile.min = ticks;
+  if(ticks > profile.max) profile.max = ticks;
+  profile.total += ticks;
+  profile.count++;
+
+  uint8_t bucket = ticks ? 32 - __builtin_clz(ticks) : 0;
+  if(bucket >= PROFILE_BUCKETS) bucket = PROFILE_BUCKETS - 1;
+  profile.histogram[bucket]++;
+}
+
+StageProfile profiler_get(enum PROFILE_STAGE stage){
+  return profiles[stage];
+}
+
+void profiler_reset(){
+  memset(profiles, 0, sizeof(profiles));
+}
+
+void profiler_dump(){
+  /* Prints the statistics and histograms of all profiled stages in the Serial Monitor. A histogram line "[a, b) n" means n measurements
+  took at least a and less than b ticks.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  uint32_t scale = ticks_per_us();
+#ifndef ENABLE_PROFILING
+  Serial.println("Profiling is disabled, build with -DENABLE_PROFILING");
+#endif
+  Serial.printf("Stage profile (%u ticks/us)\n", scale);
+  for(int i = 0; i < STAGE_COUNT; i++){
+    StageProfile profile = profiles[i];
+    if(profile.count == 0) continue;
+    uint32_t mean = profile.total / profile.count;
+    Serial.printf("%s: n %u, min %u, mean %u, max %u ticks (%.1f/%.1f/%.1f us)\n", stageNames[i], profile.count, profile.min, mean, profile.max,
+                  (float)profile.min / scale, (float)mean / scale, (float)profile.max / scale);
+    for(int bucket = 0; bucket < PROFILE_BUCKETS; bucket++){
+      if(profile.histogram[bucket] == 0) continue;
+      uint32_t lower = bucket ? (uint32_t)1 << (bucket - 1) : 0;
+      if(bucket == PROFILE_BUCKETS - 1) Serial.printf("  [%u, inf) %u\n", lower, profile.histogram[bucket]);
+      else Serial.printf("  [%u, %u) %u\n", lower, (uint32_t)1 << bucket, profile.histogram[bucket]);
+    }
+  }
+}
@@ -0,0 +1,60 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+
+//Stages of the control loop (and the render and TX tasks) that are profiled
+enum PROFILE_STAGE{
+  STAGE_LOOP,           // Complete main_loop() iteration
+  STAGE_BUTTONS,        // Reading the button states
+  STAGE_CAN_RX,         // Taking the values received by the RX task
+  STAGE_JOYSTICK,       // get_joystick_position()
+  STAGE_DRIVE,          // arcade_drive()/ stair_climbing_mode()
+  STAGE_VESC_MESSAGE,   // Encoding the VESC messages
+  STAGE_TWAI_STATUS,    // TWAI status check and recovery
+  STAGE_TX,             // Handing the due mailboxes to the driver (TX task)
+  STAGE_SCREEN,         // createScreen()/ configureMode() and displayBatteries()
+  STAGE_COUNT
+};
+
+//Number of histogram buckets. Bucket i counts the durations in [2^(i-1), 2^i) ticks, bucket 0 counts durations of 0 ticks.
+#define PROFILE_BUCKETS 32
+
+struct StageProfile{
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint64_t total;
+  uint32_t histogram[PROFILE_BUCKETS];
+};
+
+/*The probes compile to nothing unless ENABLE_PROFILING is defined (see the WheelchairControls_profiling environment). On the ESP32 the
+durations are measured in CPU cycles, on a host in nanoseconds of the monotonic clock. A stage's probes must be in the same scope.*/
+#ifdef ENABLE_PROFILING
+#define PROFILE_START(stage) uint32_t profile_start_##stage = profiler_now()
+#define PROFILE_END(stage) profiler_record(stage, profiler_now() - profile_start_##stage)
+#else
+#define PROFILE_START(stage) do{}while(0)
+#define PROFILE_END(stage) do{}while(0)
+#endif
+
+#ifdef ESP_PLATFORM
+#include <xtensa/hal.h>
+static inline uint32_t profiler_now(){
+  return xthal_get_ccount();
+}
+#else
+#include <time.h>
+static inline uint32_t profiler_now(){
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)((uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec);
+}
+#endif
+
+void profiler_record(enum PROFILE_STAGE stage, uint32_t ticks);
+StageProfile profiler_get(enum PROFILE_STAGE stage);
+void profiler_reset();
+void profiler_dump();
+
+#endif
@@ -0,0 +1,571 @@
+#include <atomic>
+#include <cstddef>
+#include "Recorder.h"
+#include "TWAI_tx.h"
+#include "esp_partition.h"
+#include "esp_timer.h"
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
+
+#define PAGES_PER_SECTOR (RECORDER_SECTOR_SIZE / RECORDER_PAGE_SIZE)
+#define ERASED_SEQUENCE 0xFFFFFFFF
+#define END_OF_PAGE 0xFF
+
+static_assert((RECORDER_RAM_PAGES & (RECORDER_RAM_PAGES - 1)) == 0, "RECORDER_RAM_PAGES must be a power of 2");
+static_assert(RECORDER_SECTOR_SIZE % RECORDER_PAGE_SIZE == 0, "A sector must hold whole pages");
+static_assert(sizeof(RecorderPageHeader) == 16, "The page header is stored as is");
+
+static const char hexDigits[] = "0123456789ABCDEF";
+
+// RAM pages, filled by the producers under recorderLock and programmed by the recorder task. Pages closedPages - writtenPages ... closedPages
+// - 1 (modulo RECORDER_RAM_PAGES) wait for the flash, page closedPages is the open one while pageUsed is not 0.
+static uint8_t pages[RECORDER_RAM_PAGES][RECORDER_PAGE_SIZE];
+static std::atomic<uint32_t> closedPages(0);
+static std::atomic<uint32_t> writtenPages(0);
+static size_t pageUsed = 0;
+static uint64_t previousTime = 0;     // Time of the open page's last record
+static std::atomic<bool> recording(false);
+static RecorderStats recorderStats = {};
+static portMUX_TYPE recorderLock = portMUX_INITIALIZER_UNLOCKED;
+
+// Flash ring, only accessed with writeMutex taken
+static const esp_partition_t *partition = NULL;
+static SemaphoreHandle_t writeMutex = NULL;
+static uint32_t pageCount = 0;
+static uint32_t writePosition = 0;    // Next page to program
+static uint32_t erasedPages = 0;      // Erased pages from writePosition on
+static uint32_t sequence = 0;         // Sequence number of the next page
+static uint16_t session = 0;
+static uint32_t newestPosition = 0;   // Last programmed page, valid if newestValid
+static bool newestValid = false;
+static bool waitCounted = false;      // The oldest full page was counted in erase_waits
+static uint8_t flashPage[RECORDER_PAGE_SIZE];
+
+// Last setpoint per TX mailbox and the mailboxes whose setpoint is not 0, written by the control task
+static twai_message_t setpoints[TX_MAILBOX_COUNT];
+static bool setpointValid[TX_MAILBOX_COUNT];
+static std::atomic<uint32_t> movingMask(0);
+static std::atomic<uint32_t> stoppedAt(0);    // millis() when the last setpoint became 0
+
+static uint16_t crc16(uint16_t crc, const uint8_t *data, size_t length){
+  //CRC-16/CCITT, polynomial 0x1021
+  for(size_t i = 0; i < length; i++){
+    crc ^= (uint16_t)data[i] << 8;
+    for(uint8_t bit = 0; bit < 8; bit++) crc = crc & 0x8000 ? crc << 1 ^ 0x1021 : crc << 1;
+  }
+  return crc;
+}
+
+static uint16_t page_crc(const uint8_t *page){
+  //Over the page without the header's crc field
+  uint16_t crc = crc16(0xFFFF, page, offsetof(RecorderPageHeader, crc));
+  return crc16(crc, page + offsetof(RecorderPageHeader, time), RECORDER_PAGE_SIZE - offsetof(RecorderPageHeader, time));
+}
+
+static size_t put_varint(uint8_t *buffer, uint64_t value){
+  //Unsigned LEB128, 7 bits per byte, least significant first
+  size_t length = 0;
+  do{
+    buffer[length++] = (value & 0x7F) | (value > 0x7F ? 0x80 : 0);
+    value >>= 7;
+  } while(value != 0);
+  return length;
+}
+
+static size_t get_varint(const uint8_t *data, size_t size, uint64_t *value){
+  //Length of the varint at the start of data, 0 if it is truncated or longer than 64 bits
+  *value = 0;
+  for(size_t length = 0; length < size && length < 10; length++){
+    *value |= (uint64_t)(data[length] & 0x7F) << (7 * length);
+    if((data[length] & 0x80) == 0) return length + 1;
+  }
+  return 0;
+}
+
+size_t recorder_encode(const RecorderRecord *record, uint64_t previous, uint8_t *buffer){
+  /* Encodes a record in the page format (Recorder.h)
+    Arguments:
+      - const RecorderRecord *record: The record, its time not before previous
+      - uint64_t previous: Time of the page's previous record, or the page's time for its first one
+      - uint8_t *buffer: At least RECORDER_RECORD_MAX bytes
+    Returns:
+      - size_t: The encoded length
+  */
+  const twai_message_t *frame = &record->frame;
+  uint8_t dlc = frame->data_length_code <= TWAI_FRAME_MAX_DLC ? frame->data_length_code : TWAI_FRAME_MAX_DLC;
+  size_t length = 0;
+  buffer[length++] = frame->extd << 7 | frame->rtr << 6 | (record->type & 0x03) << 4 | dlc;
+  length += put_varint(&buffer[length], record->time - previous);
+  length += put_varint(&buffer[length], frame->identifier & (frame->extd ? TWAI_EXTD_ID_MASK : TWAI_STD_ID_MASK));
+  if(!frame->rtr){
+    memcpy(&buffer[length], frame->data, dlc);
+    length += dlc;
+  }
+  return length;
+}
+
+size_t recorder_decode(const uint8_t *data, size_t size, uint64_t previous, RecorderRecord *record){
+  /* Decodes the record at the start of data
+    Arguments:
+      - const uint8_t *data: Encoded records
+      - size_t size: Bytes left in data
+      - uint64_t previous: Time of the page's previous record, or the page's time for its first one
+      - RecorderRecord *record: Filled with the record
+    Returns:
+      - size_t: The record's length, 0 at the end of the page or for a truncated or invalid record
+  */
+  if(size == 0 || data[0] == END_OF_PAGE) return 0;
+  uint8_t flags = data[0];
+  uint8_t dlc = flags & 0x0F;
+  if(dlc > TWAI_FRAME_MAX_DLC || (flags >> 4 & 0x03) == 0) return 0;
+  uint64_t delta, identifier;
+  size_t length = 1;
+  size_t field = get_varint(&data[length], size - length, &delta);
+  if(field == 0) return 0;
+  length += field;
+  field = get_varint(&data[length], size - length, &identifier);
+  if(field == 0 || identifier > TWAI_EXTD_ID_MASK) return 0;
+  length += field;
+  memset(record, 0, sizeof(RecorderRecord));
+  record->type = flags >> 4 & 0x03;
+  record->time = previous + delta;
+  record->frame.extd = flags >> 7;
+  record->frame.rtr = flags >> 6 & 1;
+  record->frame.data_length_code = dlc;
+  record->frame.identifier = identifier;
+  uint8_t dataBytes = record->frame.rtr ? 0 : dlc;
+  if(length + dataBytes > size) return 0;
+  memcpy(record->frame.data, &data[length], dataBytes);
+  return length + dataBytes;
+}
+
+int candump_format(const RecorderRecord *record, char *line, size_t size){
+  /* Formats a record as a line of a candump log (candump -l), without the line end
+    Arguments:
+      - const RecorderRecord *record: The record
+      - char *line: Output buffer, RECORDER_LINE_LENGTH bytes are enough for any record
+      - size_t size: Its size
+    Returns:
+      - int: Length of the line, like snprintf()
+  */
+  const twai_message_t *frame = &record->frame;
+  char data[2 * TWAI_FRAME_MAX_DLC + 2];
+  size_t length = 0;
+  uint8_t dlc = frame->data_length_code <= TWAI_FRAME_MAX_DLC ? frame->data_length_code : TWAI_FRAME_MAX_DLC;
+  if(frame->rtr){
+    data[length++] = 'R';
+    if(dlc != 0) data[length++] = hexDigits[dlc];
+  }
+  else{
+    for(uint8_t i = 0; i < dlc; i++){
+      data[length++] = hexDigits[frame->data[i] >> 4];
+      data[length++] = hexDigits[frame->data[i] & 0x0F];
+    }
+  }
+  data[length] = '\0';
+  return snprintf(line, size, frame->extd ? "(%010llu.%06llu) %s %08X#%s" : "(%010llu.%06llu) %s %03X#%s",
+                  (unsigned long long)(record->time / 1000000), (unsigned long long)(record->time % 1000000),
+                  record->type == RECORDER_SETPOINT ? "setpoint" : "can0", (unsigned int)frame->identifier, data);
+}
+
+static void append(uint8_t type, const twai_message_t *frame){
+  //Puts a record in the open RAM page, opens the next one when it is full
+  RecorderRecord record;
+  record.type = type;
+  record.frame = *frame;
+  uint8_t encoded[RECORDER_RECORD_MAX];
+  portENTER_CRITICAL(&recorderLock);
+  record.time = esp_timer_get_time();
+  size_t length = recorder_encode(&record, previousTime, encoded);
+  if(pageUsed != 0 && pageUsed + length > RECORDER_PAGE_SIZE){
+    closedPages.store(closedPages.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    pageUsed = 0;
+  }
+  if(pageUsed == 0){
+    uint32_t closed = closedPages.load(std::memory_order_relaxed);
+    if(closed - writtenPages.load(std::memory_order_acquire) >= RECORDER_RAM_PAGES){
+      recorderStats.dropped++;
+      portEXIT_CRITICAL(&recorderLock);
+      return;
+    }
+    uint8_t *page = pages[closed & (RECORDER_RAM_PAGES - 1)];
+    memset(page, 0xFF, RECORDER_PAGE_SIZE);
+    RecorderPageHeader *header = (RecorderPageHeader *)page;
+    header->time = record.time;
+    pageUsed = sizeof(RecorderPageHeader);
+    previousTime = record.time;
+    length = recorder_encode(&record, previousTime, encoded);
+  }
+  memcpy(&pages[closedPages.load(std::memory_order_relaxed) & (RECORDER_RAM_PAGES - 1)][pageUsed], encoded, length);
+  pageUsed += length;
+  previousTime = record.time;
+  recorderStats.records++;
+  recorderStats.record_bytes += length;
+  portEXIT_CRITICAL(&recorderLock);
+}
+
+void recorder_frame(uint8_t type, const twai_message_t *frame){
+  /* Records a received or transmitted frame. Never blocks, does nothing before recorder_begin().
+    Arguments:
+      - uint8_t type: RECORDER_RX or RECORDER_TX
+      - const twai_message_t *frame: The frame
+    Returns:
+      - void
+  */
+  if(recording.load(std::memory_order_acquire)) append(type, frame);
+}
+
+void recorder_setpoint(const twai_message_t *frame){
+  /* Records a setpoint frame submitted to the TX mailboxes if it differs from its node's previous one, and tracks whether the chair is
+  stationary. Only called by the control task.
+    Arguments:
+      - const twai_message_t *frame: A VESC frame, its identifier's low byte is the VESC node, or the actuators controller's command
+    Returns:
+      - void
+  */
+  if(!recording.load(std::memory_order_acquire)) return;
+  uint8_t index = frame->extd && frame->identifier == ACTUATORS_MESSAGE_ID ? TX_ACTUATORS_MAILBOX
+                                                                           : (uint8_t)((frame->identifier & 0xFF) - VESC_FIRST_NODE);
+  if(index >= TX_MAILBOX_COUNT) return;
+  const twai_message_t *last = &setpoints[index];
+  if(setpointValid[index] && last->identifier == frame->identifier && last->flags == frame->flags &&
+     last->data_length_code == frame->data_length_code && memcmp(last->data, frame->data, frame->data_length_code) == 0) return;
+  setpoints[index] = *frame;
+  setpointValid[index] = true;
+  append(RECORDER_SETPOINT, frame);
+
+  bool moving = false;
+  for(uint8_t i = 0; i < frame->data_length_code && i < TWAI_FRAME_MAX_DLC; i++) moving = moving || frame->data[i] != 0;
+  uint32_t mask = movingMask.load(std::memory_order_relaxed);
+  uint32_t updated = moving ? mask | 1 << index : mask & ~(1 << index);
+  if(mask != 0 && updated == 0) stoppedAt.store(millis(), std::memory_order_relaxed);
+  movingMask.store(updated, std::memory_order_release);
+}
+
+static bool stationary(){
+  return movingMask.load(std::memory_order_acquire) == 0 && millis() - stoppedAt.load(std::memory_order_relaxed) >= RECORDER_IDLE_MS;
+}
+
+static bool write_step(bool erase){
+  /* Programs the oldest full RAM page if an erased page is waiting for it, or else erases the next sector if allowed. writeMutex must be
+  taken.
+    Arguments:
+      - bool erase: Erasing is allowed
+    Returns:
+      - bool: true if the flash was programmed or erased
+  */
+  uint32_t written = writtenPages.load(std::memory_order_relaxed);
+  bool full = written != closedPages.load(std::memory_order_acquire);
+  if(full && erasedPages > 0){
+    uint8_t *page = pages[written & (RECORDER_RAM_PAGES - 1)];
+    RecorderPageHeader *header = (RecorderPageHeader *)page;
+    header->sequence = sequence;
+    header->session = session;
+    header->crc = page_crc(page);
+    esp_err_t result = esp_partition_write(partition, (size_t)writePosition * RECORDER_PAGE_SIZE, page, RECORDER_PAGE_SIZE);
+    writtenPages.store(written + 1, std::memory_order_release);
+    portENTER_CRITICAL(&recorderLock);
+    if(result == ESP_OK) recorderStats.pages_written++;
+    else recorderStats.write_errors++;
+    portEXIT_CRITICAL(&recorderLock);
+    //A failed page is skipped, its sequence number stays unused
+    if(result == ESP_OK){
+      newestPosition = writePosition;
+      newestValid = true;
+    }
+    sequence++;
+    writePosition = (writePosition + 1) % pageCount;
+    erasedPages--;
+    waitCounted = false;
+    return true;
+  }
+  uint32_t eraseLimit = (RECORDER_ERASE_AHEAD < pageCount / PAGES_PER_SECTOR - 1 ? RECORDER_ERASE_AHEAD : pageCount / PAGES_PER_SECTOR - 1) *
+                        PAGES_PER_SECTOR;
+  if(!erase || erasedPages >= eraseLimit){
+    if(full && erasedPages == 0 && !waitCounted){
+      waitCounted = true;
+      portENTER_CRITICAL(&recorderLock);
+      recorderStats.erase_waits++;
+      portEXIT_CRITICAL(&recorderLock);
+    }
+    return false;
+  }
+  uint32_t position = (writePosition + erasedPages) % pageCount;
+  esp_err_t result = esp_partition_erase_range(partition, (size_t)position * RECORDER_PAGE_SIZE, RECORDER_SECTOR_SIZE);
+  portENTER_CRITICAL(&recorderLock);
+  if(result == ESP_OK) recorderStats.sectors_erased++;
+  else recorderStats.write_errors++;
+  portEXIT_CRITICAL(&recorderLock);
+  if(result != ESP_OK) return false;
+  if(newestValid && position <= newestPosition && newestPosition < position + PAGES_PER_SECTOR) newestValid = false;
+  erasedPages += PAGES_PER_SECTOR;
+  return true;
+}
+
+bool recorder_write(){
+  /* One step of the recorder task: programs a full page, or erases a sector while the chair is stationary. The native build calls it once
+  per RECORDER_WRITE_PERIOD_MS.
+    Arguments:
+      - void
+    Returns:
+      - bool: true if the flash was programmed or erased
+  */
+  if(!recording.load(std::memory_order_acquire)) return false;
+  xSemaphoreTake(writeMutex, portMAX_DELAY);
+  bool done = write_step(stationary());
+  xSemaphoreGive(writeMutex);
+  return done;
+}
+
+void recorder_flush(){
+  //Closes the open page, so the recorder task writes it with the next full page
+  portENTER_CRITICAL(&recorderLock);
+  if(pageUsed != 0){
+    closedPages.store(closedPages.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    pageUsed = 0;
+  }
+  portEXIT_CRITICAL(&recorderLock);
+}
+
+void recorder_sync(){
+  /* Writes every record taken so far to the flash, erasing sectors if needed whether the chair is stationary or not. Blocks for up to a
+  sector erase per page, for the export and the shutdown.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  if(!recording.load(std::memory_order_acquire)) return;
+  recorder_flush();
+  xSemaphoreTake(writeMutex, portMAX_DELAY);
+  while(writtenPages.load(std::memory_order_relaxed) != closedPages.load(std::memory_order_acquire) && write_step(true));
+  xSemaphoreGive(writeMutex);
+}
+
+#ifdef ESP_PLATFORM
+static TaskHandle_t recorderTaskHandle = NULL;
+
+static void recorder_task(void *parameters){
+  /* FreeRTOS task that writes the recorder's pages to the flash, see Recorder.h
+    Arguments:
+      - void *parameters: Unused
+    Returns:
+      - void
+  */
+  while(1){
+    recorder_write();
+    vTaskDelay(pdMS_TO_TICKS(RECORDER_WRITE_PERIOD_MS));
+  }
+}
+#endif
+
+static bool sector_erased(uint32_t position){
+  //Every byte of the sector starting at page position is 0xFF
+  for(uint32_t page = 0; page < PAGES_PER_SECTOR; page++){
+    if(esp_partition_read(partition, (size_t)(position + page) * RECORDER_PAGE_SIZE, flashPage, RECORDER_PAGE_SIZE) != ESP_OK) return false;
+    for(size_t i = 0; i < RECORDER_PAGE_SIZE; i++) if(flashPage[i] != 0xFF) return false;
+  }
+  return true;
+}
+
+bool recorder_begin(){
+  /* Finds the recorder's partition and the newest page in it, starts a new session at the next sector and starts the recorder task on the
+  control task's core. The sectors the previous session erased ahead are used as they are.
+    Arguments:
+      - void
+    Returns:
+      - bool: false if there is no partition labelled RECORDER_PARTITION or it is smaller than two sectors
+  */
+  if(recording.load(std::memory_order_acquire)) return true;
+  partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, RECORDER_PARTITION);
+  if(partition == NULL || partition->size < 2 * RECORDER_SECTOR_SIZE) return false;
+  if(writeMutex == NULL) writeMutex = xSemaphoreCreateMutex();
+  pageCount = partition->size / RECORDER_SECTOR_SIZE * PAGES_PER_SECTOR;
+
+  newestValid = false;
+  RecorderPageHeader newest = {};
+  for(uint32_t position = 0; position < pageCount; position++){
+    RecorderPageHeader header;
+    if(esp_partition_read(partition, (size_t)position * RECORDER_PAGE_SIZE, &header, sizeof(header)) != ESP_OK) continue;
+    if(header.sequence == ERASED_SEQUENCE || (newestValid && header.sequence <= newest.sequence)) continue;
+    newest = header;
+    newestPosition = position;
+    newestValid = true;
+  }
+  sequence = newestValid ? newest.sequence + 1 : 0;
+  session = newestValid ? newest.session + 1 : 0;
+  writePosition = newestValid ? (newestPosition / PAGES_PER_SECTOR + 1) % (pageCount / PAGES_PER_SECTOR) * PAGES_PER_SECTOR : 0;
+  erasedPages = 0;
+  while(erasedPages < RECORDER_ERASE_AHEAD * PAGES_PER_SECTOR && erasedPages + PAGES_PER_SECTOR < pageCount &&
+        sector_erased((writePosition + erasedPages) % pageCount)) erasedPages += PAGES_PER_SECTOR;
+
+  portENTER_CRITICAL(&recorderLock);
+  recorderStats = RecorderStats();
+  recorderStats.session = session;
+  pageUsed = 0;
+  writtenPages.store(closedPages.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  portEXIT_CRITICAL(&recorderLock);
+  memset(setpointValid, 0, sizeof(setpointValid));
+  movingMask.store(0, std::memory_order_relaxed);
+  stoppedAt.store(millis(), std::memory_order_relaxed);
+  recording.store(true, std::memory_order_release);
+#ifdef ESP_PLATFORM
+  if(recorderTaskHandle == NULL){
+    xTaskCreatePinnedToCore(recorder_task, "recorder", RECORDER_TASK_STACK, NULL, RECORDER_TASK_PRIORITY, &recorderTaskHandle,
+                            CONTROL_TASK_CORE);
+  }
+#endif
+  return true;
+}
+
+void recorder_end(){
+  /* Writes every record taken so far to the flash and stops recording, before the shutdown. recorder_begin() starts the next session.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  if(!recording.load(std::memory_order_acquire)) return;
+  recorder_sync();
+  recording.store(false, std::memory_order_release);
+  //Wait for a step of the recorder task that started before
+  xSemaphoreTake(writeMutex, portMAX_DELAY);
+  xSemaphoreGive(writeMutex);
+}
+
+static bool read_page(uint32_t position, uint32_t expected, uint16_t target){
+  /* Reads a page into flashPage if it still holds the expected page of the target session and its CRC matches
+    Arguments:
+      - uint32_t position: The page
+      - uint32_t expected: Its sequence number
+      - uint16_t target: Its session
+    Returns:
+      - bool: true if flashPage holds the page
+  */
+  xSemaphoreTake(writeMutex, portMAX_DELAY);
+  bool valid = esp_partition_read(partition, (size_t)position * RECORDER_PAGE_SIZE, flashPage, RECORDER_PAGE_SIZE) == ESP_OK;
+  xSemaphoreGive(writeMutex);
+  const RecorderPageHeader *header = (const RecorderPageHeader *)flashPage;
+  return valid && header->sequence == expected && header->session == target && header->crc == page_crc(flashPage);
+}
+
+static bool read_header(uint32_t position, RecorderPageHeader *header){
+  xSemaphoreTake(writeMutex, portMAX_DELAY);
+  bool valid = esp_partition_read(partition, (size_t)position * RECORDER_PAGE_SIZE, header, sizeof(RecorderPageHeader)) == ESP_OK;
+  xSemaphoreGive(writeMutex);
+  return valid && header->sequence != ERASED_SEQUENCE;
+}
+
+uint32_t recorder_export(uint32_t minutes, uint16_t sessions_back, RecorderOutput output, void *context){
+  /* Writes the records of the last minutes of a session in the flash as candump log lines. Records still in the RAM pages are not
+  exported, call recorder_sync() first. The recorder keeps running meanwhile: pages erased during the export are skipped.
+    Arguments:
+      - uint32_t minutes: Length of the exported time span, up to the session's last record
+      - uint16_t sessions_back: 0 for the current session, 1 for the previous one, ...
+      - RecorderOutput output: Called with each line, without the line end
+      - void *context: Passed to output
+    Returns:
+      - uint32_t: Number of exported records
+  */
+  if(!recording.load(std::memory_order_acquire) || sessions_back > session) return 0;
+  uint16_t target = session - sessions_back;
+  xSemaphoreTake(writeMutex, portMAX_DELAY);
+  bool found = newestValid;
+  uint32_t position = newestPosition;
+  xSemaphoreGive(writeMutex);
+  if(!found) return 0;
+
+  //Newest page of the target session: walk back over the newer sessions and the sectors skipped at their starts
+  RecorderPageHeader header;
+  uint32_t last = 0;
+  uint32_t steps = 0;
+  found = false;
+  for(; steps < pageCount; steps++, position = (position + pageCount - 1) % pageCount){
+    if(!read_header(position, &header)) continue;
+    if(found && header.sequence >= last) break;      // Wrapped around to newer pages
+    found = true;
+    last = header.sequence;
+    if(header.session == target) break;
+    if(header.session < target) return 0;
+  }
+  if(steps == pageCount || header.session != target) return 0;
+
+  //Time of the session's last record, the exported span ends there
+  uint64_t end = header.time;
+  uint32_t newest = position;
+  uint32_t newestSequence = header.sequence;
+  if(read_page(newest, newestSequence, target)){
+    RecorderRecord record;
+    size_t offset = sizeof(RecorderPageHeader);
+    size_t length;
+    end = header.time;
+    while((length = recorder_decode(&flashPage[offset], RECORDER_PAGE_SIZE - offset, end, &record)) != 0){
+      offset += length;
+      end = record.time;
+    }
+  }
+  uint64_t span = (uint64_t)minutes * 60000000ULL;
+  uint64_t cutoff = end > span ? end - span : 0;
+
+  //Oldest page of the span: the session's pages are consecutive
+  uint32_t count = 1;
+  while(count < pageCount && header.time > cutoff){
+    uint32_t previous = (position + pageCount - 1) % pageCount;
+    RecorderPageHeader older;
+    if(!read_header(previous, &older) || older.session != target || older.sequence != header.sequence - 1) break;
+    position = previous;
+    header = older;
+    count++;
+  }
+
+  uint32_t exported = 0;
+  for(uint32_t i = 0; i < count; i++){
+    if(!read_page((position + i) % pageCount, newestSequence - (count - 1 - i), target)) continue;
+    uint64_t time = ((const RecorderPageHeader *)flashPage)->time;
+    size_t offset = sizeof(RecorderPageHeader);
+    size_t length;
+    RecorderRecord record;
+    char line[RECORDER_LINE_LENGTH];
+    while((length = recorder_decode(&flashPage[offset], RECORDER_PAGE_SIZE - offset, time, &record)) != 0){
+      offset += length;
+      time = record.time;
+      if(record.time < cutoff) continue;
+      candump_format(&record, line, sizeof(line));
+      output(line, context);
+      exported++;
+    }
+  }
+  return exported;
+}
+
+RecorderStats get_recorder_stats(){
+  RecorderStats stats;
+  portENTER_CRITICAL(&recorderLock);
+  stats = recorderStats;
+  portEXIT_CRITICAL(&recorderLock);
+  if(writeMutex != NULL){
+    xSemaphoreTake(writeMutex, portMAX_DELAY);
+    stats.history_pages = pageCount - erasedPages;
+    xSemaphoreGive(writeMutex);
+  }
+  return stats;
+}
+
+void print_recorder_stats(){
+  /* Prints the recorder's counters on the serial port
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  if(!recording.load(std::memory_order_acquire)){
+    Serial.println("Recorder: not running");
+    return;
+  }
+  RecorderStats stats = get_recorder_stats();
+  Serial.printf("Recorder session %u: %u records, %llu bytes, %u dropped | %u pages written, %u sectors erased, %u erase waits, %u errors | "
+                "%u KB of history\n", stats.session, stats.records, (unsigned long long)stats.record_bytes, stats.dropped, stats.pages_written,
+                stats.sectors_erased, stats.erase_waits, stats.write_errors, stats.history_pages * RECORDER_PAGE_SIZE / 1024);
+}
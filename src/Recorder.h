@@ -0,0 +1,89 @@
+#ifndef RECORDER_H
+#define RECORDER_H
+
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "config.h"
+
+/*Black box recorder: every received and transmitted TWAI frame and every change of a VESC setpoint computed by main_loop() goes to a ring
+in the flash, so the last minutes before an incident can be read out afterwards, also after a reboot. The ring is the data partition
+labelled RECORDER_PARTITION, the "spiffs" partition of the default partition table that the firmware does not use otherwise. It is
+written as raw flash pages instead of through a file system: the pages go around the partition in order, so every sector is erased once
+per lap and the wear is level, and nothing but the page headers is written besides the records.
+
+The producers encode their records into RAM pages of RECORDER_PAGE_SIZE, one flash page, in a short critical section and never touch the
+flash. The recorder task programs the full pages, one per RECORDER_WRITE_PERIOD_MS, from the control task's core at the lowest priority.
+While the flash is busy the ESP32 runs nothing but IRAM code on either core, so a flash operation delays the control task: programming a
+page takes about 1 ms, erasing a 4 KB sector about 45 ms. Sectors are therefore only erased while the chair is stationary, every setpoint
+has been 0 for RECORDER_IDLE_MS, up to RECORDER_ERASE_AHEAD sectors ahead of the write position. A drive longer than the erased sectors
+last keeps its latest records in the RAM pages and drops the newer ones (counted) until the chair stops. The erased sectors are lost to the
+history, the rest of the partition holds it.
+
+A page starts with a RecorderPageHeader. Its records follow back to back until the first 0xFF byte, the erased flash after the last one:
+  - flags byte: bit 7 extended, bit 6 RTR, bits 4-5 RECORDER_TYPE, bits 0-3 DLC
+  - time since the previous record of the page (the page's time for the first one) in us, as an unsigned LEB128 varint
+  - identifier, as a varint too: 2 bytes for the VESCs' extended identifiers, whose upper bits are 0
+  - the data
+The export writes the records of the last minutes of a session in the candump log format of can-utils, "(seconds.us) can0 ID#DATA", with
+the time since the session's boot. Setpoints are the frames submitted to the TX mailboxes, on the interface "setpoint".*/
+#define RECORDER_PARTITION "spiffs"
+#define RECORDER_PAGE_SIZE 256        // A flash page, the unit of programming
+#define RECORDER_SECTOR_SIZE 4096     // The unit of erasing
+#define RECORDER_RAM_PAGES 16         // Pages between the producers and the recorder task, must be a power of 2
+#define RECORDER_WRITE_PERIOD_MS 10
+#define RECORDER_IDLE_MS 2000
+#define RECORDER_ERASE_AHEAD 128      // Sectors, 512 KB: a minute of driving
+#define RECORDER_EXPORT_MINUTES 2
+#define RECORDER_TASK_PRIORITY 1
+#define RECORDER_TASK_STACK 4096
+#define RECORDER_RECORD_MAX 24        // Flags, 64 bit time, 29 bit identifier and 8 data bytes
+#define RECORDER_LINE_LENGTH 64       // Longest candump line and its terminator
+
+enum RECORDER_TYPE{
+  RECORDER_RX = 1,
+  RECORDER_TX = 2,
+  RECORDER_SETPOINT = 3
+};
+
+struct RecorderPageHeader{
+  uint32_t sequence;        // Pages written before this one since the partition was first used, 0xFFFFFFFF while erased
+  uint16_t session;         // Starts of the recorder before this one
+  uint16_t crc;             // CRC-16/CCITT of the page without this field
+  uint64_t time;            // esp_timer time of the first record, us since the session's boot
+};
+
+struct RecorderRecord{
+  uint8_t type;             // RECORDER_TYPE
+  uint64_t time;            // esp_timer time, us since boot
+  twai_message_t frame;
+};
+
+struct RecorderStats{
+  uint16_t session;
+  uint32_t records;         // Records put in a page
+  uint32_t dropped;         // Records lost because every RAM page was full
+  uint64_t record_bytes;    // Encoded size of the records
+  uint32_t pages_written;
+  uint32_t sectors_erased;
+  uint32_t erase_waits;     // Full pages that waited for an erased sector while the chair was moving
+  uint32_t write_errors;
+  uint32_t history_pages;   // Pages the partition holds besides the erased ones
+};
+
+typedef void (*RecorderOutput)(const char *line, void *context);
+
+bool recorder_begin();
+void recorder_end();
+void recorder_frame(uint8_t type, const twai_message_t *frame);
+void recorder_setpoint(const twai_message_t *frame);
+bool recorder_write();
+void recorder_flush();
+void recorder_sync();
+uint32_t recorder_export(uint32_t minutes, uint16_t sessions_back, RecorderOutput output, void *context);
+size_t recorder_encode(const RecorderRecord *record, uint64_t previous, uint8_t *buffer);
+size_t recorder_decode(const uint8_t *data, size_t size, uint64_t previous, RecorderRecord *record);
+int candump_format(const RecorderRecord *record, char *line, size_t size);
+RecorderStats get_recorder_stats();
+void print_recorder_stats();
+
+#endif
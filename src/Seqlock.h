@@ -0,0 +1,62 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <stdint.h>
+#include <atomic>
+
+#define SEQLOCK_READ_ATTEMPTS 4
+
+//Single writer, multiple reader sequence lock. The writer never blocks, readers retry until they copied a version of the value that was not
+//modified while they read it, so they never see a torn value. Used to share state between the control, TWAI and UI tasks.
+//read() spins until the write in progress is over, so it is only for readers on the writer's other core or at a lower priority than the
+//writer. A reader that preempts the writer on its core would spin forever, it uses try_read() and keeps its last copy when that fails.
+template <typename T>
+class Seqlock{
+  private:
+  std::atomic<uint32_t> sequence;
+  T value;
+
+  public:
+  Seqlock() : sequence(0), value() {}
+
+  void write(const T &new_value){
+    uint32_t seq = this->sequence.load(std::memory_order_relaxed);
+    this->sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    this->value = new_value;
+    this->sequence.store(seq + 2, std::memory_order_release);
+  }
+
+  T read() const{
+    T copy;
+    uint32_t before, after;
+    do{
+      before = this->sequence.load(std::memory_order_acquire);
+      copy = this->value;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      after = this->sequence.load(std::memory_order_relaxed);
+    }while((before & 1) || before != after);
+    return copy;
+  }
+
+  //Bounded read, never waits for the writer. Returns false and leaves value unchanged if SEQLOCK_READ_ATTEMPTS copies were torn.
+  bool try_read(T &value) const{
+    for(uint32_t attempt = 0; attempt < SEQLOCK_READ_ATTEMPTS; attempt++){
+      uint32_t before = this->sequence.load(std::memory_order_acquire);
+      if(before & 1) continue;
+      T copy = this->value;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if(this->sequence.load(std::memory_order_relaxed) != before) continue;
+      value = copy;
+      return true;
+    }
+    return false;
+  }
+
+  //Number of completed writes, can be used to detect whether the value changed since the last read
+  uint32_t version() const{
+    return this->sequence.load(std::memory_order_acquire) >> 1;
+  }
+};
+
+#endif
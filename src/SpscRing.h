@@ -0,0 +1,42 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <stdint.h>
+#include <atomic>
+
+//Single producer, single consumer ring of N items (N must be a power of 2). Neither side ever blocks or takes a lock, so the producer can be
+//an interrupt handler: push() fails when the ring is full and pop() when it is empty.
+template <typename T, uint32_t N>
+class SpscRing{
+  static_assert(N > 0 && (N & (N - 1)) == 0, "The ring size must be a power of 2");
+
+  private:
+  std::atomic<uint32_t> head;   // Written by the producer
+  std::atomic<uint32_t> tail;   // Written by the consumer
+  T items[N];
+
+  public:
+  SpscRing() : head(0), tail(0), items() {}
+
+  bool push(const T &item){
+    uint32_t position = this->head.load(std::memory_order_relaxed);
+    if(position - this->tail.load(std::memory_order_acquire) == N) return false;
+    this->items[position % N] = item;
+    this->head.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &item){
+    uint32_t position = this->tail.load(std::memory_order_relaxed);
+    if(this->head.load(std::memory_order_acquire) == position) return false;
+    item = this->items[position % N];
+    this->tail.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  uint32_t size() const{
+    return this->head.load(std::memory_order_acquire) - this->tail.load(std::memory_order_acquire);
+  }
+};
+
+#endif
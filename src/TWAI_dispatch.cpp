@@ -0,0 +1,109 @@
+#include "TWAI_dispatch.h"
+
+#define DISPATCH_EXTD_KEY 0x80000000u
+
+FrameDispatcher::FrameDispatcher() : count(0), maxProbes(0), unknown(0), lastUnknown(0) {
+  memset(this->slots, 0, sizeof(this->slots));
+}
+
+uint32_t FrameDispatcher::key(uint32_t identifier, bool extd){
+  return extd ? (identifier & TWAI_EXTD_ID_MASK) | DISPATCH_EXTD_KEY : identifier & TWAI_STD_ID_MASK;
+}
+
+uint8_t FrameDispatcher::slot(uint32_t key){
+  //Multiplicative hash, the high bits of the product depend on all bits of the key
+  return (uint32_t)(key * 2654435761u) >> (32 - DISPATCH_TABLE_BITS);
+}
+
+bool FrameDispatcher::add(uint32_t identifier, bool extd, FrameDecoder decoder, void *context, const char *name){
+  /* Registers the decoder of an identifier. Must not be called while frames are dispatched.
+    Arguments:
+      - uint32_t identifier: The frame's identifier
+      - bool extd: true for an extended identifier
+      - FrameDecoder decoder: Called with the frame and the context for every frame with this identifier
+      - void *context: Passed to the decoder
+      - const char *name: Name in the statistics
+    Returns:
+      - bool: false if the identifier already has a decoder or the table is full
+  */
+  if(this->count >= DISPATCH_MAX_HANDLERS) return false;
+  uint32_t handlerKey = key(identifier, extd);
+  uint8_t index = slot(handlerKey);
+  uint8_t probes = 1;
+  while(this->slots[index] != 0){
+    if(this->handlers[this->slots[index] - 1].key == handlerKey) return false;
+    index = (index + 1) & (DISPATCH_TABLE_SIZE - 1);
+    probes++;
+  }
+  DispatchHandler &handler = this->handlers[this->count];
+  handler.key = handlerKey;
+  handler.decoder = decoder;
+  handler.context = context;
+  handler.name = name;
+  handler.hits.store(0, std::memory_order_relaxed);
+  this->slots[index] = ++this->count;
+  if(probes > this->maxProbes) this->maxProbes = probes;
+  return true;
+}
+
+bool FrameDispatcher::add_vesc(uint8_t node, uint8_t command, FrameDecoder decoder, void *context, const char *name){
+  return this->add(vesc_frame_id(node, command), true, decoder, context, name);
+}
+
+bool FrameDispatcher::dispatch(const twai_message_t *message){
+  /* Calls the decoder of a received frame
+    Arguments:
+      - const twai_message_t *message: The received frame
+    Returns:
+      - bool: false if no decoder is registered for the frame's identifier
+  */
+  uint32_t frameKey = key(message->identifier, message->extd);
+  uint8_t index = slot(frameKey);
+  //No registered identifier is further than maxProbes slots from its hash, so the search stops there at the latest
+  for(uint8_t probe = 0; probe < this->maxProbes; probe++){
+    uint8_t handlerIndex = this->slots[index];
+    if(handlerIndex == 0) break;
+    DispatchHandler &handler = this->handlers[handlerIndex - 1];
+    if(handler.key == frameKey){
+      handler.hits.store(handler.hits.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      handler.decoder(message, handler.context);
+      return true;
+    }
+    index = (index + 1) & (DISPATCH_TABLE_SIZE - 1);
+  }
+  this->unknown.store(this->unknown.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  this->lastUnknown.store(message->identifier, std::memory_order_relaxed);
+  return false;
+}
+
+uint8_t FrameDispatcher::handler_count() const{
+  return this->count;
+}
+
+uint8_t FrameDispatcher::max_probes() const{
+  return this->maxProbes;
+}
+
+uint32_t FrameDispatcher::hits(uint8_t handler) const{
+  return handler < this->count ? this->handlers[handler].hits.load(std::memory_order_relaxed) : 0;
+}
+
+uint32_t FrameDispatcher::unknown_count() const{
+  return this->unknown.load(std::memory_order_relaxed);
+}
+
+void FrameDispatcher::print_stats() const{
+  /* This function prints the decoded frame counts in the Serial Monitor
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  Serial.printf("Dispatch: %u decoders, at most %u probes, %u frames without decoder (last ID %x)\n", this->count, this->maxProbes,
+                this->unknown_count(), this->lastUnknown.load(std::memory_order_relaxed));
+  for(uint8_t i = 0; i < this->count; i++){
+    const DispatchHandler &handler = this->handlers[i];
+    Serial.printf("  %s (%s ID %x): %u frames\n", handler.name, handler.key & DISPATCH_EXTD_KEY ? "extended" : "standard",
+                  handler.key & ~DISPATCH_EXTD_KEY, this->hits(i));
+  }
+}
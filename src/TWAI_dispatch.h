@@ -0,0 +1,55 @@
+#ifndef TWAI_DISPATCH_H
+#define TWAI_DISPATCH_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "driver/twai.h"
+
+/*Received frame dispatcher. Decoders are registered at startup for a standard or extended identifier, VESC frames by node and command. The
+identifiers are hashed into an open addressing table, so finding a frame's decoder takes the same few comparisons however many decoders
+there are: at most the longest probe sequence, which is known once the table is built. Frames without a decoder are counted.*/
+#define DISPATCH_MAX_HANDLERS 48
+#define DISPATCH_TABLE_BITS 7         // 128 slots, over twice DISPATCH_MAX_HANDLERS keeps the probe sequences short
+#define DISPATCH_TABLE_SIZE (1 << DISPATCH_TABLE_BITS)
+
+typedef void (*FrameDecoder)(const twai_message_t *message, void *context);
+
+//VESC frames: the command in bits 15 to 8 of the extended identifier, the node in bits 7 to 0
+static inline uint32_t vesc_frame_id(uint8_t node, uint8_t command){
+  return (uint32_t)command << 8 | node;
+}
+
+struct DispatchHandler{
+  uint32_t key;                   // Identifier, bit 31 set for extended identifiers
+  FrameDecoder decoder;
+  void *context;                  // Passed to the decoder
+  const char *name;
+  std::atomic<uint32_t> hits;
+};
+
+//Handlers are added before the first frame is dispatched. dispatch() is called by one task, the counters can be read by any task.
+class FrameDispatcher{
+  private:
+  DispatchHandler handlers[DISPATCH_MAX_HANDLERS];
+  uint8_t slots[DISPATCH_TABLE_SIZE];       // Index of the handler + 1, 0 for an empty slot
+  uint8_t count;
+  uint8_t maxProbes;                        // Longest probe sequence of a registered identifier
+  std::atomic<uint32_t> unknown;
+  std::atomic<uint32_t> lastUnknown;
+
+  static uint32_t key(uint32_t identifier, bool extd);
+  static uint8_t slot(uint32_t key);
+
+  public:
+  FrameDispatcher();
+  bool add(uint32_t identifier, bool extd, FrameDecoder decoder, void *context, const char *name);
+  bool add_vesc(uint8_t node, uint8_t command, FrameDecoder decoder, void *context, const char *name);
+  bool dispatch(const twai_message_t *message);
+  uint8_t handler_count() const;
+  uint8_t max_probes() const;
+  uint32_t hits(uint8_t handler) const;
+  uint32_t unknown_count() const;
+  void print_stats() const;
+};
+
+#endif
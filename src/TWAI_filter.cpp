@@ -0,0 +1,235 @@
+#include "TWAI_filter.h"
+
+#define STD_ID_BITS 11
+#define EXT_ID_BITS 29
+
+//Bits of a filter, only the bits set in care are compared
+struct Pattern{
+  uint32_t value;
+  uint32_t care;
+};
+
+static Pattern frame_pattern(const TwaiFilterId *id, bool dual){
+  /* Places a data frame's identifier and RTR bit (0) where a single filter (32 bits) or one of the dual filters (16 bits) compares them
+    Arguments:
+      - const TwaiFilterId *id: The identifier
+      - bool dual: true for a dual filter
+    Returns:
+      - Pattern: The bits the filter must match to accept the frame
+  */
+  Pattern pattern;
+  if(!dual && !id->extd){
+    pattern.value = (id->identifier & TWAI_STD_ID_MASK) << 21;
+    pattern.care = 0xFFF00000;
+  }
+  else if(!dual){
+    pattern.value = (id->identifier & TWAI_EXTD_ID_MASK) << 3;
+    pattern.care = 0xFFFFFFFC;
+  }
+  else if(!id->extd){
+    pattern.value = (id->identifier & TWAI_STD_ID_MASK) << 5;
+    pattern.care = 0xFFF0;
+  }
+  else{
+    pattern.value = (id->identifier & TWAI_EXTD_ID_MASK) >> 13;
+    pattern.care = 0xFFFF;
+  }
+  return pattern;
+}
+
+static void cover(Pattern *filter, const Pattern *frame, bool *empty){
+  /* Widens a filter so it also accepts a frame: the bits where they differ are no longer compared
+    Arguments:
+      - Pattern *filter: The filter
+      - const Pattern *frame: The frame's pattern
+      - bool *empty: true if the filter accepts nothing yet, it then becomes the frame's pattern
+    Returns:
+      - void
+  */
+  if(*empty){
+    *filter = *frame;
+    *empty = false;
+    return;
+  }
+  filter->care &= frame->care & ~(filter->value ^ frame->value);
+  filter->value &= filter->care;
+}
+
+static uint32_t count_cube(uint32_t care, uint8_t bits){
+  //Number of identifiers of the given width matching a pattern
+  return 1UL << (bits - __builtin_popcount(care));
+}
+
+static bool id_cube(const twai_filter_config_t *config, bool extd, uint8_t filter, uint32_t *value, uint32_t *care){
+  /* Gets the identifiers of one format that one filter accepts in data frames, as the identifier bits it compares
+    Arguments:
+      - const twai_filter_config_t *config: The filter configuration
+      - bool extd: true for extended identifiers
+      - uint8_t filter: 0 for the single filter or the first dual filter, 1 for the second dual filter
+      - uint32_t *value, *care: The compared identifier bits and their values
+    Returns:
+      - bool: false if the filter accepts no data frame of the format
+  */
+  uint32_t code = config->acceptance_code;
+  uint32_t compared = ~config->acceptance_mask;
+  uint8_t rtrBit;
+  if(config->single_filter){
+    rtrBit = extd ? 2 : 20;
+    *value = extd ? code >> 3 : code >> 21;
+    *care = extd ? compared >> 3 : compared >> 21;
+  }
+  else{
+    uint8_t shift = filter == 0 ? 16 : 0;
+    code = (code >> shift) & 0xFFFF;
+    compared = (compared >> shift) & 0xFFFF;
+    rtrBit = 4;
+    //Extended frames: the 16 bits are identifier bits 28 to 13, there is no RTR bit
+    *value = extd ? code << 13 : code >> 5;
+    *care = extd ? compared << 13 : compared >> 5;
+    if(extd) return true;
+  }
+  *care &= extd ? TWAI_EXTD_ID_MASK : TWAI_STD_ID_MASK;
+  *value &= *care;
+  return !((compared >> rtrBit) & 1) || !((code >> rtrBit) & 1);
+}
+
+uint32_t twai_filter_count(const twai_filter_config_t *config, bool extd){
+  /* Counts the identifiers of one format whose data frames pass the filter. Frames that only pass with some data bytes are counted.
+    Arguments:
+      - const twai_filter_config_t *config: The filter configuration
+      - bool extd: true for extended identifiers
+    Returns:
+      - uint32_t: Number of accepted identifiers
+  */
+  uint8_t bits = extd ? EXT_ID_BITS : STD_ID_BITS;
+  uint32_t value[2], care[2];
+  bool accepts[2];
+  uint8_t filters = config->single_filter ? 1 : 2;
+  for(uint8_t i = 0; i < filters; i++) accepts[i] = id_cube(config, extd, i, &value[i], &care[i]);
+  if(filters == 1) return accepts[0] ? count_cube(care[0], bits) : 0;
+
+  uint32_t count = 0;
+  for(uint8_t i = 0; i < 2; i++) if(accepts[i]) count += count_cube(care[i], bits);
+  //Identifiers accepted by both filters are counted once
+  if(accepts[0] && accepts[1] && ((value[0] ^ value[1]) & care[0] & care[1]) == 0) count -= count_cube(care[0] | care[1], bits);
+  return count;
+}
+
+static twai_filter_config_t single_filter(const TwaiFilterId *ids, uint8_t count){
+  Pattern filter = {0, 0};
+  bool empty = true;
+  for(uint8_t i = 0; i < count; i++){
+    Pattern frame = frame_pattern(&ids[i], false);
+    cover(&filter, &frame, &empty);
+  }
+  twai_filter_config_t config;
+  config.acceptance_code = filter.value;
+  config.acceptance_mask = ~filter.care;
+  config.single_filter = true;
+  return config;
+}
+
+//Identifier as the dual filters see it. Extended identifiers that only differ in bits 12 to 0 look the same.
+struct DualPattern{
+  Pattern pattern;
+  bool extd;
+};
+
+static twai_filter_config_t dual_filter(const DualPattern *patterns, uint8_t count, uint32_t split){
+  /* Builds a dual filter configuration
+    Arguments:
+      - const DualPattern *patterns: The wanted identifiers as the dual filters see them
+      - uint8_t count: Number of patterns
+      - uint32_t split: Bit i - 1 set puts pattern i in the second filter, the first pattern is always in the first filter
+    Returns:
+      - twai_filter_config_t: The filter configuration
+  */
+  Pattern filters[2] = {{0, 0}, {0, 0}};
+  bool empty[2] = {true, true};
+  bool firstHasStd = false;
+  for(uint8_t i = 0; i < count; i++){
+    uint8_t filter = i > 0 && (split >> (i - 1)) & 1;
+    cover(&filters[filter], &patterns[i].pattern, &empty[filter]);
+    if(filter == 0 && !patterns[i].extd) firstHasStd = true;
+  }
+  //An unused second filter repeats the first one
+  if(empty[1]) filters[1] = filters[0];
+  //The 4 lowest bits are the second filter's identifier bits 16 to 13 in extended frames, but also the low half of the first data byte
+  //compared by the first filter in standard frames
+  if(firstHasStd) filters[1].care &= ~0xFUL;
+
+  twai_filter_config_t config;
+  config.acceptance_code = filters[0].value << 16 | (filters[1].value & filters[1].care);
+  config.acceptance_mask = ~(filters[0].care << 16 | filters[1].care);
+  config.single_filter = false;
+  return config;
+}
+
+static uint32_t leaks(const twai_filter_config_t *config, uint8_t wantedStd, uint8_t wantedExt){
+  return twai_filter_count(config, false) - wantedStd + twai_filter_count(config, true) - wantedExt;
+}
+
+bool twai_filter_build(const TwaiFilterId *ids, uint8_t count, twai_filter_config_t *config, TwaiFilterReport *report){
+  /* Builds the acceptance filter that accepts the given identifiers and the fewest others
+    Arguments:
+      - const TwaiFilterId *ids: The wanted identifiers, without duplicates
+      - uint8_t count: Number of identifiers, 1 to TWAI_FILTER_MAX_IDS. The dual filters are only tried for up to TWAI_FILTER_MAX_PATTERNS
+        identifiers that they can tell apart.
+      - twai_filter_config_t *config: Filled with the filter configuration
+      - TwaiFilterReport *report: Filled with the unwanted identifiers the filter accepts, may be NULL
+    Returns:
+      - bool: false if the number of identifiers is not supported
+  */
+  if(count == 0 || count > TWAI_FILTER_MAX_IDS) return false;
+  uint8_t wantedExt = 0;
+  for(uint8_t i = 0; i < count; i++) if(ids[i].extd) wantedExt++;
+  uint8_t wantedStd = count - wantedExt;
+
+  //Distinct patterns of the dual filters. With too many of them only the single filter is tried.
+  DualPattern patterns[TWAI_FILTER_MAX_PATTERNS];
+  uint8_t patternCount = 0;
+  for(uint8_t i = 0; i < count && patternCount <= TWAI_FILTER_MAX_PATTERNS; i++){
+    DualPattern pattern = {frame_pattern(&ids[i], true), ids[i].extd};
+    bool seen = false;
+    for(uint8_t j = 0; j < patternCount && !seen; j++){
+      seen = patterns[j].extd == pattern.extd && patterns[j].pattern.value == pattern.pattern.value;
+    }
+    if(seen) continue;
+    if(patternCount < TWAI_FILTER_MAX_PATTERNS) patterns[patternCount] = pattern;
+    patternCount++;
+  }
+  if(patternCount > TWAI_FILTER_MAX_PATTERNS) patternCount = 0;
+
+  twai_filter_config_t best = single_filter(ids, count);
+  uint32_t bestLeaks = leaks(&best, wantedStd, wantedExt);
+  for(uint32_t split = 0; patternCount > 0 && split < 1UL << (patternCount - 1) && bestLeaks > 0; split++){
+    twai_filter_config_t candidate = dual_filter(patterns, patternCount, split);
+    uint32_t candidateLeaks = leaks(&candidate, wantedStd, wantedExt);
+    if(candidateLeaks < bestLeaks){
+      best = candidate;
+      bestLeaks = candidateLeaks;
+    }
+  }
+
+  *config = best;
+  if(report != NULL){
+    report->wanted = count;
+    report->single_filter = best.single_filter;
+    report->leaked_std = twai_filter_count(&best, false) - wantedStd;
+    report->leaked_ext = twai_filter_count(&best, true) - wantedExt;
+  }
+  return true;
+}
+
+void print_filter_report(const twai_filter_config_t *config, const TwaiFilterReport *report){
+  /* This function prints the acceptance filter configuration in the Serial Monitor
+    Arguments:
+      - const twai_filter_config_t *config: The filter configuration
+      - const TwaiFilterReport *report: The report of twai_filter_build()
+    Returns:
+      - void
+  */
+  Serial.printf("TWAI filter: %s, code %08x, mask %08x. %u identifiers wanted, %u other standard and %u other extended identifiers pass\n",
+                report->single_filter ? "single" : "dual", config->acceptance_code, config->acceptance_mask, report->wanted,
+                report->leaked_std, report->leaked_ext);
+}
@@ -0,0 +1,34 @@
+#ifndef TWAI_FILTER_H
+#define TWAI_FILTER_H
+
+#include <Arduino.h>
+#include "driver/twai.h"
+
+/*Acceptance filter builder. The TWAI controller compares the first bits of every frame with the acceptance code, the bits set in the
+acceptance mask are not compared. In single filter mode the 32 bit code is compared with the identifier and RTR bit of the frame (and the
+first two data bytes of a standard frame). In dual filter mode a frame is accepted if it matches either of two 16 bit filters, which see the
+whole identifier and the RTR bit of a standard frame but only the 16 most significant bits of an extended identifier. The controller does not
+compare the frame format: a filter built for standard identifiers also accepts some extended identifiers, and the other way around.
+
+twai_filter_build() tries the single filter and every split of the wanted identifiers over the two dual filters and keeps the configuration
+that accepts the fewest unwanted identifiers of both formats. Data bytes are never compared.*/
+#define TWAI_FILTER_MAX_IDS 64
+#define TWAI_FILTER_MAX_PATTERNS 12   // Identifiers the dual filters can tell apart, the search tries 2^(n-1) splits
+
+struct TwaiFilterId{
+  uint32_t identifier;
+  bool extd;
+};
+
+struct TwaiFilterReport{
+  uint8_t wanted;
+  bool single_filter;
+  uint32_t leaked_std;      // Unwanted standard identifiers the filter accepts
+  uint32_t leaked_ext;      // Unwanted extended identifiers the filter accepts
+};
+
+bool twai_filter_build(const TwaiFilterId *ids, uint8_t count, twai_filter_config_t *config, TwaiFilterReport *report);
+uint32_t twai_filter_count(const twai_filter_config_t *config, bool extd);
+void print_filter_report(const twai_filter_config_t *config, const TwaiFilterReport *report);
+
+#endif
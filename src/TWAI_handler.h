@@ -1,36 +1,85 @@
-#ifndef TWAI_HANDLER_H
-#define TWAI_HANDLER_H
-
-#include <Arduino.h>
-#include "driver/twai.h"
-#include "config.h"
-
-extern twai_general_config_t g_config;
-extern twai_timing_config_t t_config;
-extern twai_filter_config_t f_config;
-//Enumerator for TWAI communication
-enum COMMAND_ID{
-  CAN_PACKET_SET_DUTY = 0,
-  CAN_PACKET_SET_CURRENT = 1,
-  CAN_PACKET_SET_CURRENT_BRAKE = 2,
-  CAN_PACKET_SET_RPM = 3,
-  CAN_PACKET_SET_POS = 4,
-  CAN_PACKET_SET_CURRENT_REL = 10,
-  CAN_PACKET_SET_CURRENT_BRAKE_REL = 11,
-  CAN_PACKET_SET_CURRENT_HANDBRAKE = 12,
-  CAN_PACKET_SET_CURRENT_HANDBRAKE_REL = 13
-};
-
-enum ACTUATOR_ACTION{
-  ACTUATOR_EXTEND,
-  ACTUATOR_RETRACT,
-  ACTUATOR_STOP
-};
-
-uint32_t get_scaling(enum COMMAND_ID id);
-twai_message_t createVESCMessage(uint8_t vescId, enum COMMAND_ID cmdId, float val);
-twai_message_t createActuatorsMessage(uint8_t actId, bool isBackrest, ACTUATOR_ACTION action);
-void print_twai_status();
-String print_vesc_message(twai_message_t *receivedMessage);
-
+#ifndef TWAI_HANDLER_H
+#define TWAI_HANDLER_H
+
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "config.h"
+
+extern twai_general_config_t g_config;
+extern twai_timing_config_t t_config;
+extern twai_filter_config_t f_config;
+//Enumerator for TWAI communication
+enum COMMAND_ID{
+  CAN_PACKET_SET_DUTY = 0,
+  CAN_PACKET_SET_CURRENT = 1,
+  CAN_PACKET_SET_CURRENT_BRAKE = 2,
+  CAN_PACKET_SET_RPM = 3,
+  CAN_PACKET_SET_POS = 4,
+  CAN_PACKET_STATUS = 9,
+  CAN_PACKET_SET_CURRENT_REL = 10,
+  CAN_PACKET_SET_CURRENT_BRAKE_REL = 11,
+  CAN_PACKET_SET_CURRENT_HANDBRAKE = 12,
+  CAN_PACKET_SET_CURRENT_HANDBRAKE_REL = 13,
+  CAN_PACKET_STATUS_2 = 14,
+  CAN_PACKET_STATUS_3 = 15,
+  CAN_PACKET_STATUS_4 = 16,
+  CAN_PACKET_STATUS_5 = 27,
+  CAN_PACKET_STATUS_6 = 58
+};
+
+enum ACTUATOR_ACTION{
+  ACTUATOR_EXTEND,
+  ACTUATOR_RETRACT,
+  ACTUATOR_STOP
+};
+
+//Scaling of a command's value on the bus, see get_scaling(). 0 for commands without a value.
+constexpr uint32_t vesc_scaling(COMMAND_ID id){
+  return (id == CAN_PACKET_SET_DUTY || id == CAN_PACKET_SET_CURRENT_REL || id == CAN_PACKET_SET_CURRENT_BRAKE_REL ||
+          id == CAN_PACKET_SET_CURRENT_HANDBRAKE_REL) ? 100000 :
+         (id == CAN_PACKET_SET_CURRENT || id == CAN_PACKET_SET_CURRENT_BRAKE || id == CAN_PACKET_SET_CURRENT_HANDBRAKE) ? 1000 :
+         id == CAN_PACKET_SET_POS ? 1000000 :
+         id == CAN_PACKET_SET_RPM ? 1 : 0;
+}
+
+/*VESC frame encoder specialized at compile time. The node and the command are template parameters, so the identifier and the scaling are
+constants and the frame is written with a few stores, every field of it included. encode_vesc_raw() takes the value in the command's bus
+units, encode_vesc_fixed() in fixed point with InputScale units per unit (e.g. mA for a current with InputScale 1000), encode_vesc() as a
+float like createVESCMessage().*/
+template <uint8_t Node, COMMAND_ID Command>
+inline void encode_vesc_raw(twai_message_t *message, int32_t raw){
+  static_assert(Node < 255, "VESC node 255 is the broadcast address");
+  static_assert((uint32_t)Command <= 0xFF, "The command must fit in bits 15 to 8 of the identifier");
+  static_assert(((uint32_t)Command << 8 | Node) <= TWAI_EXTD_ID_MASK, "The identifier must fit in 29 bits");
+  static_assert(vesc_scaling(Command) != 0, "The command has no value");
+  message->flags = TWAI_MSG_FLAG_EXTD;
+  message->identifier = (uint32_t)Command << 8 | Node;
+  message->data_length_code = 4;
+  message->data[0] = (uint32_t)raw >> 24;
+  message->data[1] = (uint32_t)raw >> 16;
+  message->data[2] = (uint32_t)raw >> 8;
+  message->data[3] = raw;
+  message->data[4] = 0;
+  message->data[5] = 0;
+  message->data[6] = 0;
+  message->data[7] = 0;
+}
+
+template <uint8_t Node, COMMAND_ID Command, uint32_t InputScale = 1>
+inline void encode_vesc_fixed(twai_message_t *message, int32_t value){
+  static_assert(InputScale > 0 && vesc_scaling(Command) % InputScale == 0, "The command's scaling must be a multiple of the input scale");
+  encode_vesc_raw<Node, Command>(message, value * (int32_t)(vesc_scaling(Command) / InputScale));
+}
+
+template <uint8_t Node, COMMAND_ID Command>
+inline void encode_vesc(twai_message_t *message, float value){
+  encode_vesc_raw<Node, Command>(message, value * vesc_scaling(Command));
+}
+
+uint32_t get_scaling(enum COMMAND_ID id);
+twai_message_t createVESCMessage(uint8_t vescId, enum COMMAND_ID cmdId, float val);
+twai_message_t createActuatorsMessage(uint8_t actId, bool isBackrest, ACTUATOR_ACTION action);
+void print_twai_status();
+String print_vesc_message(twai_message_t *receivedMessage);
+
 #endif
\ No newline at end of file
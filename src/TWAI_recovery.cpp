@@ -0,0 +1,275 @@
+#include <atomic>
+#include "TWAI_recovery.h"
+#include "TWAI_handler.h"
+#include "TWAI_rx.h"
+#include "Latency.h"
+#include "Log.h"
+
+SemaphoreHandle_t twai_tx_mutex = NULL;
+
+// Read by the control task without a lock
+static std::atomic<uint8_t> recoveryState(RECOVERY_RUNNING);
+static std::atomic<uint32_t> restarts(0);
+// Only accessed by the recovery task
+static uint32_t busOffAt = 0;               // micros() of the bus-off
+static uint32_t actionAt = 0;               // millis() of the next recovery, or of the recovery timeout
+static uint32_t recoveredAt = 0;            // millis() of the last restart
+static bool recoveredBefore = false;
+static TwaiRecoveryStats recoveryStats = {};
+static portMUX_TYPE recoveryStatsLock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t recoveryTaskHandle = NULL;
+
+static void set_state(uint8_t state){
+  recoveryState.store(state, std::memory_order_release);
+  portENTER_CRITICAL(&recoveryStatsLock);
+  recoveryStats.state = state;
+  portEXIT_CRITICAL(&recoveryStatsLock);
+}
+
+static void count_restart(){
+  //The control task resends its setpoints when the count changes
+  portENTER_CRITICAL(&recoveryStatsLock);
+  recoveryStats.restarts++;
+  portEXIT_CRITICAL(&recoveryStatsLock);
+  restarts.fetch_add(1, std::memory_order_release);
+}
+
+static void restarted(bool reinstalled){
+  /* Records the restart of the controller after a bus-off
+    Arguments:
+      - bool reinstalled: true if the driver was reinstalled, false if it was recovered
+    Returns:
+      - void
+  */
+  uint32_t duration = micros() - busOffAt;
+  recoveredAt = millis();
+  recoveredBefore = true;
+  portENTER_CRITICAL(&recoveryStatsLock);
+  if(reinstalled) recoveryStats.reinstalled++;
+  else recoveryStats.recovered++;
+  recoveryStats.last_duration_us = duration;
+  if(duration > recoveryStats.max_duration_us) recoveryStats.max_duration_us = duration;
+  portEXIT_CRITICAL(&recoveryStatsLock);
+  count_restart();
+  set_state(RECOVERY_RUNNING);
+  LOG_INFO("TWAI bus back after %u us, driver reinstalled: %d", duration, reinstalled);
+}
+
+static void failed(uint32_t now){
+  //Waits twice as long before the next attempt
+  portENTER_CRITICAL(&recoveryStatsLock);
+  recoveryStats.failures++;
+  recoveryStats.backoff_ms = recoveryStats.backoff_ms == 0 ? RECOVERY_BACKOFF_MIN_MS : recoveryStats.backoff_ms * 2;
+  if(recoveryStats.backoff_ms > RECOVERY_BACKOFF_MAX_MS) recoveryStats.backoff_ms = RECOVERY_BACKOFF_MAX_MS;
+  actionAt = now + recoveryStats.backoff_ms;
+  portEXIT_CRITICAL(&recoveryStatsLock);
+  set_state(RECOVERY_BACKOFF);
+}
+
+static bool reinstall(){
+  /* Reinstalls and starts the driver. The control task does not transmit and the RX task does not receive meanwhile.
+    Arguments:
+      - void
+    Returns:
+      - bool: true if the driver is running again
+  */
+  xSemaphoreTake(twai_tx_mutex, portMAX_DELAY);
+  xSemaphoreTake(twai_driver_mutex, portMAX_DELAY);   // Wait until the RX task is not inside the driver
+  twai_stop();
+  //The driver cannot be uninstalled while it is recovering
+  esp_err_t result = twai_driver_uninstall();
+  if(result == ESP_OK) result = twai_driver_install(&g_config, &t_config, &f_config);
+  if(result == ESP_OK) result = twai_start();
+  xSemaphoreGive(twai_driver_mutex);
+  xSemaphoreGive(twai_tx_mutex);
+  if(result != ESP_OK) LOG_ERROR("TWAI driver reinstall failed: %d", result);
+  return result == ESP_OK;
+}
+
+static void recover(const twai_status_info_t *status, uint32_t now){
+  /* Recovers the controller from the bus-off, or reinstalls the driver where the recovery cannot complete
+    Arguments:
+      - const twai_status_info_t *status: The driver's status
+      - uint32_t now: Current millis()
+    Returns:
+      - void
+  */
+  if(status->state == TWAI_STATE_STOPPED){
+    //A recovery that timed out completed meanwhile
+    if(twai_start() == ESP_OK) restarted(false);
+    else failed(now);
+    return;
+  }
+  //A recovery that timed out is still running, it cannot be aborted: wait for it again
+  if(status->state == TWAI_STATE_RECOVERING ||
+     (status->state == TWAI_STATE_BUS_OFF && status->rx_error_counter == 0 && twai_initiate_recovery() == ESP_OK)){
+    actionAt = now + RECOVERY_TIMEOUT_MS;
+    set_state(RECOVERY_RECOVERING);
+    return;
+  }
+  LOG_WARN("TWAI recovery not possible (REC %u), reinstalling the driver", status->rx_error_counter);
+  if(reinstall()) restarted(true);
+  else failed(now);
+}
+
+static uint32_t step(uint32_t alerts){
+  /* Advances the recovery with the alerts read from the driver and its current state
+    Arguments:
+      - uint32_t alerts: The alerts, 0 if none were raised
+    Returns:
+      - uint32_t: Longest time in ms until the next step
+  */
+  twai_status_info_t status;
+  if(twai_get_status_info(&status) != ESP_OK) return RECOVERY_POLL_MS;   // Not installed, e.g. while shutting down
+  uint32_t now = millis();
+
+  portENTER_CRITICAL(&recoveryStatsLock);
+  if(alerts & TWAI_ALERT_ERR_PASS && !recoveryStats.error_passive){
+    recoveryStats.error_passive = true;
+    recoveryStats.error_passive_count++;
+  }
+  if(alerts & (TWAI_ALERT_ERR_ACTIVE | TWAI_ALERT_BELOW_ERR_WARN)) recoveryStats.error_passive = false;
+  if(alerts & TWAI_ALERT_PERIPH_RESET) recoveryStats.peripheral_resets++;
+  portEXIT_CRITICAL(&recoveryStatsLock);
+  if(alerts & TWAI_ALERT_TX_SUCCESS) latency_tx_done();
+  if(alerts & TWAI_ALERT_ERR_PASS) LOG_WARN("TWAI error passive, TEC %u, REC %u", status.tx_error_counter, status.rx_error_counter);
+
+  uint8_t state = recoveryState.load(std::memory_order_relaxed);
+  if(state == RECOVERY_RUNNING){
+    if(status.state == TWAI_STATE_BUS_OFF || alerts & TWAI_ALERT_BUS_OFF){
+      busOffAt = micros();
+      //Back off if the bus was not stable since the last recovery
+      bool stable = !recoveredBefore || now - recoveredAt >= RECOVERY_STABLE_MS;
+      portENTER_CRITICAL(&recoveryStatsLock);
+      recoveryStats.bus_off_count++;
+      recoveryStats.error_passive = false;
+      if(stable) recoveryStats.backoff_ms = 0;
+      else recoveryStats.backoff_ms = recoveryStats.backoff_ms == 0 ? RECOVERY_BACKOFF_MIN_MS : recoveryStats.backoff_ms * 2;
+      if(recoveryStats.backoff_ms > RECOVERY_BACKOFF_MAX_MS) recoveryStats.backoff_ms = RECOVERY_BACKOFF_MAX_MS;
+      actionAt = now + recoveryStats.backoff_ms;
+      portEXIT_CRITICAL(&recoveryStatsLock);
+      LOG_WARN("TWAI bus-off, TEC %u, REC %u", status.tx_error_counter, status.rx_error_counter);
+      set_state(RECOVERY_BACKOFF);
+      state = RECOVERY_BACKOFF;
+    }
+    else if(status.state == TWAI_STATE_STOPPED){
+      //Stopped outside of a recovery, e.g. after a recovery that was not followed by a start
+      if(twai_start() == ESP_OK) count_restart();
+    }
+  }
+  if(state == RECOVERY_BACKOFF){
+    if((int32_t)(now - actionAt) < 0) return actionAt - now;
+    recover(&status, now);
+  }
+  else if(state == RECOVERY_RECOVERING){
+    if(status.state == TWAI_STATE_STOPPED || alerts & TWAI_ALERT_BUS_RECOVERED){
+      if(twai_start() == ESP_OK) restarted(false);
+      else failed(now);
+    }
+    else if((int32_t)(now - actionAt) >= 0){
+      LOG_WARN("TWAI recovery timed out, TEC %u, REC %u", status.tx_error_counter, status.rx_error_counter);
+      if(reinstall()) restarted(true);
+      else failed(now);
+    }
+  }
+
+  state = recoveryState.load(std::memory_order_relaxed);
+  if(state == RECOVERY_RUNNING) return RECOVERY_POLL_MS;
+  return (int32_t)(actionAt - now) > 0 ? actionAt - now : 1;
+}
+
+void twai_recovery_begin(){
+  /* Enables the alerts of the recovery, and the TX completion alert of the latency debug pin, in g_config and creates the TX mutex. Must be
+  called before the driver is installed.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  g_config.alerts_enabled |= TWAI_RECOVERY_ALERTS | LATENCY_TX_ALERTS;
+  if(twai_tx_mutex == NULL) twai_tx_mutex = xSemaphoreCreateMutex();
+}
+
+void twai_recovery_run(TickType_t timeout){
+  /* Waits up to timeout for alerts and advances the recovery. The recovery task calls it in a loop, the native build once per step.
+    Arguments:
+      - TickType_t timeout: Longest wait for alerts
+    Returns:
+      - void
+  */
+  static uint32_t wait = RECOVERY_POLL_MS;
+  uint32_t alerts = 0;
+  TickType_t ticks = pdMS_TO_TICKS(wait) < timeout ? pdMS_TO_TICKS(wait) : timeout;
+  if(twai_read_alerts(&alerts, ticks) == ESP_ERR_INVALID_STATE) vTaskDelay(ticks);   // Not installed
+  wait = step(alerts);
+}
+
+static void recovery_task(void *parameters){
+  /* FreeRTOS task that recovers the bus, see TWAI_recovery.h
+    Arguments:
+      - void *parameters: Unused
+    Returns:
+      - void
+  */
+  while(1) twai_recovery_run(portMAX_DELAY);
+}
+
+void start_recovery_task(){
+  /* Starts the recovery task on the control task's core
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  xTaskCreatePinnedToCore(recovery_task, "twai_recovery", RECOVERY_TASK_STACK, NULL, RECOVERY_TASK_PRIORITY, &recoveryTaskHandle,
+                          CONTROL_TASK_CORE);
+}
+
+void stop_recovery_task(){
+  /* Deletes the recovery task, before the shutdown sends its stop frames and uninstalls the driver. The task runs above the caller's
+  priority on the same core, so it is blocked, waiting for alerts or in reinstall(). The mutexes are taken in the order of reinstall(), so
+  it is not reinstalling the driver when it is deleted.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  if(recoveryTaskHandle == NULL) return;
+  xSemaphoreTake(twai_tx_mutex, portMAX_DELAY);
+  xSemaphoreTake(twai_driver_mutex, portMAX_DELAY);
+  vTaskDelete(recoveryTaskHandle);
+  recoveryTaskHandle = NULL;
+  xSemaphoreGive(twai_driver_mutex);
+  xSemaphoreGive(twai_tx_mutex);
+}
+
+bool twai_recovery_bus_up(){
+  return recoveryState.load(std::memory_order_acquire) == RECOVERY_RUNNING;
+}
+
+uint32_t twai_recovery_restarts(){
+  return restarts.load(std::memory_order_acquire);
+}
+
+TwaiRecoveryStats get_recovery_stats(){
+  TwaiRecoveryStats stats;
+  portENTER_CRITICAL(&recoveryStatsLock);
+  stats = recoveryStats;
+  portEXIT_CRITICAL(&recoveryStatsLock);
+  return stats;
+}
+
+void print_recovery_stats(){
+  /* This function prints the bus recovery statistics in the Serial Monitor
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  static const char *stateNames[] = {"running", "backing off", "recovering"};
+  TwaiRecoveryStats stats = get_recovery_stats();
+  Serial.printf("Recovery: %s%s, %u times error passive, %u bus-offs: %u recovered, %u reinstalled, %u failed attempts, %u peripheral resets\n",
+                stateNames[stats.state], stats.error_passive ? " (error passive)" : "", stats.error_passive_count, stats.bus_off_count,
+                stats.recovered, stats.reinstalled, stats.failures, stats.peripheral_resets);
+  Serial.printf("Recovery: last %u us, max %u us, backoff %u ms\n", stats.last_duration_us, stats.max_duration_us, stats.backoff_ms);
+}
@@ -0,0 +1,61 @@
+#ifndef TWAI_RECOVERY_H
+#define TWAI_RECOVERY_H
+
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "config.h"
+
+/*Bus error recovery. A recovery task waits for the driver's alerts and brings the controller back after a bus-off, while the control task
+keeps computing setpoints into the TX mailboxes and only stops handing them to the driver.
+
+Error passive is not an error of this node that needs action: the controller still sends and receives, only its error frames are
+recessive. It is counted and reported. After a bus-off the controller is recovered with twai_initiate_recovery(), which takes 128
+occurrences of 11 recessive bits (about 3 ms at 500 kbit/s), then restarted. On the ESP32 a bus error right at the bus-off can leave the
+receive error counter above 0, and the recovery, which needs both counters at 0, then never completes (CONFIG_TWAI_ERRATA_FIX_BUS_OFF_REC
+makes the driver clear it). The driver is then reinstalled instead, as it is when the recovery does not complete within RECOVERY_TIMEOUT_MS.
+
+A node that goes bus-off again and again disturbs the other nodes each time it comes back. A bus-off within RECOVERY_STABLE_MS of the last
+recovery therefore waits before recovering, RECOVERY_BACKOFF_MIN_MS the first time and twice as long each further time.*/
+#define RECOVERY_TASK_PRIORITY (CONTROL_TASK_PRIORITY + 1)  // Reacts to a bus-off right away, it is blocked waiting for alerts otherwise
+#define RECOVERY_TASK_STACK 4096
+#define RECOVERY_POLL_MS 100          // Longest wait for alerts, the driver's state is also checked at this interval
+#define RECOVERY_TIMEOUT_MS 50        // Time given to twai_initiate_recovery() before the driver is reinstalled
+#define RECOVERY_BACKOFF_MIN_MS 10
+#define RECOVERY_BACKOFF_MAX_MS 1000
+#define RECOVERY_STABLE_MS 5000       // A bus-off this long after the last recovery is recovered without waiting
+#define TWAI_RECOVERY_ALERTS (TWAI_ALERT_ERR_PASS | TWAI_ALERT_ERR_ACTIVE | TWAI_ALERT_BUS_OFF | TWAI_ALERT_BUS_RECOVERED | \
+                              TWAI_ALERT_ABOVE_ERR_WARN | TWAI_ALERT_BELOW_ERR_WARN | TWAI_ALERT_PERIPH_RESET)
+
+enum RECOVERY_STATE{
+  RECOVERY_RUNNING,         // The controller is running, frames can be sent
+  RECOVERY_BACKOFF,         // Bus-off, waiting before the recovery
+  RECOVERY_RECOVERING,      // twai_initiate_recovery() called, waiting for the bus recovered alert
+};
+
+struct TwaiRecoveryStats{
+  uint8_t state;            // RECOVERY_STATE
+  bool error_passive;
+  uint32_t error_passive_count;   // Times the controller became error passive
+  uint32_t bus_off_count;
+  uint32_t recovered;       // Bus-offs ended by twai_initiate_recovery()
+  uint32_t reinstalled;     // Bus-offs ended by reinstalling the driver
+  uint32_t failures;        // Recoveries and reinstalls that did not bring the bus back
+  uint32_t restarts;        // Driver restarts, the frames in its TX queue are lost at each
+  uint32_t peripheral_resets;     // Peripheral resets by the driver's errata workarounds
+  uint32_t backoff_ms;      // Wait before the next recovery
+  uint32_t last_duration_us;      // Time from the bus-off to the restart
+  uint32_t max_duration_us;
+};
+
+extern SemaphoreHandle_t twai_tx_mutex;
+
+void twai_recovery_begin();
+void start_recovery_task();
+void stop_recovery_task();
+void twai_recovery_run(TickType_t timeout);
+bool twai_recovery_bus_up();
+uint32_t twai_recovery_restarts();
+TwaiRecoveryStats get_recovery_stats();
+void print_recovery_stats();
+
+#endif
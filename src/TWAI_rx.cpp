@@ -0,0 +1,213 @@
+#include "TWAI_rx.h"
+#include "TWAI_handler.h"
+#include "TWAI_filter.h"
+#include "TWAI_dispatch.h"
+#include "TWAI_stats.h"
+#include "VESC_status.h"
+#include "Trace.h"
+#include "Recorder.h"
+#include "Log.h"
+
+Seqlock<ActuatorsControllerData> actuatorsControllerData;
+SemaphoreHandle_t twai_driver_mutex = NULL;
+
+// Local copy of the published data, only accessed by the RX task
+static ActuatorsControllerData rxData = {};
+
+static FrameDispatcher rxDispatcher;
+
+static void decode_int32(const twai_message_t *message, void *context);
+static void decode_assembly_angles(const twai_message_t *message, void *context);
+
+struct RxFrame{
+  TwaiFilterId id;
+  FrameDecoder decoder;
+  void *context;
+  const char *name;
+};
+
+// Frames decoded by handle_received_frame(), the acceptance filter only lets these (and as few others as possible) through. The actuators
+// controller uses standard identifiers.
+static const RxFrame rxFrames[] = {
+  {{100, false}, decode_int32, &rxData.voltage1, "Voltage 1"},
+  {{101, false}, decode_int32, &rxData.voltage2, "Voltage 2"},
+  {{102, false}, decode_int32, &rxData.temperature, "Temperature"},
+  {{42, false}, decode_assembly_angles, NULL, "Assembly angles"}
+};
+#define RX_FRAME_COUNT (sizeof(rxFrames) / sizeof(rxFrames[0]))
+
+static RxStats rxStats = {};
+static portMUX_TYPE rxStatsLock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t rxTaskHandle = NULL;
+
+static void decode_int32(const twai_message_t *message, void *context){
+  /* Decodes a value sent by the actuators controller as a big endian 32 bit integer and publishes it
+    Arguments:
+      - const twai_message_t *message: The received frame
+      - void *context: The float in rxData that receives the value
+    Returns:
+      - void
+  */
+  int32_t value = message->data[0] << 24 | message->data[1] << 16 | message->data[2] << 8 | message->data[3];
+  *(float *)context = value;
+  LOG_DEBUG("ID %u: %d", message->identifier, value);
+  actuatorsControllerData.write(rxData);
+}
+
+static void decode_assembly_angles(const twai_message_t *message, void *context){
+  /* Decodes the potentiometers' position, two floats, and publishes it
+    Arguments:
+      - const twai_message_t *message: The received frame
+      - void *context: Unused
+    Returns:
+      - void
+  */
+  memcpy(&rxData.left_assembly_angle, &message->data[0], sizeof(float));
+  memcpy(&rxData.right_assembly_angle, &message->data[4], sizeof(float));
+  LOG_DEBUG("Left Assembly Angle: %.2f | Right Assembly Angle: %.2f", rxData.left_assembly_angle, rxData.right_assembly_angle);
+  actuatorsControllerData.write(rxData);
+}
+
+void handle_received_frame(const twai_message_t *message){
+  /* Counts a received frame and hands it to the decoder registered for its identifier in rx_begin(). The actuators controller's frames
+  include the two battery voltage levels, the electronics compartment's current temperature and the potentiometers' position, they are
+  published in actuatorsControllerData.
+    Arguments:
+      - const twai_message_t *message: Pointer to the received message
+    Returns:
+      - void
+  */
+  TRACE_RX(message);
+  recorder_frame(RECORDER_RX, message);
+  portENTER_CRITICAL(&rxStatsLock);
+  rxStats.total_count++;
+  portEXIT_CRITICAL(&rxStatsLock);
+  twai_stats_count(message, false);
+  receivedMessage = *message;
+
+  if(!rxDispatcher.dispatch(message)) LOG_DEBUG("Received something from: %08x", message->identifier);
+}
+
+esp_err_t receive_frame(TickType_t timeout){
+  /* Waits up to timeout for one frame and handles it. The driver's RX queue is checked without blocking every RX_POLL_TICKS, and the driver
+  mutex is only held for the check: blocking in twai_receive() with the mutex would make a reinstall (TWAI_recovery.h) wait for the
+  timeout, and without the mutex the driver could be uninstalled while the task is blocked on its queue. Also updates the bus statistics.
+    Arguments:
+      - TickType_t timeout: Maximum time to wait for a frame
+    Returns:
+      - esp_err_t: The result of twai_receive()
+  */
+  twai_message_t message;
+  TickType_t start = xTaskGetTickCount();
+  esp_err_t result;
+  while(1){
+    xSemaphoreTake(twai_driver_mutex, portMAX_DELAY);
+    result = twai_receive(&message, 0);
+    xSemaphoreGive(twai_driver_mutex);
+    if(result != ESP_ERR_TIMEOUT || xTaskGetTickCount() - start >= timeout) break;
+    vTaskDelay(RX_POLL_TICKS);
+  }
+
+  if(result == ESP_OK) handle_received_frame(&message);
+  twai_stats_update();
+  return result;
+}
+
+void rx_task(void *parameters){
+  /* FreeRTOS task that receives the TWAI frames. It blocks on the driver's RX queue and handles every frame as soon as it arrives, so the
+  control task never waits on a receive.
+    Arguments:
+      - void *parameters: Unused
+    Returns:
+      - void
+  */
+  while(1){
+    esp_err_t result = receive_frame(pdMS_TO_TICKS(RX_WAIT_MS));
+    if(result != ESP_OK && result != ESP_ERR_TIMEOUT) vTaskDelay(pdMS_TO_TICKS(RX_WAIT_MS)); // Driver not installed or not running
+  }
+}
+
+void rx_begin(){
+  /* Registers the decoders of the received frames, the actuators controller's and the VESCs' status packets, and builds the acceptance
+  filter for their identifiers into f_config, then prints how many other identifiers the filter lets through. Must be called once, before the
+  driver is installed.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  TwaiFilterId ids[RX_FRAME_COUNT + VESC_NODE_COUNT * VESC_STATUS_COUNT];
+  uint8_t count = 0;
+  for(uint8_t i = 0; i < RX_FRAME_COUNT; i++){
+    const RxFrame &frame = rxFrames[i];
+    if(!rxDispatcher.add(frame.id.identifier, frame.id.extd, frame.decoder, frame.context, frame.name)){
+      Serial.printf("Could not register the decoder of ID %x\n", frame.id.identifier);
+    }
+    ids[count++] = frame.id;
+  }
+  for(uint8_t node = VESC_FIRST_NODE; node < VESC_FIRST_NODE + VESC_NODE_COUNT; node++){
+    for(uint8_t i = 0; i < VESC_STATUS_COUNT; i++){
+      const VescStatusPacket &packet = vescStatusPackets[i];
+      if(!rxDispatcher.add_vesc(node, packet.command, packet.decoder, NULL, packet.name)){
+        Serial.printf("Could not register the decoder of VESC %u status packet %u\n", node, packet.command);
+      }
+      ids[count].identifier = vesc_frame_id(node, packet.command);
+      ids[count++].extd = true;
+    }
+  }
+
+  twai_filter_config_t filter;
+  TwaiFilterReport report;
+  if(!twai_filter_build(ids, count, &filter, &report)){
+    Serial.println("TWAI filter: too many identifiers, accepting all frames");
+    return;
+  }
+  f_config = filter;
+  print_filter_report(&f_config, &report);
+}
+
+void start_rx_task(){
+  /* Creates the driver mutex and starts the RX task on the control task's core
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  if(twai_driver_mutex == NULL) twai_driver_mutex = xSemaphoreCreateMutex();
+  xTaskCreatePinnedToCore(rx_task, "twai_rx", RX_TASK_STACK, NULL, RX_TASK_PRIORITY, &rxTaskHandle, CONTROL_TASK_CORE);
+}
+
+void stop_rx_task(){
+  /* Deletes the RX task, before the shutdown uninstalls the driver. The task only uses the driver while it holds the driver mutex, so it is
+  not inside the driver when it is deleted.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  if(rxTaskHandle == NULL) return;
+  xSemaphoreTake(twai_driver_mutex, portMAX_DELAY);
+  vTaskDelete(rxTaskHandle);
+  rxTaskHandle = NULL;
+  xSemaphoreGive(twai_driver_mutex);
+}
+
+RxStats get_rx_stats(){
+  RxStats stats;
+  portENTER_CRITICAL(&rxStatsLock);
+  stats = rxStats;
+  portEXIT_CRITICAL(&rxStatsLock);
+  return stats;
+}
+
+void print_rx_stats(){
+  /* This function prints the RX statistics in the Serial Monitor
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  RxStats stats = get_rx_stats();
+  Serial.printf("RX: %u frames\n", stats.total_count);
+  rxDispatcher.print_stats();
+}
@@ -0,0 +1,42 @@
+#ifndef TWAI_RX_H
+#define TWAI_RX_H
+
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "config.h"
+#include "Seqlock.h"
+
+//RX task settings. The task drains the driver's RX queue (filled by the TWAI interrupt) as frames arrive.
+#define TWAI_RX_QUEUE_LEN 32
+#define RX_TASK_PRIORITY (CONTROL_TASK_PRIORITY - 1)  // Below the control task, so the control task gets the driver mutex as soon as it is released
+#define RX_TASK_STACK 4096
+#define RX_WAIT_MS 20             // Longest wait of the RX task for a frame, the driver mutex is not held while waiting
+#define RX_POLL_TICKS 1           // Sleep between two checks of the driver's RX queue, the most a frame waits there for the RX task
+
+//Values received from the actuators controller
+struct ActuatorsControllerData{
+  float voltage1;
+  float voltage2;
+  float temperature;
+  float left_assembly_angle;
+  float right_assembly_angle;
+};
+
+//The per ID counts and rates of the received frames are in the bus statistics (TWAI_stats.h)
+struct RxStats{
+  uint32_t total_count;
+};
+
+extern Seqlock<ActuatorsControllerData> actuatorsControllerData;
+extern SemaphoreHandle_t twai_driver_mutex;
+
+void rx_begin();
+void start_rx_task();
+void stop_rx_task();
+void rx_task(void *parameters);
+esp_err_t receive_frame(TickType_t timeout);
+void handle_received_frame(const twai_message_t *message);
+RxStats get_rx_stats();
+void print_rx_stats();
+
+#endif
@@ -0,0 +1,240 @@
+#include "TWAI_schedule.h"
+#include "TWAI_recovery.h"
+#include "TWAI_stats.h"
+#include "Profiler.h"
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
+#include "esp_timer.h"
+
+#define TX_CONTROL_SLOTS (1000000 / CONTROL_LOOP_HZ / TX_SLOT_US)   // Slots per control period
+
+static constexpr TxScheduleEntry txSchedule[] = {
+  //Drive motors every control period, in the slot after the release
+  {RIGHT_DRIVE_VESC - VESC_FIRST_NODE, TX_CONTROL_SLOTS, 1, true, 4},
+  {LEFT_DRIVE_VESC - VESC_FIRST_NODE, TX_CONTROL_SLOTS, 1, true, 4},
+  //Front assemblies (8 and 10) together every second control period, the rear assembly (7) in the other one
+  {8 - VESC_FIRST_NODE, 2 * TX_CONTROL_SLOTS, 3, true, 4},
+  {10 - VESC_FIRST_NODE, 2 * TX_CONTROL_SLOTS, 3, true, 4},
+  {7 - VESC_FIRST_NODE, 2 * TX_CONTROL_SLOTS, TX_CONTROL_SLOTS + 3, true, 4},
+  //Actuators controller at 10 Hz
+  {TX_ACTUATORS_MAILBOX, 10 * TX_CONTROL_SLOTS, 5, true, 2},
+};
+#define TX_SCHEDULE_ENTRIES (sizeof(txSchedule) / sizeof(txSchedule[0]))
+
+//Build time checks of the table, see TWAI_schedule.h
+constexpr uint32_t schedule_load(size_t i){
+  //Bits per second of the entries from i on, each rounded up
+  return i == TX_SCHEDULE_ENTRIES ? 0 :
+         (twai_frame_bits_max(txSchedule[i].extd, txSchedule[i].length) * (1000000 / TX_SLOT_US) + txSchedule[i].period - 1) /
+         txSchedule[i].period + schedule_load(i + 1);
+}
+
+constexpr uint32_t gcd(uint32_t a, uint32_t b){
+  return b == 0 ? a : gcd(b, a % b);
+}
+
+constexpr bool share_slots(size_t i, size_t j){
+  //Two entries are due in a common slot if their offsets are congruent modulo the GCD of their periods
+  return txSchedule[i].offset % gcd(txSchedule[i].period, txSchedule[j].period) ==
+         txSchedule[j].offset % gcd(txSchedule[i].period, txSchedule[j].period);
+}
+
+constexpr bool slots_separate(size_t i, size_t j){
+  return i >= TX_SCHEDULE_ENTRIES ? true :
+         j >= TX_SCHEDULE_ENTRIES ? slots_separate(i + 1, i + 2) :
+         (!share_slots(i, j) || (txSchedule[i].period == txSchedule[j].period && txSchedule[i].offset == txSchedule[j].offset)) &&
+         slots_separate(i, j + 1);
+}
+
+constexpr uint32_t mailbox_entries(uint8_t mailbox, size_t i){
+  return i == TX_SCHEDULE_ENTRIES ? 0 : (txSchedule[i].mailbox == mailbox) + mailbox_entries(mailbox, i + 1);
+}
+
+constexpr bool mailboxes_once(uint8_t mailbox){
+  return mailbox == TX_MAILBOX_COUNT ? true : mailbox_entries(mailbox, 0) == 1 && mailboxes_once(mailbox + 1);
+}
+
+constexpr bool entries_valid(size_t i){
+  //Offsets within the period, VESCs refreshed before their keepalive is due
+  return i == TX_SCHEDULE_ENTRIES ? true :
+         txSchedule[i].period > 0 && txSchedule[i].offset < txSchedule[i].period &&
+         (txSchedule[i].mailbox == TX_ACTUATORS_MAILBOX || txSchedule[i].period * TX_SLOT_US <= TX_KEEPALIVE_MS * 1000UL) &&
+         entries_valid(i + 1);
+}
+
+constexpr uint16_t longest_period(size_t i){
+  return i == TX_SCHEDULE_ENTRIES ? 0 : txSchedule[i].period > longest_period(i + 1) ? txSchedule[i].period : longest_period(i + 1);
+}
+
+static constexpr uint16_t longestPeriod = longest_period(0);
+static constexpr uint32_t scheduleLoad = schedule_load(0);
+
+static_assert(1000000 % CONTROL_LOOP_HZ == 0 && (1000000 / CONTROL_LOOP_HZ) % TX_SLOT_US == 0, "The control period must be whole slots");
+static_assert(TX_MAILBOX_COUNT <= 8, "The due mailboxes are a uint8_t mask");
+static_assert(mailboxes_once(0), "Every TX mailbox needs exactly one schedule entry");
+static_assert(entries_valid(0), "Schedule entry with its offset outside its period, or a VESC period longer than TX_KEEPALIVE_MS");
+static_assert(slots_separate(0, 1), "Schedule entries share a slot without being a group with the same period and offset");
+static_assert(scheduleLoad <= (uint64_t)TX_SCHEDULE_BITRATE * TX_SCHEDULE_MAX_LOAD_PERCENT / 100,
+              "The schedule's worst case bus load exceeds TX_SCHEDULE_MAX_LOAD_PERCENT");
+
+// Only accessed by the TX task, and by the control task and the shutdown while the slot timer is stopped
+static esp_timer_handle_t slotTimer = NULL;
+#ifdef ESP_PLATFORM
+static TaskHandle_t txTaskHandle = NULL;
+#endif
+static uint32_t epoch = 0;                  // micros() of slot 0
+static uint32_t lastSlot = 0;
+static uint8_t overdue = 0;                 // Mailboxes that were due and still hold their frame
+static TxScheduleStats scheduleStats = {};
+static portMUX_TYPE scheduleStatsLock = portMUX_INITIALIZER_UNLOCKED;
+
+uint8_t tx_schedule_due(uint32_t slot){
+  /* Mailboxes due in a slot
+    Arguments:
+      - uint32_t slot: The slot, 0 is the control task's first release
+    Returns:
+      - uint8_t: Bit i set if mailbox i is due
+  */
+  uint8_t due = 0;
+  for(size_t i = 0; i < TX_SCHEDULE_ENTRIES; i++){
+    if(slot % txSchedule[i].period == txSchedule[i].offset) due |= 1 << txSchedule[i].mailbox;
+  }
+  return due;
+}
+
+uint32_t tx_schedule_period_us(uint8_t mailbox){
+  //Longest wait of a submitted frame for its slot
+  for(size_t i = 0; i < TX_SCHEDULE_ENTRIES; i++) if(txSchedule[i].mailbox == mailbox) return txSchedule[i].period * TX_SLOT_US;
+  return 0;
+}
+
+void tx_schedule_run(){
+  /* Hands the mailboxes due in the current slot to the driver, with the ones of slots the task woke up too late for and the ones that did
+  not fit in the driver's queue before. The TX task calls it at every slot, the native build from the slot timer's callback.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  uint32_t now = micros();
+  uint32_t slot = (now - epoch + TX_SLOT_US / 2) / TX_SLOT_US;
+  int32_t jitter = (int32_t)(now - (epoch + slot * TX_SLOT_US));
+  uint32_t behind = slot - lastSlot;
+  if(behind > longestPeriod) behind = longestPeriod;
+  uint8_t due = overdue;
+  for(uint32_t i = 0; i < behind; i++) due |= tx_schedule_due(slot - i);
+  lastSlot = slot;
+
+  uint8_t sent = 0;
+  PROFILE_START(STAGE_TX);
+  //While the recovery task restarts the driver the frames stay due
+  if(twai_recovery_bus_up() && xSemaphoreTake(twai_tx_mutex, 0) == pdTRUE){
+    sent = tx_flush_due(due);
+    xSemaphoreGive(twai_tx_mutex);
+  }
+  PROFILE_END(STAGE_TX);
+  overdue = due & tx_pending_mailboxes();
+
+  portENTER_CRITICAL(&scheduleStatsLock);
+  scheduleStats.slots++;
+  if(behind > 1) scheduleStats.missed += behind - 1;
+  scheduleStats.sent += sent;
+  if(overdue) scheduleStats.overdue++;
+  scheduleStats.last_jitter_us = jitter;
+  if(jitter > scheduleStats.max_jitter_us) scheduleStats.max_jitter_us = jitter;
+  portEXIT_CRITICAL(&scheduleStatsLock);
+}
+
+static void on_slot(void *arg){
+  //Wakes the TX task. The host build has no tasks, the slot runs right away.
+#ifdef ESP_PLATFORM
+  xTaskNotifyGive(txTaskHandle);
+#else
+  tx_schedule_run();
+#endif
+}
+
+#ifdef ESP_PLATFORM
+static void tx_task(void *parameters){
+  /* FreeRTOS task that runs the slots, see TWAI_schedule.h
+    Arguments:
+      - void *parameters: Unused
+    Returns:
+      - void
+  */
+  while(1){
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    tx_schedule_run();
+  }
+}
+#endif
+
+void tx_schedule_start(){
+  /* Starts the TX task and the slots, slot 0 at the current time. Called by the control task right after the first release, calling it
+  again starts the slots over.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  if(slotTimer == NULL){
+    esp_timer_create_args_t args = {};
+    args.callback = &on_slot;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "tx_slot";
+    esp_timer_create(&args, &slotTimer);
+  }
+  else esp_timer_stop(slotTimer);
+#ifdef ESP_PLATFORM
+  if(txTaskHandle == NULL){
+    xTaskCreatePinnedToCore(tx_task, "twai_tx", TX_TASK_STACK, NULL, TX_TASK_PRIORITY, &txTaskHandle, CONTROL_TASK_CORE);
+  }
+#endif
+  epoch = micros();
+  lastSlot = 0;
+  overdue = 0;
+  esp_timer_start_periodic(slotTimer, TX_SLOT_US);
+}
+
+void tx_schedule_stop(){
+  /* Stops the slots and the TX task, the mailboxes are no longer handed to the driver. Called before the shutdown sends its stop frames, so
+  no setpoint still waiting in a mailbox follows them.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  if(slotTimer != NULL) esp_timer_stop(slotTimer);
+#ifdef ESP_PLATFORM
+  if(txTaskHandle == NULL) return;
+  //The TX task only hands frames to the driver while it holds the TX mutex, a flush in progress ends before the task is deleted
+  xSemaphoreTake(twai_tx_mutex, portMAX_DELAY);
+  vTaskDelete(txTaskHandle);
+  txTaskHandle = NULL;
+  xSemaphoreGive(twai_tx_mutex);
+#endif
+}
+
+TxScheduleStats get_tx_schedule_stats(){
+  TxScheduleStats stats;
+  portENTER_CRITICAL(&scheduleStatsLock);
+  stats = scheduleStats;
+  portEXIT_CRITICAL(&scheduleStatsLock);
+  stats.load_bits_per_second = scheduleLoad;
+  return stats;
+}
+
+void print_tx_schedule_stats(){
+  /* This function prints the TX schedule statistics in the Serial Monitor
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  TxScheduleStats stats = get_tx_schedule_stats();
+  Serial.printf("TX schedule: %u slots, %u missed, %u with a due frame left, %u frames, jitter last/max %d/%d us, worst case load %u bit/s "
+                "(%.1f%%)\n", stats.slots, stats.missed, stats.overdue, stats.sent, stats.last_jitter_us, stats.max_jitter_us,
+                stats.load_bits_per_second, stats.load_bits_per_second * 100.0f / TX_SCHEDULE_BITRATE);
+}
@@ -0,0 +1,55 @@
+#ifndef TWAI_SCHEDULE_H
+#define TWAI_SCHEDULE_H
+
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "config.h"
+#include "TWAI_tx.h"
+
+/*Time-triggered transmission of the TX mailboxes (TWAI_tx.h). Time is divided in slots of TX_SLOT_US, counted from the control task's first
+release, and a static table (TWAI_schedule.cpp) gives every mailbox a period and a phase offset in slots: the mailbox is handed to the
+driver in the slots where (slot - offset) % period == 0, if it holds a frame. The drive motors go every control period one slot after the
+release, when main_loop() has submitted their setpoints, the assemblies and the actuators controller less often and in slots of their
+own, so the controller never puts all its frames on the bus at once and the delay of every frame is bounded by its period. Frames of
+TX_CLASS_STOP do not wait for their slot, they go in the next one. A due frame that did not fit in the driver's queue stays due.
+
+A periodic esp_timer wakes the TX task at every slot. The TX task runs on the control task's core at a higher priority, but it can block in
+the driver or the logger, so both tasks access the mailboxes in a critical section (TWAI_tx.cpp).
+
+The table is checked at build time: every mailbox has exactly one entry, entries that are due in the same slot have the same period and
+offset (they are handed over together, like the left and right motors), the VESCs are refreshed at least every TX_KEEPALIVE_MS, and the
+worst case bus load of the schedule, with every frame at its longest stuffed length, is at most TX_SCHEDULE_MAX_LOAD_PERCENT of
+TX_SCHEDULE_BITRATE.*/
+#define TX_SLOT_US 1000
+#define TX_TASK_PRIORITY (CONTROL_TASK_PRIORITY + 1)
+#define TX_TASK_STACK 4096
+#define TX_SCHEDULE_BITRATE 500000
+#define TX_SCHEDULE_MAX_LOAD_PERCENT 30   // The rest of the bus is left to the VESCs' status frames and the actuators controller
+
+struct TxScheduleEntry{
+  uint8_t mailbox;          // TX mailbox, node - VESC_FIRST_NODE or TX_ACTUATORS_MAILBOX
+  uint16_t period;          // Slots
+  uint16_t offset;          // Slot within the period, 0 is the control task's release
+  bool extd;                // Format of the mailbox's frames, for the bus load
+  uint8_t length;
+};
+
+struct TxScheduleStats{
+  uint32_t slots;           // Slots run
+  uint32_t missed;          // Slots the TX task woke up too late for, caught up in the next one
+  uint32_t sent;            // Frames handed to the driver
+  uint32_t overdue;         // Slots that ended with a due frame still waiting
+  int32_t last_jitter_us;   // Wake up time - slot time
+  int32_t max_jitter_us;
+  uint32_t load_bits_per_second;  // Worst case bus load of the schedule
+};
+
+void tx_schedule_start();
+void tx_schedule_stop();
+void tx_schedule_run();
+uint8_t tx_schedule_due(uint32_t slot);
+uint32_t tx_schedule_period_us(uint8_t mailbox);
+TxScheduleStats get_tx_schedule_stats();
+void print_tx_schedule_stats();
+
+#endif
@@ -0,0 +1,418 @@
+#include <atomic>
+#include <new>
+#include "TWAI_sniffer.h"
+#include "TWAI_handler.h"
+#include "Button_handler.h"
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
+
+static const char hexDigits[] = "0123456789ABCDEF";
+
+//Frames from the sniffer task (the only producer) to the serial output (the only consumer). Allocated by sniffer_begin(), so the controller
+//does not carry it.
+static SpscRing<SnifferFrame, SNIFFER_RING_LEN> *ring = NULL;
+static std::atomic<bool> channelOpen(false);
+static SnifferStats snifferStats = {};
+static portMUX_TYPE snifferStatsLock = portMUX_INITIALIZER_UNLOCKED;
+
+// Only accessed by the serial side: the commands, the output and the flags reported by F
+static bool timestamps = false;
+static bool binary = false;
+static char command[SNIFFER_COMMAND_LENGTH];
+static size_t commandLength = 0;
+static bool commandOverflow = false;
+static char responses[SNIFFER_COMMAND_LENGTH];
+static size_t responseLength = 0;
+static uint8_t output[SNIFFER_OUTPUT_LENGTH];
+static size_t outputLength = 0;
+static size_t outputPosition = 0;
+static uint32_t lastStatus = 0;
+static uint32_t flaggedLost = 0;          // Frames lost in the ring and the driver at the last F command
+static uint32_t flaggedBusErrors = 0;
+
+bool sniffer_requested(){
+  //SNIFFER_BUTTON held while the chair wakes up
+  return digitalRead(SNIFFER_BUTTON) == HIGH;
+}
+
+esp_err_t sniffer_begin(){
+  /* Allocates the ring, then installs and starts the TWAI driver in listen-only mode at the bit rate of t_config, with a larger RX queue and
+  the acceptance filter open. The channel stays closed until the host opens it. Call it before the other sniffer functions.
+    Arguments:
+      - void
+    Returns:
+      - esp_err_t: ESP_OK, ESP_ERR_NO_MEM if the ring could not be allocated, or the error of twai_driver_install() or twai_start()
+  */
+  if(ring == NULL) ring = new (std::nothrow) SpscRing<SnifferFrame, SNIFFER_RING_LEN>();
+  if(ring == NULL) return ESP_ERR_NO_MEM;
+  twai_general_config_t config = g_config;
+  config.mode = TWAI_MODE_LISTEN_ONLY;
+  config.rx_queue_len = SNIFFER_RX_QUEUE_LEN;
+  config.tx_queue_len = 0;
+  config.alerts_enabled = TWAI_ALERT_NONE;
+  twai_filter_config_t filter = TWAI_FILTER_CONFIG_ACCEPT_ALL();
+  esp_err_t result = twai_driver_install(&config, &t_config, &filter);
+  if(result == ESP_OK) result = twai_start();
+  return result;
+}
+
+bool sniffer_poll(TickType_t timeout){
+  /* Takes a frame from the driver's RX queue, stamps it and puts it in the ring. Frames received while the channel is closed are dropped
+  without being counted. The sniffer task calls it in a loop.
+    Arguments:
+      - TickType_t timeout: Ticks to wait for a frame
+    Returns:
+      - bool: true if a frame was taken from the driver
+  */
+  SnifferFrame frame;
+  if(twai_receive(&frame.message, timeout) != ESP_OK) return false;
+  frame.time = micros();
+  if(!channelOpen.load(std::memory_order_relaxed)) return true;
+  bool queued = ring->push(frame);
+  uint32_t waiting = ring->size();
+  portENTER_CRITICAL(&snifferStatsLock);
+  snifferStats.frames++;
+  if(!queued) snifferStats.dropped++;
+  if(waiting > snifferStats.max_queued) snifferStats.max_queued = waiting;
+  portEXIT_CRITICAL(&snifferStatsLock);
+  return true;
+}
+
+static char *put_hex(char *buffer, uint32_t value, uint8_t digits){
+  //Uppercase hexadecimal, most significant digit first
+  for(int i = digits - 1; i >= 0; i--) *buffer++ = hexDigits[(value >> (4 * i)) & 0xF];
+  return buffer;
+}
+
+static uint8_t *put_le(uint8_t *buffer, uint32_t value, uint8_t length){
+  for(uint8_t i = 0; i < length; i++) *buffer++ = value >> (8 * i);
+  return buffer;
+}
+
+size_t slcan_format(const SnifferFrame *frame, bool timestamp, char *buffer){
+  /* Formats a frame as an SLCAN line: t (standard), T (extended), r or R (remote), the identifier in 3 or 8 hex digits, the DLC, the data,
+  with Z1 the time in ms modulo 60000 in 4 hex digits, and a carriage return
+    Arguments:
+      - const SnifferFrame *frame: The frame
+      - bool timestamp: Append the time
+      - char *buffer: At least 32 characters, not terminated
+    Returns:
+      - size_t: Length of the line
+  */
+  const twai_message_t *message = &frame->message;
+  uint8_t length = message->data_length_code > 8 ? 8 : message->data_length_code;
+  char *position = buffer;
+  if(message->extd) *position++ = message->rtr ? 'R' : 'T';
+  else *position++ = message->rtr ? 'r' : 't';
+  position = put_hex(position, message->identifier, message->extd ? 8 : 3);
+  *position++ = hexDigits[length];
+  for(uint8_t i = 0; i < length && !message->rtr; i++) position = put_hex(position, message->data[i], 2);
+  if(timestamp) position = put_hex(position, frame->time / 1000 % 60000, 4);
+  *position++ = '\r';
+  return position - buffer;
+}
+
+size_t cobs_encode(const uint8_t *data, size_t length, uint8_t *buffer){
+  /* Consistent overhead byte stuffing: every 0 byte is replaced by the distance to the next one, so the encoded data contains no 0 and a
+  0 can delimit it. Adds one byte, and one more per 254 bytes without a 0.
+    Arguments:
+      - const uint8_t *data: The data
+      - size_t length: Its length
+      - uint8_t *buffer: At least length + length / 254 + 1 bytes, not delimited
+    Returns:
+      - size_t: Encoded length
+  */
+  uint8_t *code = buffer;
+  uint8_t *position = buffer + 1;
+  uint8_t distance = 1;
+  for(size_t i = 0; i < length; i++){
+    if(data[i] != 0){
+      *position++ = data[i];
+      distance++;
+    }
+    if(data[i] == 0 || distance == 0xFF){
+      //End of a block, a full block at the end of the data is not followed by an empty one
+      *code = distance;
+      distance = 1;
+      code = position;
+      if(data[i] == 0 || i + 1 < length) position++;
+    }
+  }
+  if(code < position) *code = distance;
+  return position - buffer;
+}
+
+static size_t binary_record(const uint8_t *payload, size_t length, uint8_t *buffer){
+  //COBS encoded record with its 0 delimiter
+  size_t encoded = cobs_encode(payload, length, buffer);
+  buffer[encoded] = 0;
+  return encoded + 1;
+}
+
+size_t sniffer_binary_frame(const SnifferFrame *frame, uint8_t *buffer){
+  /* Encodes a frame record of the binary framing, see TWAI_sniffer.h
+    Arguments:
+      - const SnifferFrame *frame: The frame
+      - uint8_t *buffer: At least 20 bytes
+    Returns:
+      - size_t: Length of the record with its delimiter
+  */
+  const twai_message_t *message = &frame->message;
+  uint8_t length = message->data_length_code > 8 ? 8 : message->data_length_code;
+  uint8_t payload[18];
+  uint8_t *position = payload;
+  *position++ = (message->extd ? SNIFFER_RECORD_EXTD : 0) | (message->rtr ? SNIFFER_RECORD_RTR : 0) | length;
+  position = put_le(position, message->identifier, message->extd ? 4 : 2);
+  position = put_le(position, frame->time, 4);
+  for(uint8_t i = 0; i < length && !message->rtr; i++) *position++ = message->data[i];
+  return binary_record(payload, position - payload, buffer);
+}
+
+static size_t status_record(uint8_t *buffer){
+  //Status record of the binary framing, see TWAI_sniffer.h
+  SnifferStats stats = get_sniffer_stats();
+  uint8_t payload[21];
+  uint8_t *position = payload;
+  *position++ = SNIFFER_RECORD_STATUS;
+  position = put_le(position, micros(), 4);
+  position = put_le(position, stats.frames, 4);
+  position = put_le(position, stats.dropped, 4);
+  position = put_le(position, stats.driver_missed, 4);
+  position = put_le(position, stats.driver_overruns, 4);
+  return binary_record(payload, position - payload, buffer);
+}
+
+static void respond(const char *response){
+  //Queues a response, the pump sends it before the next frame
+  size_t length = strlen(response);
+  if(responseLength + length > sizeof(responses)) return;
+  memcpy(responses + responseLength, response, length);
+  responseLength += length;
+}
+
+static uint8_t status_flags(){
+  /* SLCAN status flags. The error state is the current one, the overrun and bus error flags are set if frames were lost or bus errors
+  counted since the last F command.
+    Arguments:
+      - void
+    Returns:
+      - uint8_t: SLCAN_FLAG bits
+  */
+  uint8_t flags = 0;
+  twai_status_info_t status = {};
+  if(twai_get_status_info(&status) != ESP_OK) return flags;
+  SnifferStats stats = get_sniffer_stats();
+  uint32_t lost = stats.dropped + stats.driver_missed + stats.driver_overruns;
+  uint32_t errorCounter = status.tx_error_counter > status.rx_error_counter ? status.tx_error_counter : status.rx_error_counter;
+  if(status.msgs_to_rx >= SNIFFER_RX_QUEUE_LEN) flags |= SLCAN_FLAG_RX_FULL;
+  if(errorCounter >= 96) flags |= SLCAN_FLAG_ERROR_WARNING;
+  if(errorCounter >= 128) flags |= SLCAN_FLAG_ERROR_PASSIVE;
+  if(lost != flaggedLost) flags |= SLCAN_FLAG_DATA_OVERRUN;
+  if(status.bus_error_count != flaggedBusErrors) flags |= SLCAN_FLAG_BUS_ERROR;
+  flaggedLost = lost;
+  flaggedBusErrors = status.bus_error_count;
+  return flags;
+}
+
+void sniffer_command(const char *command){
+  /* Runs an SLCAN command and queues its response: a carriage return if it succeeded, BEL if it failed, see TWAI_sniffer.h for the
+  supported commands
+    Arguments:
+      - const char *command: The command without its carriage return
+    Returns:
+      - void
+  */
+  bool open = channelOpen.load();
+  bool ok = false;
+  char response[8];
+  switch(command[0]){
+    case 'O':
+    case 'L':
+      //Listen-only either way, the controller never acknowledges
+      ok = !open && command[1] == 0;
+      if(ok) channelOpen.store(true);
+      break;
+    case 'C':
+      ok = open && command[1] == 0;
+      if(ok) channelOpen.store(false);
+      break;
+    case 'S':
+      //Only the bit rate the driver runs at, 500 kbit/s
+      ok = !open && command[1] == '6' && command[2] == 0;
+      break;
+    case 'Z':
+      ok = (command[1] == '0' || command[1] == '1') && command[2] == 0;
+      if(ok) timestamps = command[1] == '1';
+      break;
+    case 'B':
+      ok = (command[1] == '0' || command[1] == '1') && command[2] == 0;
+      if(ok) binary = command[1] == '1';
+      break;
+    case 'F':
+      snprintf(response, sizeof(response), "F%02X\r", status_flags());
+      respond(response);
+      return;
+    case 'V':
+      respond("V0101\r");
+      return;
+    case 'N':
+      respond("N0001\r");
+      return;
+    default:
+      //Transmissions (t, T, r, R), BTR registers (s), acceptance filters (M, m) and unknown commands
+      break;
+  }
+  respond(ok ? "\r" : "\a");
+}
+
+void sniffer_input(char c){
+  /* Collects the serial input into commands, a carriage return runs the command
+    Arguments:
+      - char c: The received character
+    Returns:
+      - void
+  */
+  if(c == '\n') return;
+  if(c != '\r'){
+    if(commandLength < sizeof(command) - 1) command[commandLength++] = c;
+    else commandOverflow = true;
+    return;
+  }
+  command[commandLength] = 0;
+  if(commandOverflow) respond("\a");
+  else sniffer_command(command);
+  commandLength = 0;
+  commandOverflow = false;
+}
+
+static bool next_output(){
+  /* Fills the output with the next record: the queued responses first, then a due status record, then the oldest frame in the ring.
+  Frames left in the ring after the channel was closed are discarded.
+    Arguments:
+      - void
+    Returns:
+      - bool: false if there is nothing to send
+  */
+  outputPosition = 0;
+  outputLength = 0;
+  if(responseLength > 0){
+    if(binary){
+      uint8_t payload[1 + sizeof(responses)];
+      payload[0] = SNIFFER_RECORD_RESPONSE;
+      memcpy(payload + 1, responses, responseLength);
+      outputLength = binary_record(payload, 1 + responseLength, output);
+    }
+    else{
+      memcpy(output, responses, responseLength);
+      outputLength = responseLength;
+    }
+    responseLength = 0;
+    return true;
+  }
+  bool open = channelOpen.load();
+  if(open && binary && millis() - lastStatus >= SNIFFER_STATUS_MS){
+    lastStatus = millis();
+    outputLength = status_record(output);
+    return true;
+  }
+  SnifferFrame frame;
+  while(ring->pop(frame)){
+    if(!open) continue;
+    outputLength = binary ? sniffer_binary_frame(&frame, output) : slcan_format(&frame, timestamps, (char *)output);
+    portENTER_CRITICAL(&snifferStatsLock);
+    snifferStats.sent++;
+    portEXIT_CRITICAL(&snifferStatsLock);
+    return true;
+  }
+  return false;
+}
+
+size_t sniffer_pump(uint8_t *buffer, size_t size){
+  /* Takes the next bytes of the serial output. A record that does not fit is continued by the next call.
+    Arguments:
+      - uint8_t *buffer: Filled with the output
+      - size_t size: Room in the buffer, e.g. the free space in the UART's TX buffer
+    Returns:
+      - size_t: Bytes written to the buffer
+  */
+  size_t written = 0;
+  while(written < size){
+    if(outputPosition == outputLength && !next_output()) break;
+    size_t length = outputLength - outputPosition;
+    if(length > size - written) length = size - written;
+    memcpy(buffer + written, output + outputPosition, length);
+    outputPosition += length;
+    written += length;
+  }
+  portENTER_CRITICAL(&snifferStatsLock);
+  snifferStats.bytes += written;
+  portEXIT_CRITICAL(&snifferStatsLock);
+  return written;
+}
+
+SnifferStats get_sniffer_stats(){
+  SnifferStats stats;
+  portENTER_CRITICAL(&snifferStatsLock);
+  stats = snifferStats;
+  portEXIT_CRITICAL(&snifferStatsLock);
+  stats.open = channelOpen.load();
+  stats.binary = binary;
+  twai_status_info_t status = {};
+  twai_get_status_info(&status);
+  stats.driver_missed = status.rx_missed_count;
+  stats.driver_overruns = status.rx_overrun_count;
+  return stats;
+}
+
+#ifdef ESP_PLATFORM
+static void sniffer_task(void *parameters){
+  /* FreeRTOS task that moves the received frames from the driver to the ring
+    Arguments:
+      - void *parameters: Unused
+    Returns:
+      - void
+  */
+  while(1) sniffer_poll(portMAX_DELAY);
+}
+
+esp_err_t sniffer_run(){
+  /* Runs the sniffer until BTN4 is pressed, in place of the controller. The Arduino loop task runs the commands and writes the output to
+  the serial port as fast as the UART takes it, the sniffer task empties the driver's RX queue at a higher priority.
+    Arguments:
+      - void
+    Returns:
+      - esp_err_t: ESP_OK once BTN4 was pressed, or why the sniffer could not start, which is also printed on the serial port
+  */
+  Serial.setTxBufferSize(SNIFFER_SERIAL_BUFFER);
+  Serial.begin(SNIFFER_BAUD);
+  esp_err_t result = sniffer_begin();
+  TaskHandle_t taskHandle = NULL;
+  if(result == ESP_OK && xTaskCreatePinnedToCore(sniffer_task, "sniffer", SNIFFER_TASK_STACK, NULL, SNIFFER_TASK_PRIORITY, &taskHandle,
+                                                 CONTROL_TASK_CORE) != pdPASS){
+    result = ESP_ERR_NO_MEM;
+  }
+  if(result != ESP_OK){
+    Serial.printf("CAN sniffer could not start: %s\n", esp_err_to_name(result));
+    Serial.flush();
+    return result;
+  }
+
+  uint8_t chunk[256];
+  while(1){
+    while(Serial.available()) sniffer_input(Serial.read());
+    size_t room = Serial.availableForWrite();
+    size_t length = sniffer_pump(chunk, room < sizeof(chunk) ? room : sizeof(chunk));
+    if(length > 0) Serial.write(chunk, length);
+    button_update();
+    if(button_gesture(BUTTON_4, GESTURE_SHORT)) break;
+    //Sleep when the output is drained or the UART is full, the ring holds the frames meanwhile
+    if(length < sizeof(chunk)) vTaskDelay(1);
+  }
+  vTaskDelete(taskHandle);
+  channelOpen.store(false);
+  Serial.flush();
+  return ESP_OK;
+}
+#endif
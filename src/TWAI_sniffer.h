@@ -0,0 +1,86 @@
+#ifndef TWAI_SNIFFER_H
+#define TWAI_SNIFFER_H
+
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "config.h"
+#include "SpscRing.h"
+
+/*CAN sniffer mode for diagnosing the bus on the chair with a laptop instead of a separate analyzer. Holding SNIFFER_BUTTON while the chair
+wakes up starts the sniffer instead of the controller: the TWAI driver is installed in listen-only mode with the acceptance filter open,
+so the controller neither acknowledges nor sends anything, and every frame on the bus is streamed over the USB serial port at SNIFFER_BAUD.
+Pressing BTN4 again shuts the chair down.
+
+The stream speaks the SLCAN (Lawicel) protocol, so Linux can use it as a SocketCAN interface (slcand -o -s6 -S 2000000 /dev/ttyUSB0 can0,
+then candump can0). The host opens the channel with O or L, closes it with C and turns the timestamps on with Z1. Frames are only sent
+while the channel is open, the bit rate is the one of t_config (S6) and transmit commands are refused. F reports the status flags: a frame
+lost in the ring or in the driver sets the data overrun flag (bit 3) until it is read.
+
+B1 switches the stream to a compact binary framing for captures at full line rate with microsecond timestamps, B0 back to SLCAN. Every
+record is COBS encoded and ends with a 0 byte, so a reader can start anywhere in the stream. A frame record is a flags byte (bit 7
+extended, bit 6 RTR, bits 0-3 DLC), the identifier (2 bytes for a standard, 4 for an extended frame), the receive time in us (4 bytes)
+and the data, all little endian. A status record (flags byte 0x20) follows every SNIFFER_STATUS_MS with the time, the frames received
+and the frames lost in the ring, in the driver's RX queue and in the controller's RX FIFO, 4 bytes each. The responses to the commands
+are records too (flags byte 0x10 followed by the response), from the response to B1 on.
+
+The ESP32's TWAI driver does not timestamp frames. The sniffer task waits on the driver's RX queue at a high priority and takes the time
+as soon as it gets a frame, so the timestamp is late by the interrupt and task wake up latency, and by the time the frame waited in the
+queue while the task was busy with the frames before it. At SNIFFER_BAUD both framings keep up with a saturated 500 kbit/s bus, the ring
+only absorbs the moments the serial port falls behind.*/
+#define SNIFFER_BUTTON BTN3
+#define SNIFFER_BAUD 2000000
+#define SNIFFER_RX_QUEUE_LEN 128      // Driver RX queue, 12 ms of the shortest frames on a saturated bus
+#define SNIFFER_RING_LEN 1024         // Frames between the sniffer task and the serial output, must be a power of 2
+#define SNIFFER_SERIAL_BUFFER 4096    // UART TX buffer
+#define SNIFFER_TASK_PRIORITY (CONTROL_TASK_PRIORITY + 1)
+#define SNIFFER_TASK_STACK 4096
+#define SNIFFER_STATUS_MS 1000
+#define SNIFFER_COMMAND_LENGTH 32
+#define SNIFFER_OUTPUT_LENGTH 64      // Longest SLCAN line or binary record, and the responses to the commands
+#define SNIFFER_ERROR_MS 5000         // How long a failed start is shown on the screen before the chair sleeps
+
+//SLCAN status flags (F command)
+#define SLCAN_FLAG_RX_FULL 0x01
+#define SLCAN_FLAG_ERROR_WARNING 0x04
+#define SLCAN_FLAG_DATA_OVERRUN 0x08
+#define SLCAN_FLAG_ERROR_PASSIVE 0x20
+#define SLCAN_FLAG_BUS_ERROR 0x80
+
+//Binary framing
+#define SNIFFER_RECORD_EXTD 0x80
+#define SNIFFER_RECORD_RTR 0x40
+#define SNIFFER_RECORD_STATUS 0x20
+#define SNIFFER_RECORD_RESPONSE 0x10
+
+struct SnifferFrame{
+  uint32_t time;            // micros() when the sniffer task received the frame
+  twai_message_t message;
+};
+
+struct SnifferStats{
+  bool open;
+  bool binary;
+  uint32_t frames;          // Frames taken from the driver while the channel was open
+  uint32_t sent;            // Frames written to the serial output
+  uint32_t dropped;         // Frames lost because the ring was full, the serial output fell behind
+  uint32_t max_queued;      // Most frames waiting in the ring
+  uint32_t driver_missed;   // Frames lost because the driver's RX queue was full
+  uint32_t driver_overruns; // Frames lost in the controller's RX FIFO
+  uint32_t bytes;           // Bytes of serial output
+};
+
+bool sniffer_requested();
+esp_err_t sniffer_begin();
+bool sniffer_poll(TickType_t timeout);
+size_t sniffer_pump(uint8_t *buffer, size_t size);
+void sniffer_command(const char *command);
+void sniffer_input(char c);
+size_t slcan_format(const SnifferFrame *frame, bool timestamp, char *buffer);
+size_t sniffer_binary_frame(const SnifferFrame *frame, uint8_t *buffer);
+size_t cobs_encode(const uint8_t *data, size_t length, uint8_t *buffer);
+SnifferStats get_sniffer_stats();
+#ifdef ESP_PLATFORM
+esp_err_t sniffer_run();
+#endif
+
+#endif
@@ -0,0 +1,351 @@
+#include <stdarg.h>
+#include "TWAI_stats.h"
+#include "TWAI_handler.h"
+
+#define CRC15_POLYNOMIAL 0x4599
+#define FRAME_TAIL_BITS 13            // CRC delimiter, ACK slot and delimiter, end of frame (7) and interframe space (3), never stuffed
+
+static const uint8_t errorWindowSeconds[TWAI_STATS_ERROR_WINDOWS] = {1, 10, TWAI_STATS_HISTORY_S};
+
+//Error counters sampled once per TWAI_STATS_RATE_MS
+struct ErrorSample{
+  uint32_t tx_errors;
+  uint32_t rx_errors;
+  uint32_t bus_errors;
+  uint32_t arb_lost;
+  uint32_t tx_failed;
+  uint32_t rx_missed;
+};
+
+// Counted by the RX task and the control task, updated by the RX task and read by the service loop, always with twaiStatsLock taken
+static TwaiBusStats twaiStats = {};
+static uint32_t bucketBits[TWAI_STATS_BUCKETS];
+static uint32_t currentBucketBits = 0;
+static uint8_t nextBucket = 0;
+static uint8_t completedBuckets = 0;
+static ErrorSample errorHistory[TWAI_STATS_HISTORY_S + 1];
+static uint8_t nextSample = 0;
+static uint8_t sampleCount = 0;
+static portMUX_TYPE twaiStatsLock = portMUX_INITIALIZER_UNLOCKED;
+// Only accessed by the RX task
+static bool started = false;
+static uint32_t bucketStart = 0;
+static uint32_t rateStart = 0;
+
+uint32_t twai_bitrate(const twai_timing_config_t *timing){
+  /* Calculates the bit rate of a timing configuration
+    Arguments:
+      - const twai_timing_config_t *timing: The timing configuration
+    Returns:
+      - uint32_t: Bits per second. A bit is the sync segment and the two time segments, each time quantum brp clock cycles long.
+  */
+  return TWAI_CLOCK_HZ / (timing->brp * (1 + timing->tseg_1 + timing->tseg_2));
+}
+
+//Bit stream of a frame from the start of frame to the end of the CRC, the part that is stuffed
+struct FrameBits{
+  uint16_t crc;
+  uint8_t run;              // Consecutive equal bits on the bus, stuff bits included
+  uint8_t level;
+  uint8_t stuffed;
+  uint16_t bits;
+};
+
+static void put_bit(FrameBits *frame, uint8_t bit, bool crc){
+  if(crc){
+    uint8_t feedback = bit ^ (frame->crc >> 14 & 1);
+    frame->crc = (frame->crc << 1) & 0x7FFF;
+    if(feedback) frame->crc ^= CRC15_POLYNOMIAL;
+  }
+  frame->bits++;
+  if(bit == frame->level) frame->run++;
+  else{
+    frame->level = bit;
+    frame->run = 1;
+  }
+  //After 5 equal bits the transmitter inserts a bit of the other level, which starts the next run
+  if(frame->run == 5){
+    frame->stuffed++;
+    frame->level = !bit;
+    frame->run = 1;
+  }
+}
+
+static void put_bits(FrameBits *frame, uint32_t value, uint8_t count, bool crc){
+  //Most significant bit first
+  for(int i = count - 1; i >= 0; i--) put_bit(frame, value >> i & 1, crc);
+}
+
+uint16_t twai_crc15(const uint8_t *data, size_t length){
+  /* Calculates the CAN CRC-15 of whole bytes, most significant bit first
+    Arguments:
+      - const uint8_t *data: The bytes
+      - size_t length: Number of bytes
+    Returns:
+      - uint16_t: The CRC
+  */
+  FrameBits frame = {};
+  for(size_t i = 0; i < length; i++) put_bits(&frame, data[i], 8, true);
+  return frame.crc;
+}
+
+uint16_t twai_frame_bits(const twai_message_t *message, uint8_t *stuff_bits){
+  /* Calculates how long a frame occupies the bus
+    Arguments:
+      - const twai_message_t *message: The frame
+      - uint8_t *stuff_bits: Filled with the number of stuff bits in the frame, may be NULL
+    Returns:
+      - uint16_t: Length of the frame in bits, from the start of frame to the end of the interframe space
+  */
+  uint8_t dlc = message->data_length_code;
+  uint8_t dataBytes = message->rtr ? 0 : (dlc > 8 ? 8 : dlc);
+  FrameBits frame = {};
+  put_bit(&frame, 0, true);                                       // Start of frame
+  if(message->extd){
+    put_bits(&frame, message->identifier >> 18 & 0x7FF, 11, true);
+    put_bits(&frame, 0x3, 2, true);                               // SRR and IDE, recessive
+    put_bits(&frame, message->identifier & 0x3FFFF, 18, true);
+    put_bit(&frame, message->rtr, true);
+    put_bits(&frame, 0, 2, true);                                 // Reserved bits r1 and r0
+  }
+  else{
+    put_bits(&frame, message->identifier & TWAI_STD_ID_MASK, 11, true);
+    put_bit(&frame, message->rtr, true);
+    put_bits(&frame, 0, 2, true);                                 // IDE and r0, dominant
+  }
+  put_bits(&frame, dlc & 0xF, 4, true);
+  for(uint8_t i = 0; i < dataBytes; i++) put_bits(&frame, message->data[i], 8, true);
+  put_bits(&frame, frame.crc, 15, false);
+  if(stuff_bits != NULL) *stuff_bits = frame.stuffed;
+  return frame.bits + frame.stuffed + FRAME_TAIL_BITS;
+}
+
+void twai_stats_count(const twai_message_t *message, bool tx){
+  /* Counts a received or transmitted frame
+    Arguments:
+      - const twai_message_t *message: The frame
+      - bool tx: true for a frame handed to the driver for transmission
+    Returns:
+      - void
+  */
+  uint8_t stuffBits;
+  uint16_t bits = twai_frame_bits(message, &stuffBits);
+  uint8_t bytes = message->rtr ? 0 : (message->data_length_code > 8 ? 8 : message->data_length_code);
+  portENTER_CRITICAL(&twaiStatsLock);
+  twaiStats.frames++;
+  twaiStats.bits += bits;
+  twaiStats.stuff_bits += stuffBits;
+  currentBucketBits += bits;
+  TwaiIdStats *entry = NULL;
+  for(int i = 0; i < twaiStats.tracked_ids && entry == NULL; i++){
+    TwaiIdStats *candidate = &twaiStats.ids[i];
+    if(candidate->identifier == message->identifier && candidate->extd == (bool)message->extd && candidate->tx == tx) entry = candidate;
+  }
+  if(entry == NULL && twaiStats.tracked_ids < TWAI_STATS_MAX_IDS){
+    entry = &twaiStats.ids[twaiStats.tracked_ids++];
+    memset(entry, 0, sizeof(*entry));
+    entry->identifier = message->identifier;
+    entry->extd = message->extd;
+    entry->tx = tx;
+  }
+  if(entry != NULL){
+    entry->frames++;
+    entry->bytes += bytes;
+    entry->window_frames++;
+    entry->window_bytes += bytes;
+  }
+  else twaiStats.other_frames++;
+  portEXIT_CRITICAL(&twaiStatsLock);
+}
+
+static uint32_t increase(uint32_t now, uint32_t before){
+  //Increase of an event count, which restarts at 0 when the driver is reinstalled
+  return now >= before ? now - before : now;
+}
+
+static void sample_errors(const twai_status_info_t *status){
+  /* Stores the error counters and calculates their change over the error windows. Called with twaiStatsLock taken.
+    Arguments:
+      - const twai_status_info_t *status: The driver's status
+    Returns:
+      - void
+  */
+  ErrorSample &sample = errorHistory[nextSample];
+  sample.tx_errors = status->tx_error_counter;
+  sample.rx_errors = status->rx_error_counter;
+  sample.bus_errors = status->bus_error_count;
+  sample.arb_lost = status->arb_lost_count;
+  sample.tx_failed = status->tx_failed_count;
+  sample.rx_missed = status->rx_missed_count;
+  nextSample = (nextSample + 1) % (TWAI_STATS_HISTORY_S + 1);
+  if(sampleCount < TWAI_STATS_HISTORY_S + 1) sampleCount++;
+
+  twaiStats.tx_error_counter = status->tx_error_counter;
+  twaiStats.rx_error_counter = status->rx_error_counter;
+  twaiStats.rx_missed = status->rx_missed_count;
+  for(int i = 0; i < TWAI_STATS_ERROR_WINDOWS; i++){
+    //Compare with the sample the window length ago, or the oldest one while there is less history
+    uint8_t seconds = errorWindowSeconds[i] < sampleCount - 1 ? errorWindowSeconds[i] : sampleCount - 1;
+    const ErrorSample &before = errorHistory[(nextSample + TWAI_STATS_HISTORY_S - seconds) % (TWAI_STATS_HISTORY_S + 1)];
+    TwaiErrorWindow &window = twaiStats.errors[i];
+    window.seconds = seconds;
+    window.tx_errors = (int32_t)sample.tx_errors - (int32_t)before.tx_errors;
+    window.rx_errors = (int32_t)sample.rx_errors - (int32_t)before.rx_errors;
+    window.bus_errors = increase(sample.bus_errors, before.bus_errors);
+    window.arb_lost = increase(sample.arb_lost, before.arb_lost);
+    window.tx_failed = increase(sample.tx_failed, before.tx_failed);
+    window.rx_missed = increase(sample.rx_missed, before.rx_missed);
+  }
+}
+
+static void close_bucket(uint32_t bitrate){
+  /* Moves the bus time of the current bucket into the utilization window. Called with twaiStatsLock taken.
+    Arguments:
+      - uint32_t bitrate: The bus' bit rate
+    Returns:
+      - void
+  */
+  bucketBits[nextBucket] = currentBucketBits;
+  currentBucketBits = 0;
+  nextBucket = (nextBucket + 1) % TWAI_STATS_BUCKETS;
+  if(completedBuckets < TWAI_STATS_BUCKETS) completedBuckets++;
+  uint64_t bits = 0;
+  for(int i = 0; i < TWAI_STATS_BUCKETS; i++) bits += bucketBits[i];
+  twaiStats.bitrate = bitrate;
+  twaiStats.utilization = bits / ((float)bitrate * completedBuckets * TWAI_STATS_BUCKET_MS / 1000);
+  if(completedBuckets == TWAI_STATS_BUCKETS && twaiStats.utilization > twaiStats.peak_utilization) twaiStats.peak_utilization = twaiStats.utilization;
+}
+
+void twai_stats_update(){
+  /* Slides the utilization window and, once per TWAI_STATS_RATE_MS, calculates the per ID rates and samples the error counters. Called by
+  the RX task after every receive, so at least every RX_WAIT_MS.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  uint32_t now = millis();
+  if(!started){
+    started = true;
+    bucketStart = now;
+    rateStart = now;
+    return;
+  }
+  uint32_t bitrate = twai_bitrate(&t_config);
+  //After a long pause (e.g. while the driver was reinstalled) the empty buckets only need to be closed once each
+  uint32_t buckets = (now - bucketStart) / TWAI_STATS_BUCKET_MS;
+  if(buckets > 0){
+    portENTER_CRITICAL(&twaiStatsLock);
+    for(uint32_t i = 0; i < buckets && i <= TWAI_STATS_BUCKETS; i++) close_bucket(bitrate);
+    portEXIT_CRITICAL(&twaiStatsLock);
+    bucketStart += buckets * TWAI_STATS_BUCKET_MS;
+  }
+
+  uint32_t elapsed = now - rateStart;
+  if(elapsed < TWAI_STATS_RATE_MS) return;
+  twai_status_info_t status;
+  bool statusValid = twai_get_status_info(&status) == ESP_OK;
+  portENTER_CRITICAL(&twaiStatsLock);
+  for(int i = 0; i < twaiStats.tracked_ids; i++){
+    TwaiIdStats &entry = twaiStats.ids[i];
+    entry.frame_rate = entry.window_frames * 1000.0f / elapsed;
+    entry.byte_rate = entry.window_bytes * 1000.0f / elapsed;
+    entry.window_frames = 0;
+    entry.window_bytes = 0;
+  }
+  if(statusValid) sample_errors(&status);
+  portEXIT_CRITICAL(&twaiStatsLock);
+  rateStart = now;
+}
+
+void twai_stats_reset(){
+  //Clears the statistics and restarts the windows at the next twai_stats_update()
+  portENTER_CRITICAL(&twaiStatsLock);
+  memset(&twaiStats, 0, sizeof(twaiStats));
+  memset(bucketBits, 0, sizeof(bucketBits));
+  currentBucketBits = 0;
+  nextBucket = 0;
+  completedBuckets = 0;
+  nextSample = 0;
+  sampleCount = 0;
+  portEXIT_CRITICAL(&twaiStatsLock);
+  started = false;
+}
+
+TwaiBusStats get_twai_stats(){
+  TwaiBusStats stats;
+  portENTER_CRITICAL(&twaiStatsLock);
+  stats = twaiStats;
+  portEXIT_CRITICAL(&twaiStatsLock);
+  stats.bitrate = twai_bitrate(&t_config);
+  return stats;
+}
+
+void print_twai_stats(){
+  /* This function prints the bus statistics in the Serial Monitor
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  TwaiBusStats stats = get_twai_stats();
+  Serial.printf("Bus: %u bit/s, utilization %.1f%% (peak %.1f%%), %u frames, %u stuff bits (%.1f%% of the bus time)\n", stats.bitrate,
+                stats.utilization * 100, stats.peak_utilization * 100, stats.frames, stats.stuff_bits,
+                stats.bits > 0 ? stats.stuff_bits * 100.0f / stats.bits : 0);
+  Serial.printf("Bus errors: TEC %u, REC %u, %u RX queue overflows\n", stats.tx_error_counter, stats.rx_error_counter, stats.rx_missed);
+  for(int i = 0; i < TWAI_STATS_ERROR_WINDOWS; i++){
+    const TwaiErrorWindow &window = stats.errors[i];
+    Serial.printf("  Last %u s: TEC %+d, REC %+d, %u bus errors, %u arbitrations lost, %u TX failed, %u RX missed\n", window.seconds,
+                  window.tx_errors, window.rx_errors, window.bus_errors, window.arb_lost, window.tx_failed, window.rx_missed);
+  }
+  for(int i = 0; i < stats.tracked_ids; i++){
+    const TwaiIdStats &entry = stats.ids[i];
+    Serial.printf("  %s %s ID %x: %u frames, %u bytes, %.1f frames/s, %.1f bytes/s\n", entry.tx ? "TX" : "RX", entry.extd ? "extended" : "standard",
+                  entry.identifier, entry.frames, entry.bytes, entry.frame_rate, entry.byte_rate);
+  }
+  if(stats.other_frames > 0) Serial.printf("  %u frames from untracked IDs\n", stats.other_frames);
+}
+
+static void append(char *buffer, size_t size, size_t *length, const char *format, ...){
+  //Appends to a string, keeping it terminated when it is full
+  if(*length + 1 >= size) return;
+  va_list args;
+  va_start(args, format);
+  int written = vsnprintf(buffer + *length, size - *length, format, args);
+  va_end(args);
+  if(written > 0) *length += (size_t)written < size - *length ? written : size - *length - 1;
+}
+
+size_t twai_stats_json(char *buffer, size_t size){
+  /* Formats the bus statistics as JSON for the web server
+    Arguments:
+      - char *buffer: Filled with the JSON text
+      - size_t size: Size of the buffer
+    Returns:
+      - size_t: Length of the text, the identifiers that do not fit are left out
+  */
+  if(size == 0) return 0;
+  TwaiBusStats stats = get_twai_stats();
+  size_t length = 0;
+  buffer[0] = '\0';
+  append(buffer, size, &length, "{\"bitrate\":%u,\"utilization\":%.4f,\"peak_utilization\":%.4f,\"frames\":%u,\"bits\":%llu,\"stuff_bits\":%u,"
+         "\"tx_error_counter\":%u,\"rx_error_counter\":%u,\"rx_missed\":%u,\"errors\":[", stats.bitrate, stats.utilization,
+         stats.peak_utilization, stats.frames, (unsigned long long)stats.bits, stats.stuff_bits, stats.tx_error_counter,
+         stats.rx_error_counter, stats.rx_missed);
+  for(int i = 0; i < TWAI_STATS_ERROR_WINDOWS; i++){
+    const TwaiErrorWindow &window = stats.errors[i];
+    append(buffer, size, &length, "%s{\"seconds\":%u,\"tx_errors\":%d,\"rx_errors\":%d,\"bus_errors\":%u,\"arb_lost\":%u,\"tx_failed\":%u,"
+           "\"rx_missed\":%u}", i > 0 ? "," : "", window.seconds, window.tx_errors, window.rx_errors, window.bus_errors, window.arb_lost,
+           window.tx_failed, window.rx_missed);
+  }
+  append(buffer, size, &length, "],\"other_frames\":%u,\"ids\":[", stats.other_frames);
+  //Leave room for the closing brackets
+  for(int i = 0; i < stats.tracked_ids && length + 160 < size; i++){
+    const TwaiIdStats &entry = stats.ids[i];
+    append(buffer, size, &length, "%s{\"id\":%u,\"extd\":%s,\"dir\":\"%s\",\"frames\":%u,\"bytes\":%u,\"frame_rate\":%.1f,\"byte_rate\":%.1f}",
+           i > 0 ? "," : "", entry.identifier, entry.extd ? "true" : "false", entry.tx ? "tx" : "rx", entry.frames, entry.bytes,
+           entry.frame_rate, entry.byte_rate);
+  }
+  append(buffer, size, &length, "]}");
+  return length;
+}
@@ -0,0 +1,77 @@
+#ifndef TWAI_STATS_H
+#define TWAI_STATS_H
+
+#include <Arduino.h>
+#include "driver/twai.h"
+
+/*Bus statistics. Every frame the RX task receives and every frame the TX mailboxes hand to the driver is counted per identifier and
+direction, and its length on the bus is added to the bus time: the exact number of bits, with the stuff bits of its own content, the CRC
+and the interframe space. The bus utilization is that time over a sliding window, at the bit rate of t_config. Frames of other nodes that
+the acceptance filter drops are not seen, so the utilization is a lower bound on a bus with other traffic.
+
+Once per second the driver's error counters are sampled, and their change over the last 1, 10 and 60 seconds is reported. The counters
+move up by 8 (TX) or 1 to 8 (RX) per error and down by 1 per successful frame, a rising delta means the bus is getting worse.*/
+#define TWAI_STATS_MAX_IDS 48         // Identifier and direction pairs tracked individually, further frames are counted as "other"
+#define TWAI_STATS_BUCKET_MS 100      // The utilization window slides in steps of this length
+#define TWAI_STATS_BUCKETS 10         // Utilization window of TWAI_STATS_BUCKETS * TWAI_STATS_BUCKET_MS
+#define TWAI_STATS_RATE_MS 1000       // Window of the per ID rates, also the error counters' sampling interval
+#define TWAI_STATS_HISTORY_S 60       // Longest error counter window
+#define TWAI_STATS_ERROR_WINDOWS 3
+#define TWAI_CLOCK_HZ 80000000UL      // APB clock, the source of the TWAI bit timing
+
+struct TwaiIdStats{
+  uint32_t identifier;
+  bool extd;
+  bool tx;                  // true for transmitted frames
+  uint32_t frames;
+  uint32_t bytes;           // Data bytes
+  uint32_t window_frames;
+  uint32_t window_bytes;
+  float frame_rate;         // Frames per second over the last TWAI_STATS_RATE_MS
+  float byte_rate;          // Data bytes per second
+};
+
+//Change of the error counters over a window. The error counters can go down, the event counts only go up.
+struct TwaiErrorWindow{
+  uint8_t seconds;
+  int32_t tx_errors;        // Change of the transmit error counter
+  int32_t rx_errors;        // Change of the receive error counter
+  uint32_t bus_errors;
+  uint32_t arb_lost;
+  uint32_t tx_failed;
+  uint32_t rx_missed;       // Frames lost because the driver's RX queue was full
+};
+
+struct TwaiBusStats{
+  TwaiIdStats ids[TWAI_STATS_MAX_IDS];
+  uint8_t tracked_ids;
+  uint32_t other_frames;    // Frames whose identifier did not fit in the table
+  uint32_t frames;
+  uint64_t bits;            // Bus time of all counted frames, in bits
+  uint32_t stuff_bits;
+  uint32_t bitrate;
+  float utilization;        // Share of the bus time used over the last TWAI_STATS_BUCKETS buckets, 0 to 1
+  float peak_utilization;   // Highest utilization of any window
+  uint32_t tx_error_counter;
+  uint32_t rx_error_counter;
+  uint32_t rx_missed;
+  TwaiErrorWindow errors[TWAI_STATS_ERROR_WINDOWS];
+};
+
+constexpr uint32_t twai_frame_bits_max(bool extd, uint8_t length){
+  //Longest a data frame can be: g = 54 (extended) or 34 (standard) bits and the data are stuffed, at most one stuff bit per 4 bits after
+  //the first, then the 13 bits of CRC delimiter, ACK, end of frame and interframe space. 135 and 160 bits for 8 data bytes.
+  return (extd ? 54 : 34) + 8 * length + ((extd ? 54 : 34) + 8 * length - 1) / 4 + 13;
+}
+
+uint32_t twai_bitrate(const twai_timing_config_t *timing);
+uint16_t twai_crc15(const uint8_t *data, size_t length);
+uint16_t twai_frame_bits(const twai_message_t *message, uint8_t *stuff_bits);
+void twai_stats_count(const twai_message_t *message, bool tx);
+void twai_stats_update();
+void twai_stats_reset();
+TwaiBusStats get_twai_stats();
+void print_twai_stats();
+size_t twai_stats_json(char *buffer, size_t size);
+
+#endif
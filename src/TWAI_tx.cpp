@@ -0,0 +1,327 @@
+#include "TWAI_tx.h"
+#include "TWAI_stats.h"
+#include "Latency.h"
+#include "Trace.h"
+#include "Recorder.h"
+#include "Log.h"
+
+// Mailboxes, filled by the control task (tx_submit(), tx_resend()) and emptied by the TX slot task (tx_flush_due(), TWAI_schedule.h). Both
+// tasks only access them, the last sent frames and the statistics under txLock, the TX task hands a copy of the frame to the driver. The
+// statistics are also read by the service loop.
+static twai_message_t mailboxFrames[TX_MAILBOX_COUNT];
+static bool mailboxPending[TX_MAILBOX_COUNT];
+static uint8_t mailboxClass[TX_MAILBOX_COUNT];      // TX_CLASS of the waiting frame
+static uint32_t mailboxSubmitted[TX_MAILBOX_COUNT];
+static uint32_t mailboxSampled[TX_MAILBOX_COUNT];   // micros() of the ADC sample behind the frame
+static bool mailboxMeasured[TX_MAILBOX_COUNT];      // false for resent frames, their latency is not recorded
+static uint32_t mailboxVersion[TX_MAILBOX_COUNT];   // Counts the frames put in the mailbox, tells the TX task it was refilled
+// Last frame handed to the driver per node, valid once lastSentAt is set
+static twai_message_t lastSent[TX_MAILBOX_COUNT];
+static uint32_t lastSentAt[TX_MAILBOX_COUNT];
+static bool lastSentValid[TX_MAILBOX_COUNT];
+// Sample of the last measured drive motor frame handed to the driver and the time of the handoff, for the left/right skew. Only accessed by
+// the TX task.
+static uint32_t handedSample[TX_MAILBOX_COUNT];
+static uint32_t handedAt[TX_MAILBOX_COUNT];
+static bool handedValid[TX_MAILBOX_COUNT];
+static TxStats txStats = {};
+static portMUX_TYPE txLock = portMUX_INITIALIZER_UNLOCKED;
+// Unchanged frames and millis() at the last print_tx_stats(), only accessed by the service loop
+static uint32_t lastPrintUnchanged = 0;
+static uint32_t lastPrintTime = 0;
+
+static_assert(TX_KEEPALIVE_MS * 2 <= VESC_CAN_TIMEOUT_MS, "A lost keepalive frame must not make a VESC time out");
+
+static bool same_setpoint(const twai_message_t *a, const twai_message_t *b){
+  return a->identifier == b->identifier && a->flags == b->flags && a->data_length_code == b->data_length_code &&
+         memcmp(a->data, b->data, a->data_length_code) == 0;
+}
+
+static bool zero_payload(const twai_message_t *message){
+  for(uint8_t i = 0; i < message->data_length_code && i < TWAI_FRAME_MAX_DLC; i++) if(message->data[i] != 0) return false;
+  return true;
+}
+
+static uint8_t mailbox_index(const twai_message_t *message){
+  //VESC frames carry the node in the identifier's low byte. TX_MAILBOX_COUNT if the frame has no mailbox.
+  if(message->extd && message->identifier == ACTUATORS_MESSAGE_ID) return TX_ACTUATORS_MAILBOX;
+  uint8_t index = (message->identifier & 0xFF) - VESC_FIRST_NODE;
+  return index < VESC_NODE_COUNT ? index : TX_MAILBOX_COUNT;
+}
+
+static uint8_t mailbox_class(uint8_t index){
+  //Class of a mailbox's frames unless they stop the node
+  if(index == TX_ACTUATORS_MAILBOX) return TX_CLASS_ACTUATOR;
+  uint8_t node = VESC_FIRST_NODE + index;
+  return node == RIGHT_DRIVE_VESC || node == LEFT_DRIVE_VESC ? TX_CLASS_TRACTION : TX_CLASS_ASSEMBLY;
+}
+
+bool tx_submit(const twai_message_t *message, uint32_t sampled_at){
+  /* Puts a frame in its node's mailbox, replacing the frame that is still waiting there. A frame that repeats the node's last sent
+  setpoint is dropped if that was sent less than TX_KEEPALIVE_MS ago. Never blocks.
+    Arguments:
+      - const twai_message_t *message: A VESC frame, its identifier's low byte is the VESC node, or the actuators controller's command
+      - uint32_t sampled_at: micros() of the joystick sample the setpoint was computed from (latency_sample())
+    Returns:
+      - bool: false if the node has no mailbox
+  */
+  uint8_t index = mailbox_index(message);
+  uint32_t now = micros();
+  portENTER_CRITICAL(&txLock);
+  if(index >= TX_MAILBOX_COUNT){
+    txStats.rejected++;
+    portEXIT_CRITICAL(&txLock);
+    return false;
+  }
+  TxMailboxStats *stats = &txStats.nodes[index];
+  stats->submitted++;
+  //A waiting frame is always replaced, it may hold a setpoint that differs from the last sent one
+  bool unchanged = !mailboxPending[index] && lastSentValid[index] && same_setpoint(message, &lastSent[index]);
+  if(unchanged && now - lastSentAt[index] < (uint32_t)TX_KEEPALIVE_MS * 1000){
+    stats->unchanged++;
+    portEXIT_CRITICAL(&txLock);
+    return true;
+  }
+  if(unchanged) stats->keepalive++;
+  if(mailboxPending[index]) stats->superseded++;
+  else txStats.pending++;
+
+  //Written in the critical section, the TX task (TWAI_schedule.h) must not see a half written mailbox
+  bool stops = zero_payload(message) && !(lastSentValid[index] && zero_payload(&lastSent[index]));
+  mailboxFrames[index] = *message;
+  mailboxClass[index] = stops ? (uint8_t)TX_CLASS_STOP : mailbox_class(index);
+  mailboxSubmitted[index] = now;
+  mailboxSampled[index] = sampled_at;
+  mailboxMeasured[index] = true;
+  mailboxPending[index] = true;
+  mailboxVersion[index]++;
+  portEXIT_CRITICAL(&txLock);
+  return true;
+}
+
+static void record_skew(uint8_t index, uint32_t sampled, uint32_t now){
+  //Skew between the drive motors' frames of the same joystick sample, recorded when the second one is handed to the driver
+  uint8_t other = (index == RIGHT_DRIVE_VESC - VESC_FIRST_NODE ? LEFT_DRIVE_VESC : RIGHT_DRIVE_VESC) - VESC_FIRST_NODE;
+  if(handedValid[other] && handedSample[other] == sampled){
+    uint32_t skew = now - handedAt[other];
+    portENTER_CRITICAL(&txLock);
+    txStats.skew_count++;
+    txStats.last_skew_us = skew;
+    txStats.total_skew_us += skew;
+    if(skew > txStats.max_skew_us) txStats.max_skew_us = skew;
+    portEXIT_CRITICAL(&txLock);
+    //Each pair is counted once
+    handedValid[other] = false;
+    return;
+  }
+  handedSample[index] = sampled;
+  handedAt[index] = now;
+  handedValid[index] = true;
+}
+
+static esp_err_t hand_over(uint8_t index){
+  /* Hands the frame waiting in a mailbox to the driver without waiting for space in its TX queue. The mailbox is only emptied if the control
+  task did not put a newer frame in it meanwhile, that one waits for the next flush.
+    Arguments:
+      - uint8_t index: The mailbox
+    Returns:
+      - esp_err_t: twai_transmit()'s result, ESP_ERR_TIMEOUT if the driver's TX queue is full
+  */
+  portENTER_CRITICAL(&txLock);
+  twai_message_t frame = mailboxFrames[index];
+  uint8_t frameClass = mailboxClass[index];
+  uint32_t submitted = mailboxSubmitted[index];
+  uint32_t sampled = mailboxSampled[index];
+  bool measured = mailboxMeasured[index];
+  uint32_t version = mailboxVersion[index];
+  portEXIT_CRITICAL(&txLock);
+
+  esp_err_t result = twai_transmit(&frame, 0);
+  if(result == ESP_ERR_TIMEOUT){
+    //The driver's TX queue is full, the remaining frames wait in their mailboxes and may be superseded before the next flush
+    portENTER_CRITICAL(&txLock);
+    txStats.queue_full++;
+    portEXIT_CRITICAL(&txLock);
+    return result;
+  }
+
+  uint32_t now = micros();
+  uint32_t age = now - submitted;
+  portENTER_CRITICAL(&txLock);
+  TxMailboxStats *stats = &txStats.nodes[index];
+  if(result == ESP_OK){
+    stats->sent++;
+    stats->last_age_us = age;
+    if(age > stats->max_age_us) stats->max_age_us = age;
+    TxClassStats *classStats = &txStats.classes[frameClass];
+    classStats->sent++;
+    classStats->total_delay_us += age;
+    if(age > classStats->max_delay_us) classStats->max_delay_us = age;
+  }
+  else stats->errors++;
+  portEXIT_CRITICAL(&txLock);
+
+  if(result != ESP_OK){
+    //The driver is not running (e.g. during recovery), keep the frame
+    LOG_WARN("Could not transmit message No: %d", index);
+    return result;
+  }
+  portENTER_CRITICAL(&txLock);
+  if(mailboxVersion[index] == version){
+    mailboxPending[index] = false;
+    txStats.pending--;
+  }
+  lastSent[index] = frame;
+  lastSentAt[index] = now;
+  lastSentValid[index] = true;
+  portEXIT_CRITICAL(&txLock);
+  if(measured){
+    latency_record(index, sampled, now);
+    if(mailbox_class(index) == TX_CLASS_TRACTION) record_skew(index, sampled, now);
+  }
+  TRACE_TX(&frame);
+  recorder_frame(RECORDER_TX, &frame);
+  twai_stats_count(&frame, true);
+  LOG_DEBUG("Message No: %d, ID %x, data %02x %02x %02x %02x", index, frame.identifier, frame.data[0], frame.data[1], frame.data[2],
+            frame.data[3]);
+  return ESP_OK;
+}
+
+uint8_t tx_flush_due(uint8_t due){
+  /* Hands the waiting frames of the due mailboxes, and all frames of TX_CLASS_STOP, to the driver by class (see TWAI_tx.h) without waiting
+  for space in its TX queue. Within a class the drive motors go first, then the mailboxes in node order.
+    Arguments:
+      - uint8_t due: Bit i set if mailbox i may send
+    Returns:
+      - uint8_t: Number of frames handed to the driver
+  */
+  //msgs_to_tx includes the frame in the controller's TX buffer, which is not in the queue, so the room is at worst underestimated by one
+  uint8_t room = TWAI_TX_QUEUE_LEN;
+  twai_status_info_t status;
+  if(twai_get_status_info(&status) == ESP_OK) room = status.msgs_to_tx < room ? room - status.msgs_to_tx : 0;
+
+  //Only the TX task empties the mailboxes, a mailbox pending here still is when its turn comes
+  uint8_t pending = 0;
+  uint8_t classes[TX_MAILBOX_COUNT];
+  portENTER_CRITICAL(&txLock);
+  for(uint8_t index = 0; index < TX_MAILBOX_COUNT; index++){
+    if(mailboxPending[index]) pending |= 1 << index;
+    classes[index] = mailboxClass[index];
+  }
+  portEXIT_CRITICAL(&txLock);
+
+  uint8_t sent = 0;
+  for(uint8_t txClass = 0; txClass < TX_CLASS_COUNT; txClass++){
+    uint8_t members[TX_MAILBOX_COUNT];
+    uint8_t count = 0;
+    for(uint8_t order = TX_CLASS_TRACTION; order < TX_CLASS_COUNT; order++){
+      for(uint8_t index = 0; index < TX_MAILBOX_COUNT; index++){
+        if(!(pending >> index & 1) || classes[index] != txClass || mailbox_class(index) != order) continue;
+        if(due >> index & 1 || txClass == TX_CLASS_STOP) members[count++] = index;
+      }
+    }
+    if(count == 0) continue;
+    //The class waits as a whole for room in the queue, unless it does not even fit in the empty queue
+    if(count > room && room < TWAI_TX_QUEUE_LEN){
+      portENTER_CRITICAL(&txLock);
+      txStats.queue_full++;
+      portEXIT_CRITICAL(&txLock);
+      break;
+    }
+    for(uint8_t i = 0; i < count; i++){
+      if(hand_over(members[i]) != ESP_OK) return sent;
+      sent++;
+      if(room > 0) room--;
+    }
+  }
+  return sent;
+}
+
+uint8_t tx_flush(){
+  //Hands the waiting frames of all mailboxes to the driver
+  return tx_flush_due((1 << TX_MAILBOX_COUNT) - 1);
+}
+
+uint8_t tx_pending_mailboxes(){
+  //Bit i set if mailbox i holds a frame
+  uint8_t pending = 0;
+  portENTER_CRITICAL(&txLock);
+  for(uint8_t i = 0; i < TX_MAILBOX_COUNT; i++) if(mailboxPending[i]) pending |= 1 << i;
+  portEXIT_CRITICAL(&txLock);
+  return pending;
+}
+
+void tx_resend(){
+  /* Puts the last sent setpoint of every node back in its mailbox, unless a newer frame is waiting there. Called after the driver was
+  reinstalled, which discards the frames in its TX queue, so the VESCs get their setpoints without waiting for the keepalive.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  uint32_t now = micros();
+  portENTER_CRITICAL(&txLock);
+  for(int i = 0; i < TX_MAILBOX_COUNT; i++){
+    if(mailboxPending[i] || !lastSentValid[i]) continue;
+    mailboxFrames[i] = lastSent[i];
+    mailboxClass[i] = mailbox_class(i);
+    mailboxSubmitted[i] = now;
+    mailboxMeasured[i] = false;
+    mailboxPending[i] = true;
+    mailboxVersion[i]++;
+    txStats.pending++;
+  }
+  portEXIT_CRITICAL(&txLock);
+}
+
+TxStats get_tx_stats(){
+  TxStats stats;
+  portENTER_CRITICAL(&txLock);
+  stats = txStats;
+  portEXIT_CRITICAL(&txLock);
+  for(int i = 0; i < VESC_NODE_COUNT; i++) stats.nodes[i].node = VESC_FIRST_NODE + i;
+  stats.nodes[TX_ACTUATORS_MAILBOX].node = ACTUATORS_MESSAGE_ID;
+  twai_status_info_t status;
+  stats.driver_queue = twai_get_status_info(&status) == ESP_OK ? status.msgs_to_tx : 0;
+  return stats;
+}
+
+void print_tx_stats(){
+  /* This function prints the TX mailbox, class and drive motor skew statistics in the Serial Monitor
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  TxStats stats = get_tx_stats();
+  uint32_t unchanged = 0, submitted = 0;
+  for(int i = 0; i < TX_MAILBOX_COUNT; i++){
+    unchanged += stats.nodes[i].unchanged;
+    submitted += stats.nodes[i].submitted;
+  }
+  //Frames per second saved since the last print, or since the start for the first one
+  uint32_t now = millis();
+  float savedPerSecond = now != lastPrintTime ? (unchanged - lastPrintUnchanged) * 1000.0f / (now - lastPrintTime) : 0;
+  lastPrintUnchanged = unchanged;
+  lastPrintTime = now;
+
+  Serial.printf("TX: %u frames waiting in the mailboxes, %u in the driver queue, %u flushes stopped by a full queue, %u rejected\n",
+                stats.pending, stats.driver_queue, stats.queue_full, stats.rejected);
+  Serial.printf("TX: %u unchanged frames not sent (%.1f%% of the submitted ones), %.1f frames/s saved\n", unchanged,
+                submitted > 0 ? unchanged * 100.0f / submitted : 0, savedPerSecond);
+  for(int i = 0; i < TX_MAILBOX_COUNT; i++){
+    TxMailboxStats *node = &stats.nodes[i];
+    if(i == TX_ACTUATORS_MAILBOX) Serial.printf("  Actuators:");
+    else Serial.printf("  VESC %u:", node->node);
+    Serial.printf(" %u submitted, %u sent, %u superseded, %u unchanged, %u keepalive, %u errors, age last/max %u/%u us\n", node->submitted,
+                  node->sent, node->superseded, node->unchanged, node->keepalive, node->errors, node->last_age_us, node->max_age_us);
+  }
+  static const char *classNames[TX_CLASS_COUNT] = {"stop", "traction", "assembly", "actuator"};
+  for(int i = 0; i < TX_CLASS_COUNT; i++){
+    TxClassStats *txClass = &stats.classes[i];
+    Serial.printf("  Class %s: %u sent, queueing delay mean %u us, max %u us\n", classNames[i], txClass->sent,
+                  txClass->sent > 0 ? (uint32_t)(txClass->total_delay_us / txClass->sent) : 0, txClass->max_delay_us);
+  }
+  Serial.printf("TX: left/right drive skew over %u pairs: last %u us, mean %u us, max %u us\n", stats.skew_count, stats.last_skew_us,
+                stats.skew_count > 0 ? (uint32_t)(stats.total_skew_us / stats.skew_count) : 0, stats.max_skew_us);
+}
@@ -0,0 +1,77 @@
+#ifndef TWAI_TX_H
+#define TWAI_TX_H
+
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "config.h"
+
+/*TX mailboxes in front of twai_transmit() for the VESC setpoints and the actuators controller's command. Each VESC node and the actuators
+controller has one mailbox that only keeps the newest frame: a frame submitted while the previous one is still waiting replaces it (the old
+one is superseded and counted). tx_flush_due() hands the waiting frames of the due mailboxes to the driver without waiting, frames that do
+not fit in the driver's TX queue stay in their mailbox for the next flush. The TX schedule (TWAI_schedule.h) decides when a mailbox is due.
+A congested bus therefore never blocks the control task, and a motor's next frame on the bus is always its latest setpoint.
+
+Transmission is change driven: a frame that only repeats the node's last sent setpoint is dropped by tx_submit(), unless the last frame
+was sent TX_KEEPALIVE_MS or longer ago. A new setpoint still goes out in the mailbox's next slot, and a standing one is refreshed often
+enough that the VESC does not time out and stop the motor. With the joystick centered or in configure mode the bus then carries 10 instead
+of 100 frames per second per VESC.
+
+The ESP32's controller has a single TX buffer that the driver fills from its queue in order, so the order of the handoff is the order on
+the bus whatever the identifiers. tx_flush_due() hands the frames over by class (TX_CLASS): stops first, then the drive motors, the assemblies
+and last the actuators controller. A frame whose payload is all zero while the last sent one was not (RPM 0, actuator stop) stops its node
+and goes out in TX_CLASS_STOP. The frames of a class are handed over together: if the driver's queue cannot take all of them, the class
+waits for the next flush, so the left and right drive motors get the setpoints of one sample back to back. Lower classes wait behind
+higher ones, which send at most one frame per node and control period.*/
+#define TWAI_TX_QUEUE_LEN 5       // Driver TX queue, one frame per VESC. Frames in it can no longer be replaced, so it is kept short
+#define TX_KEEPALIVE_MS 100       // Unchanged setpoints are resent at this interval, keep it well below VESC_CAN_TIMEOUT_MS
+#define TX_MAILBOX_COUNT (VESC_NODE_COUNT + 1)
+#define TX_ACTUATORS_MAILBOX VESC_NODE_COUNT
+
+enum TX_CLASS{
+  TX_CLASS_STOP,            // Frames that stop a motor or an actuator
+  TX_CLASS_TRACTION,        // RIGHT_DRIVE_VESC and LEFT_DRIVE_VESC
+  TX_CLASS_ASSEMBLY,        // The other VESCs
+  TX_CLASS_ACTUATOR,        // Actuators controller and diagnostics
+  TX_CLASS_COUNT
+};
+
+struct TxMailboxStats{
+  uint8_t node;             // VESC node, or ACTUATORS_MESSAGE_ID for TX_ACTUATORS_MAILBOX
+  uint32_t submitted;
+  uint32_t sent;            // Frames handed to the driver
+  uint32_t superseded;      // Frames replaced by a newer one before they were sent
+  uint32_t unchanged;       // Frames dropped because they repeated the last sent setpoint within TX_KEEPALIVE_MS
+  uint32_t keepalive;       // Unchanged frames sent to refresh the setpoint
+  uint32_t errors;          // twai_transmit() failures other than a full TX queue
+  uint32_t last_age_us;     // Time from submission to the driver for the last sent frame
+  uint32_t max_age_us;
+};
+
+struct TxClassStats{
+  uint32_t sent;
+  uint64_t total_delay_us;  // Time from submission to the driver
+  uint32_t max_delay_us;
+};
+
+struct TxStats{
+  TxMailboxStats nodes[TX_MAILBOX_COUNT];
+  TxClassStats classes[TX_CLASS_COUNT];
+  uint32_t rejected;        // Frames submitted for a node without a mailbox
+  uint32_t queue_full;      // Flushes that stopped because the driver's TX queue was full
+  uint8_t pending;          // Frames waiting in the mailboxes
+  uint32_t driver_queue;    // Frames waiting in the driver's TX queue (msgs_to_tx)
+  uint32_t skew_count;      // Pairs of drive motor frames of the same joystick sample
+  uint32_t last_skew_us;    // Time between the handoff of the left and the right drive motor's frame
+  uint32_t max_skew_us;
+  uint64_t total_skew_us;
+};
+
+bool tx_submit(const twai_message_t *message, uint32_t sampled_at);
+uint8_t tx_flush_due(uint8_t due);
+uint8_t tx_flush();
+uint8_t tx_pending_mailboxes();
+void tx_resend();
+TxStats get_tx_stats();
+void print_tx_stats();
+
+#endif
@@ -0,0 +1,119 @@
+#include "Task_timing.h"
+
+PeriodicTimer::PeriodicTimer(Clock *clock, uint32_t period_us){
+  this->clock = clock;
+  this->period = period_us;
+  this->next_release = 0;
+  this->cycle_start = 0;
+  reset_stats();
+}
+
+void PeriodicTimer::begin(){
+  /* Anchors the schedule at the current time. Call once right before the first iteration of the task.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  this->next_release = this->clock->now_us();
+  this->cycle_start = this->next_release;
+}
+
+void PeriodicTimer::wait_for_next_period(){
+  /* Blocks until the start of the next period (vTaskDelayUntil-style, the schedule does not drift with the execution time) and updates the
+  timing statistics. If the iteration overran, it returns immediately and drops the periods that were missed completely, so the task
+  gets back in phase instead of running a burst of late iterations.
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  uint32_t now = this->clock->now_us();
+  uint32_t busy = now - this->cycle_start;
+  this->stats.last_busy = busy;
+  if(busy > this->stats.max_busy) this->stats.max_busy = busy;
+
+  this->next_release += this->period;
+  if((int32_t)(now - this->next_release) >= 0){
+    uint32_t missed = (now - this->next_release) / this->period;
+    this->stats.overruns++;
+    this->stats.skipped += missed;
+    this->next_release += missed * this->period;
+  }
+  else{
+    this->clock->sleep_until_us(this->next_release);
+  }
+
+  uint32_t woke = this->clock->now_us();
+  int32_t jitter = (int32_t)(woke - this->next_release);
+  if(this->stats.cycles == 0 || jitter < this->stats.min_jitter) this->stats.min_jitter = jitter;
+  if(this->stats.cycles == 0 || jitter > this->stats.max_jitter) this->stats.max_jitter = jitter;
+  this->stats.total_jitter += jitter;
+  this->stats.cycles++;
+  this->cycle_start = woke;
+}
+
+void PeriodicTimer::set_period(uint32_t period_us){
+  this->period = period_us;
+  this->stats.period = period_us;
+}
+
+uint32_t PeriodicTimer::get_period(){
+  return this->period;
+}
+
+TaskTimingStats PeriodicTimer::get_stats(){
+  return this->stats;
+}
+
+void PeriodicTimer::reset_stats(){
+  this->stats.period = this->period;
+  this->stats.cycles = 0;
+  this->stats.overruns = 0;
+  this->stats.skipped = 0;
+  this->stats.min_jitter = 0;
+  this->stats.max_jitter = 0;
+  this->stats.total_jitter = 0;
+  this->stats.max_busy = 0;
+  this->stats.last_busy = 0;
+}
+
+#ifdef ESP_PLATFORM
+EspTimerClock::EspTimerClock(){
+  this->timer = NULL;
+  this->waiting_task = NULL;
+}
+
+void EspTimerClock::on_timer(void *arg){
+  EspTimerClock *clock = (EspTimerClock *)arg;
+  if(clock->waiting_task != NULL) xTaskNotifyGive(clock->waiting_task);
+}
+
+uint32_t EspTimerClock::now_us(){
+  return (uint32_t)esp_timer_get_time();
+}
+
+void EspTimerClock::sleep_until_us(uint32_t wake_time){
+  /* Sleeps the calling task until wake_time. The timer is created on first use, so the clock can be a global object.
+    Arguments:
+      - uint32_t wake_time: Absolute wake up time in microseconds, in the esp_timer time base
+    Returns:
+      - void
+  */
+  if(this->timer == NULL){
+    esp_timer_create_args_t args = {};
+    args.callback = &EspTimerClock::on_timer;
+    args.arg = this;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "task_clock";
+    esp_timer_create(&args, &this->timer);
+  }
+  int32_t remaining = (int32_t)(wake_time - now_us());
+  if(remaining <= 0) return;
+
+  this->waiting_task = xTaskGetCurrentTaskHandle();
+  ulTaskNotifyTake(pdTRUE, 0);  // Drop a stale notification from a previous timeout
+  esp_timer_start_once(this->timer, remaining);
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+#endif
@@ -0,0 +1,64 @@
+#ifndef TASK_TIMING_H
+#define TASK_TIMING_H
+
+#include <stdint.h>
+
+//Time source used by the periodic task timer. The ESP32 implementation is EspTimerClock, a Linux host can provide its own (e.g. a fake clock).
+class Clock{
+  public:
+  virtual uint32_t now_us() = 0;
+  virtual void sleep_until_us(uint32_t wake_time) = 0;
+};
+
+//Timing statistics of a periodic task. All times are in microseconds.
+struct TaskTimingStats{
+  uint32_t period;
+  uint32_t cycles;
+  uint32_t overruns;        // Iterations that were still running when the next period should have started
+  uint32_t skipped;         // Periods dropped to get back in phase after an overrun
+  int32_t min_jitter;       // Release time jitter (actual wake up - scheduled wake up)
+  int32_t max_jitter;
+  int64_t total_jitter;
+  uint32_t max_busy;        // Longest time spent working within one period
+  uint32_t last_busy;
+};
+
+class PeriodicTimer{
+  private:
+  Clock *clock;
+  uint32_t period;
+  uint32_t next_release;
+  uint32_t cycle_start;
+  TaskTimingStats stats;
+
+  public:
+  PeriodicTimer(Clock *clock, uint32_t period_us);
+  void begin();
+  void wait_for_next_period();
+  void set_period(uint32_t period_us);
+  uint32_t get_period();
+  TaskTimingStats get_stats();
+  void reset_stats();
+};
+
+#ifdef ESP_PLATFORM
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+//Clock backed by esp_timer. Sleeping arms a one shot hardware timer that notifies the sleeping task, which gives microsecond release accuracy
+//instead of the FreeRTOS tick resolution.
+class EspTimerClock : public Clock{
+  private:
+  esp_timer_handle_t timer;
+  TaskHandle_t waiting_task;
+  static void on_timer(void *arg);
+
+  public:
+  EspTimerClock();
+  uint32_t now_us();
+  void sleep_until_us(uint32_t wake_time);
+};
+#endif
+
+#endif
@@ -0,0 +1,141 @@
+#include "Trace.h"
+#ifdef ESP_PLATFORM
+#include "esp_timer.h"
+#endif
+
+static uint64_t trace_time_us(){
+#ifdef ESP_PLATFORM
+  return esp_timer_get_time();
+#else
+  return micros();
+#endif
+}
+
+static void trace_write(const TraceRecord *record){
+  char line[TRACE_LINE_LENGTH];
+  if(trace_format(record, line, sizeof(line)) > 0) Serial.println(line);
+}
+
+void trace_adc(int x, int y){
+  /* Records a joystick ADC sample, if it differs from the previous one. Only called from the control task.
+    Arguments:
+      - int x: Raw value of the horizontal axis
+      - int y: Raw value of the vertical axis
+    Returns:
+      - void
+  */
+  static int last_x = -1, last_y = -1;
+  if(x == last_x && y == last_y) return;
+  last_x = x;
+  last_y = y;
+
+  TraceRecord record = {};
+  record.type = 'A';
+  record.time = trace_time_us();
+  record.values[0] = x;
+  record.values[1] = y;
+  trace_write(&record);
+}
+
+void trace_buttons(uint8_t buttons){
+  /* Records the button levels, if they changed. Only called from the control task.
+    Arguments:
+      - uint8_t buttons: Button levels, bit 0 = BTN1 ... bit 3 = BTN4
+    Returns:
+      - void
+  */
+  static int last_buttons = -1;
+  if(buttons == last_buttons) return;
+  last_buttons = buttons;
+
+  TraceRecord record = {};
+  record.type = 'B';
+  record.time = trace_time_us();
+  record.values[0] = buttons;
+  trace_write(&record);
+}
+
+void trace_frame(char type, const twai_message_t *message){
+  /* Records a received ('R') or transmitted ('T') TWAI frame
+    Arguments:
+      - char type: 'R' or 'T'
+      - const twai_message_t *message: The frame
+    Returns:
+      - void
+  */
+  TraceRecord record = {};
+  record.type = type;
+  record.time = trace_time_us();
+  record.frame = *message;
+  trace_write(&record);
+}
+
+int trace_format(const TraceRecord *record, char *line, size_t size){
+  /* Formats a trace record as a text line (without line ending)
+    Arguments:
+      - const TraceRecord *record: The record
+      - char *line: Buffer for the line, TRACE_LINE_LENGTH characters are always enough
+      - size_t size: Size of the buffer
+    Returns:
+      - int: Length of the line, or -1 if the record's type is unknown
+  */
+  unsigned long long time = record->time;
+  if(record->type == 'A') return snprintf(line, size, "@A %llu %d %d", time, (int)record->values[0], (int)record->values[1]);
+  if(record->type == 'B') return snprintf(line, size, "@B %llu %d", time, (int)record->values[0]);
+  if(record->type != 'R' && record->type != 'T') return -1;
+
+  const twai_message_t *frame = &record->frame;
+  uint8_t dlc = frame->data_length_code > TWAI_FRAME_MAX_DLC ? TWAI_FRAME_MAX_DLC : frame->data_length_code;
+  int length = snprintf(line, size, "@%c %llu %x %x %u ", record->type, time, (unsigned int)frame->identifier, (unsigned int)frame->flags,
+                        (unsigned int)frame->data_length_code);
+  if(dlc == 0) return length + snprintf(line + length, size - length, "-");
+  for(int i = 0; i < dlc; i++) length += snprintf(line + length, size - length, "%02x", frame->data[i]);
+  return length;
+}
+
+bool trace_parse(const char *line, TraceRecord *record){
+  /* Parses a trace line. Lines that are not trace records (e.g. other serial output) are rejected.
+    Arguments:
+      - const char *line: The line
+      - TraceRecord *record: The parsed record
+    Returns:
+      - bool: true if the line is a valid trace record
+  */
+  char type;
+  unsigned long long time;
+  int consumed = 0;
+  if(sscanf(line, " @%c %llu%n", &type, &time, &consumed) != 2) return false;
+  memset(record, 0, sizeof(TraceRecord));
+  record->type = type;
+  record->time = time;
+  const char *rest = line + consumed;
+
+  if(type == 'A'){
+    int x, y;
+    if(sscanf(rest, "%d %d", &x, &y) != 2) return false;
+    record->values[0] = x;
+    record->values[1] = y;
+    return true;
+  }
+  if(type == 'B'){
+    int buttons;
+    if(sscanf(rest, "%d", &buttons) != 1) return false;
+    record->values[0] = buttons;
+    return true;
+  }
+  if(type != 'R' && type != 'T') return false;
+
+  unsigned int identifier, flags, dlc;
+  char data[2 * TWAI_FRAME_MAX_DLC + 1];
+  if(sscanf(rest, "%x %x %u %16s", &identifier, &flags, &dlc, data) != 4) return false;
+  record->frame.identifier = identifier;
+  record->frame.flags = flags;
+  record->frame.data_length_code = dlc;
+  if(data[0] == '-') return true;
+  for(unsigned int i = 0; i < dlc && i < TWAI_FRAME_MAX_DLC; i++){
+    unsigned int byte;
+    if(sscanf(data + 2 * i, "%2x", &byte) != 1) return false;
+    record->frame.data[i] = byte;
+  }
+  return true;
+}
@@ -0,0 +1,42 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <Arduino.h>
+#include "driver/twai.h"
+
+/*Trace of the controller's inputs and outputs, for replaying field recordings on a host (see src/native/replay.cpp). Records are text lines
+on the serial port, mixed with the normal output:
+  @A <time> <x> <y>                             Joystick ADC sample
+  @B <time> <buttons>                           Button levels, bit 0 = BTN1 ... bit 3 = BTN4
+  @R <time> <identifier> <flags> <dlc> <data>   Received TWAI frame, identifier/flags/data in hex
+  @T <time> <identifier> <flags> <dlc> <data>   Transmitted TWAI frame
+Times are in microseconds since boot. The probes compile to nothing unless ENABLE_TRACE is defined (see the WheelchairControls_trace
+environment).*/
+#ifdef ENABLE_TRACE
+#define TRACE_ADC(x, y) trace_adc(x, y)
+#define TRACE_BUTTONS(buttons) trace_buttons(buttons)
+#define TRACE_RX(message) trace_frame('R', message)
+#define TRACE_TX(message) trace_frame('T', message)
+#else
+#define TRACE_ADC(x, y) do{}while(0)
+#define TRACE_BUTTONS(buttons) do{}while(0)
+#define TRACE_RX(message) do{}while(0)
+#define TRACE_TX(message) do{}while(0)
+#endif
+
+#define TRACE_LINE_LENGTH 64
+
+struct TraceRecord{
+  char type;              // 'A', 'B', 'R' or 'T'
+  uint64_t time;
+  int32_t values[2];      // ADC sample (x, y) or button levels (values[0])
+  twai_message_t frame;
+};
+
+void trace_adc(int x, int y);
+void trace_buttons(uint8_t buttons);
+void trace_frame(char type, const twai_message_t *message);
+int trace_format(const TraceRecord *record, char *line, size_t size);
+bool trace_parse(const char *line, TraceRecord *record);
+
+#endif
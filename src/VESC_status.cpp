@@ -0,0 +1,167 @@
+#include "VESC_status.h"
+#include "TWAI_handler.h"
+#include "Log.h"
+
+Seqlock<VescTelemetry> vescTelemetry[VESC_NODE_COUNT];
+
+// Local copies of the published telemetry, only accessed by the RX task
+static VescTelemetry received[VESC_NODE_COUNT];
+// Last drive motor telemetry read by vesc_speed_kph(), only accessed by the control task
+static VescTelemetry driveTelemetry[2] = {};
+
+static int32_t get_int32(const uint8_t *data){
+  return (int32_t)((uint32_t)data[0] << 24 | (uint32_t)data[1] << 16 | (uint32_t)data[2] << 8 | data[3]);
+}
+
+static float get_scaled16(const uint8_t *data, float scale){
+  return (int16_t)(data[0] << 8 | data[1]) / scale;
+}
+
+static float get_scaled32(const uint8_t *data, float scale){
+  return get_int32(data) / scale;
+}
+
+static VescTelemetry *begin_update(const twai_message_t *message){
+  /* Finds the telemetry of the VESC that sent a status packet
+    Arguments:
+      - const twai_message_t *message: The status packet, its identifier's low byte is the VESC node
+    Returns:
+      - VescTelemetry *: The VESC's local telemetry, NULL if the node is not one of ours or the packet is too short
+  */
+  uint8_t index = (message->identifier & 0xFF) - VESC_FIRST_NODE;
+  if(index >= VESC_NODE_COUNT || message->data_length_code < 8){
+    LOG_DEBUG("Ignored VESC status packet %x, %d bytes", message->identifier, message->data_length_code);
+    return NULL;
+  }
+  return &received[index];
+}
+
+static void end_update(VescTelemetry *telemetry, uint8_t status){
+  //Timestamps the decoded packet and publishes the VESC's telemetry
+  telemetry->received_at[status] = micros();
+  telemetry->received |= 1 << status;
+  vescTelemetry[telemetry - received].write(*telemetry);
+}
+
+static void decode_status_1(const twai_message_t *message, void *context){
+  VescTelemetry *telemetry = begin_update(message);
+  if(telemetry == NULL) return;
+  telemetry->erpm = get_int32(&message->data[0]);
+  telemetry->current = get_scaled16(&message->data[4], 10);
+  telemetry->duty = get_scaled16(&message->data[6], 1000);
+  end_update(telemetry, VESC_STATUS_1);
+}
+
+static void decode_status_2(const twai_message_t *message, void *context){
+  VescTelemetry *telemetry = begin_update(message);
+  if(telemetry == NULL) return;
+  telemetry->amp_hours = get_scaled32(&message->data[0], 10000);
+  telemetry->amp_hours_charged = get_scaled32(&message->data[4], 10000);
+  end_update(telemetry, VESC_STATUS_2);
+}
+
+static void decode_status_3(const twai_message_t *message, void *context){
+  VescTelemetry *telemetry = begin_update(message);
+  if(telemetry == NULL) return;
+  telemetry->watt_hours = get_scaled32(&message->data[0], 10000);
+  telemetry->watt_hours_charged = get_scaled32(&message->data[4], 10000);
+  end_update(telemetry, VESC_STATUS_3);
+}
+
+static void decode_status_4(const twai_message_t *message, void *context){
+  VescTelemetry *telemetry = begin_update(message);
+  if(telemetry == NULL) return;
+  telemetry->temp_fet = get_scaled16(&message->data[0], 10);
+  telemetry->temp_motor = get_scaled16(&message->data[2], 10);
+  telemetry->current_in = get_scaled16(&message->data[4], 10);
+  telemetry->pid_pos = get_scaled16(&message->data[6], 50);
+  end_update(telemetry, VESC_STATUS_4);
+}
+
+static void decode_status_5(const twai_message_t *message, void *context){
+  VescTelemetry *telemetry = begin_update(message);
+  if(telemetry == NULL) return;
+  telemetry->tachometer = get_int32(&message->data[0]);
+  telemetry->v_in = get_scaled16(&message->data[4], 10);
+  end_update(telemetry, VESC_STATUS_5);
+}
+
+static void decode_status_6(const twai_message_t *message, void *context){
+  VescTelemetry *telemetry = begin_update(message);
+  if(telemetry == NULL) return;
+  telemetry->adc[0] = get_scaled16(&message->data[0], 1000);
+  telemetry->adc[1] = get_scaled16(&message->data[2], 1000);
+  telemetry->adc[2] = get_scaled16(&message->data[4], 1000);
+  telemetry->ppm = get_scaled16(&message->data[6], 1000);
+  end_update(telemetry, VESC_STATUS_6);
+}
+
+const VescStatusPacket vescStatusPackets[VESC_STATUS_COUNT] = {
+  {CAN_PACKET_STATUS, decode_status_1, "VESC status 1"},
+  {CAN_PACKET_STATUS_2, decode_status_2, "VESC status 2"},
+  {CAN_PACKET_STATUS_3, decode_status_3, "VESC status 3"},
+  {CAN_PACKET_STATUS_4, decode_status_4, "VESC status 4"},
+  {CAN_PACKET_STATUS_5, decode_status_5, "VESC status 5"},
+  {CAN_PACKET_STATUS_6, decode_status_6, "VESC status 6"}
+};
+
+bool vesc_status_fresh(const VescTelemetry *telemetry, uint8_t status, uint32_t now){
+  /* Checks whether a status packet's values are recent
+    Arguments:
+      - const VescTelemetry *telemetry: The VESC's telemetry
+      - uint8_t status: The VESC_STATUS packet
+      - uint32_t now: Current micros()
+    Returns:
+      - bool: true if the packet was received within VESC_TELEMETRY_TIMEOUT_MS
+  */
+  if(!(telemetry->received & (1 << status))) return false;
+  return now - telemetry->received_at[status] < (uint32_t)VESC_TELEMETRY_TIMEOUT_MS * 1000;
+}
+
+float vesc_speed_kph(uint32_t now){
+  /* Calculates the wheelchair's speed from the drive motors' ERPM. Called by the control task, which preempts the RX task writing the
+  telemetry on the same core: a read that caught a write in progress keeps the previous copy instead of waiting for it.
+    Arguments:
+      - uint32_t now: Current micros()
+    Returns:
+      - float: The mean speed of the two drive wheels in km/h, 0 if neither drive VESC reported its ERPM recently
+  */
+  const uint8_t driveNodes[2] = {RIGHT_DRIVE_VESC, LEFT_DRIVE_VESC};
+  float erpm = 0;
+  uint8_t wheels = 0;
+  for(int i = 0; i < 2; i++){
+    vescTelemetry[driveNodes[i] - VESC_FIRST_NODE].try_read(driveTelemetry[i]);
+    if(!vesc_status_fresh(&driveTelemetry[i], VESC_STATUS_1, now)) continue;
+    erpm += abs(driveTelemetry[i].erpm);
+    wheels++;
+  }
+  if(wheels == 0) return 0;
+  float wheelRpm = erpm / wheels / DRIVE_MOTOR_POLE_PAIRS / DRIVE_GEAR_RATIO;
+  return wheelRpm * PI * WHEEL_DIAMETER_M * 60 / 1000;
+}
+
+void print_vesc_telemetry(){
+  /* This function prints the VESCs' telemetry in the Serial Monitor
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  uint32_t now = micros();
+  for(int i = 0; i < VESC_NODE_COUNT; i++){
+    VescTelemetry telemetry = vescTelemetry[i].read();
+    if(telemetry.received == 0){
+      Serial.printf("VESC %d: no status received\n", VESC_FIRST_NODE + i);
+      continue;
+    }
+    Serial.printf("VESC %d: %d ERPM, %.1f A, duty %.3f, %.1f V in, %.1f A in, FET %.1f C, motor %.1f C, tachometer %d, status packets",
+                  VESC_FIRST_NODE + i, telemetry.erpm, telemetry.current, telemetry.duty, telemetry.v_in, telemetry.current_in,
+                  telemetry.temp_fet, telemetry.temp_motor, telemetry.tachometer);
+    //Age of each status packet, "-" if it was never received
+    for(int status = 0; status < VESC_STATUS_COUNT; status++){
+      if(telemetry.received & (1 << status)) Serial.printf(" %u", (now - telemetry.received_at[status]) / 1000);
+      else Serial.print(" -");
+    }
+    Serial.println(" ms old");
+  }
+}
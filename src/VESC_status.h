@@ -0,0 +1,62 @@
+#ifndef VESC_STATUS_H
+#define VESC_STATUS_H
+
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "config.h"
+#include "Seqlock.h"
+#include "TWAI_dispatch.h"
+
+/*Telemetry of the VESCs. With status messages enabled in their CAN settings, the VESCs periodically send up to six status packets
+(CAN_PACKET_STATUS to CAN_PACKET_STATUS_6, see "https://github.com/vedderb/bldc/blob/master/documentation/comm_can.md"). The RX task decodes
+them into a fixed array with one entry per VESC and publishes the VESC's entry through its Seqlock. Each packet's values come with the
+micros() time the packet was received.*/
+#define VESC_STATUS_COUNT 6
+#define VESC_TELEMETRY_TIMEOUT_MS 500     // Values older than this are stale
+
+//Status packets, index in VescTelemetry::received_at
+enum VESC_STATUS{
+  VESC_STATUS_1,              // ERPM, current, duty cycle
+  VESC_STATUS_2,              // Amp hours
+  VESC_STATUS_3,              // Watt hours
+  VESC_STATUS_4,              // Temperatures, input current, PID position
+  VESC_STATUS_5,              // Tachometer, input voltage
+  VESC_STATUS_6               // ADC and PPM inputs
+};
+
+struct VescTelemetry{
+  int32_t erpm;
+  float current;              // Motor current, A
+  float duty;                 // -1 to 1
+  float amp_hours;
+  float amp_hours_charged;
+  float watt_hours;
+  float watt_hours_charged;
+  float temp_fet;             // Degrees Celsius
+  float temp_motor;
+  float current_in;           // Input current, A
+  float pid_pos;              // Degrees
+  int32_t tachometer;         // 6 steps per electrical revolution
+  float v_in;                 // Input voltage, V
+  float adc[3];               // V
+  float ppm;                  // -1 to 1
+  uint32_t received_at[VESC_STATUS_COUNT];
+  uint8_t received;           // Bit per VESC_STATUS, set once the packet was received
+};
+
+struct VescStatusPacket{
+  uint8_t command;            // COMMAND_ID of the packet
+  FrameDecoder decoder;
+  const char *name;
+};
+
+//Decoders of the status packets, registered for every VESC by rx_begin()
+extern const VescStatusPacket vescStatusPackets[VESC_STATUS_COUNT];
+//Telemetry per VESC, index = node - VESC_FIRST_NODE
+extern Seqlock<VescTelemetry> vescTelemetry[VESC_NODE_COUNT];
+
+bool vesc_status_fresh(const VescTelemetry *telemetry, uint8_t status, uint32_t now);
+float vesc_speed_kph(uint32_t now);
+void print_vesc_telemetry();
+
+#endif
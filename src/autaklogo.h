@@ -1,606 +1,606 @@
-#ifndef AUTAKLOGO_H
-#define AUTAKLOGO_H
- 
-const uint16_t autaklogo[] PROGMEM = {0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf0cb,0xf10b,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf12c,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf290,
-0xf75d,0xf7de,0xf5d9,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf18d,0xf69b,0xf7de,0xf6fc,0xf22e,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf14c,0xf2d0,0xf1ad,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0cb,0xf73d,
-0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf557,0xffff,0xffff,0xffff,0xf69b,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf20e,0xf77d,0xf7ff,0xf7de,0xf372,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1ad,0xffff,
-0xffff,0xffff,0xffff,0xf5d9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf6db,0xffff,0xffff,0xffff,0xf7de,0xf0cb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf578,0xffff,0xffff,0xffff,0xf73d,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
-0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf10b,0xf14c,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
-0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf3d3,0xf7be,0xf7de,0xf557,0xf0ca,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
-0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf18d,0xf7de,0xffff,0xffff,0xffff,0xf351,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
-0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2d0,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
-0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
-0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
-0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
-0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
-0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf14c,0xf1ad,0xf18d,0xf0eb,0xf0aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
-0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf0cb,0xf14c,0xf1ad,0xf18d,
-0xf0eb,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf1cd,0xf16c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf16c,0xf3f3,0xf61a,0xf79e,0xffdf,0xffff,0xffff,0xffde,0xf6fc,0xf517,
-0xf290,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
-0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf18d,0xf434,0xf65a,0xf79e,0xffff,0xffff,0xffff,
-0xf7de,0xf6bb,0xf4d6,0xf24f,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf0cb,0xf557,0xffff,0xf7be,0xf331,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf12c,0xf4d6,0xf7be,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xf69b,0xf28f,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
-0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf16d,0xf578,0xf69b,0xf69b,
-0xf6fc,0xffff,0xffff,0xffff,0xffff,0xf75d,0xf69b,0xf69b,0xf69b,0xf69b,0xf65a,0xf3b3,0xf0aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf16c,0xf537,0xf7de,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xf61a,0xf22e,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0ca,0xf557,0xffff,0xffff,0xffff,0xf77d,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf24f,0xf71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xf7de,0xf4b6,0xf0cb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
-0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf61a,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf2d0,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf2d0,0xf75d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xf7be,0xf414,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf0aa,0xf537,0xffff,0xffff,0xffff,0xffff,0xffff,0xf1ad,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf2f1,0xf7be,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xf5b9,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
-0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf0cb,0xf7de,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf495,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf3b2,0xf7de,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7ff,0xf517,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,
-0xf517,0xffff,0xffff,0xffff,0xffff,0xffff,0xf71c,0xf0cb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf28f,0xf7be,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf7be,0xf7de,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xf578,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf18d,0xffff,
-0xffff,0xffff,0xffff,0xf63a,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf0aa,0xf71c,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf3d3,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf331,0xf7de,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffde,0xf7be,0xffde,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf4b6,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf516,
-0xf7ff,0xffff,0xffff,0xffff,0xffff,0xf77d,0xf22e,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf16c,0xf75d,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7de,0xf557,0xf2d0,0xf14c,0xf0ca,0xf0eb,0xf1ee,0xf3d3,0xf6dc,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf3f3,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf12c,0xffdf,
-0xffff,0xffff,0xffff,0xf6fc,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf6fc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf2f1,0xf79e,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7ff,0xf61a,0xf0eb,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf1ee,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7be,0xf4f6,0xf290,0xf12c,0xf0ca,0xf0eb,
-0xf20e,0xf434,0xf71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf331,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf4f6,0xf7ff,
-0xffff,0xffff,0xffff,0xffff,0xf77d,0xf24f,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,
-0xf598,0xf7ff,0xffff,0xffff,0xffff,0xffff,0xf6bb,0xf20e,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0cb,
-0xf434,0xf7de,0xffff,0xffff,0xffff,0xffff,0xf7be,0xf1ad,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf77d,
-0xffff,0xffff,0xffff,0xf7de,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf0aa,0xf77d,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf10b,0xf1cd,0xf1cd,
-0xf3b3,0xffff,0xffff,0xffff,0xffff,0xf557,0xf1cd,0xf1cd,0xf1cd,0xf1cd,0xf18d,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf0aa,0xf65a,0xffff,0xffff,0xffff,0xffff,0xffff,0xf63a,0xf1ad,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf0eb,0xf4d6,0xffdf,0xffff,0xffff,0xffff,0xffff,0xf75d,0xf12c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf4d6,0xf7ff,0xffff,
-0xffff,0xffff,0xffff,0xf79d,0xf24f,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf24f,
-0xf7de,0xffff,0xffff,0xffff,0xffff,0xf63a,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf0aa,0xf331,0xf7de,0xffff,0xffff,0xffff,0xffff,0xf578,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf65a,
-0xffff,0xffff,0xffff,0xffff,0xf311,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf1ee,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf331,0xffff,0xffff,0xffff,0xffff,0xffff,0xf598,0xf0cb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf3f3,0xffdf,0xffff,0xffff,0xffff,0xffff,0xf4b6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf4b5,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xf79e,0xf26f,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf5b8,
-0xffff,0xffff,0xffff,0xffff,0xf71c,0xf12c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf414,0xffff,0xffff,0xffff,0xffff,0xf7de,0xf1ad,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf495,
-0xffff,0xffff,0xffff,0xffff,0xf619,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf4d6,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf67a,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf4f6,0xffff,0xffff,0xffff,0xffff,0xf79e,0xf12c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf0aa,0xf495,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xf79e,0xf28f,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf14c,0xf7de,
-0xffff,0xffff,0xffff,0xffff,0xf2d0,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf0ca,0xf67b,0xffff,0xffff,0xffff,0xffff,0xf475,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf26f,
-0xffff,0xffff,0xffff,0xffff,0xf7ff,0xf352,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf24f,0xf7be,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf20e,0xffdf,0xffff,0xffff,0xffff,0xf7de,0xf20e,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0eb,0xf71c,0xffff,0xffff,0xffff,0xffff,0xf392,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf0aa,0xf475,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xf7be,0xf2b0,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf372,0xffff,
-0xffff,0xffff,0xffff,0xf63a,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf69b,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,
-0xf6db,0xffff,0xffff,0xffff,0xffff,0xf79e,0xf2b0,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf24f,0xf75d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf434,0xffff,0xffff,0xffff,0xffff,0xf578,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf3b3,0xffff,0xffff,0xffff,0xffff,0xf5d9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf0aa,0xf454,0xf7df,0xffff,0xffff,0xffff,0xffff,0xf7be,
-0xf2b0,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf537,0xffff,
-0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf0cb,0xf75d,0xffff,0xffff,0xffff,0xffde,0xf12c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf352,0xf7df,0xffff,0xffff,0xffff,0xffff,0xf7de,0xf4d6,0xf18d,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf16c,0xf495,
-0xf7be,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf5f9,0xffff,0xffff,0xffff,0xf7ff,0xf2b0,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf12c,0xf7be,0xffff,0xffff,0xffff,0xf77d,0xf0ca,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf434,0xffdf,0xffff,0xffff,0xffff,0xffff,0xf7be,0xf2d0,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf67a,0xffff,
-0xffff,0xffff,0xf7de,0xf16c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf578,0xffff,0xffff,0xffff,0xffff,0xf28f,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf0aa,0xf63a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7de,0xf67a,0xf537,0xf4d6,0xf537,0xf65a,0xf7de,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf0aa,0xf73d,0xffff,0xffff,0xffff,0xf79e,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf63a,0xffff,0xffff,0xffff,0xffff,0xf1ad,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf475,0xf7df,0xffff,0xffff,0xffff,0xffff,0xf7be,0xf2d1,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf75d,0xffff,
-0xffff,0xffff,0xf75d,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf414,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf1ad,0xf75d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf0eb,0xffde,0xffff,0xffff,0xffff,0xf67a,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf4f6,0xffff,0xffff,0xffff,0xffff,0xf2b0,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf7be,0xffff,
-0xffff,0xffff,0xf69b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf372,0xffff,0xffff,0xffff,0xffff,0xf414,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf22e,0xf75d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xf75d,0xf77d,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf16c,0xffff,0xffff,0xffff,0xffff,0xf5b9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf434,0xffff,0xffff,0xffff,0xffff,0xf331,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0xf1ee,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0ca,0xffde,0xffff,
-0xffff,0xffff,0xf65a,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf331,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf0aa,0xf1cd,0xf67a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xf7ff,0xf67b,0xf1cd,0xf619,0xffff,0xffff,0xffff,0xf73d,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf18d,0xf7ff,0xffff,0xffff,0xffff,0xf598,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf414,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf69b,0xf0eb,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf7be,0xffff,
-0xffff,0xffff,0xf6bb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf392,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0cb,0xf392,0xf6db,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7ff,0xf71c,
-0xf3b3,0xf0cb,0xf8aa,0xf2b0,0xf7be,0xffff,0xf7de,0xf3b3,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf14c,0xffff,0xffff,0xffff,0xffff,0xf5d9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf455,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7de,0xffff,0xffff,0xffff,0xffff,0xf7ff,0xf4d6,
-0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf71c,0xffff,
-0xffff,0xffff,0xf77d,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf455,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf22e,0xf3f3,0xf517,0xf5b8,0xf5d9,0xf557,0xf434,0xf26f,0xf0ca,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xf372,0xf22e,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf0cb,0xf7de,0xffff,0xffff,0xffff,0xf6bb,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf537,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7de,0xf372,0xf5b8,0xffff,0xffff,0xffff,0xffff,0xf7de,
-0xf2d0,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf63a,0xffff,
-0xffff,0xffff,0xf7df,0xf1ee,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf5d9,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf0aa,0xf6fc,0xffff,0xffff,0xffff,0xf7de,0xf12c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf6bb,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xffde,0xf392,0xf8aa,0xf14c,0xf73c,0xffff,0xffff,0xffff,0xffff,
-0xf75d,0xf16c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf4d6,0xffff,
-0xffff,0xffff,0xffff,0xf414,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf10b,0xf79e,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf5b8,0xffff,0xffff,0xffff,0xf7ff,0xf331,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1ad,0xffde,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf3b3,0xf8aa,0xf8aa,0xf8aa,0xf2b0,0xf7de,0xffff,0xffff,0xffff,
-0xffff,0xf5f9,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf2f1,0xffff,
-0xffff,0xffff,0xffff,0xf6fc,0xf0cb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf3b3,0xffff,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf2b0,0xffff,0xffff,0xffff,0xffff,0xf537,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf3d3,0xffff,0xffff,0xffff,0xffff,0xf63a,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf495,0xffff,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf495,0xf7ff,0xffff,0xffff,
-0xffff,0xf7ff,0xf3f4,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf10b,0xf79e,
-0xffff,0xffff,0xffff,0xffff,0xf3d3,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf10b,0xf73d,0xffff,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf20e,0xf7ff,0xffff,0xffff,0xffff,0xf67a,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf18d,0xf7de,0xffff,0xffff,0xffff,0xf7df,0xf2f1,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf18d,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0cb,0xf65a,0xffff,0xffff,
-0xffff,0xffff,0xf7be,0xf22e,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf517,
-0xffff,0xffff,0xffff,0xffff,0xf79e,0xf1ee,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf557,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf0eb,0xf7de,0xffff,0xffff,0xffff,0xf7de,0xf1cd,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf5f9,0xffff,0xffff,0xffff,0xffff,0xf73d,0xf16d,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0cb,0xf619,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1ad,0xf79d,0xffff,
-0xffff,0xffff,0xffff,0xf6db,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,
-0xf7de,0xffff,0xffff,0xffff,0xffff,0xf71c,0xf1ee,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf0aa,0xf4b6,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf0aa,0xf65a,0xffff,0xffff,0xffff,0xffff,0xf619,0xf0cb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf28f,0xf7df,0xffff,0xffff,0xffff,0xffff,0xf6bb,0xf18d,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf0cb,0xf578,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf352,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xf537,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf4d6,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79d,0xf3b3,0xf0cb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1ad,
-0xf5f9,0xf7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf0aa,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf3d3,0xffff,0xffff,0xffff,0xffff,0xffff,0xf5f9,0xf1ee,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf0aa,0xf598,0xffff,0xffff,0xffff,0xffff,0xffff,0xf75d,0xf331,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf20e,0xf65a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf557,
-0xf7ff,0xffff,0xffff,0xffff,0xffdf,0xf331,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf10b,0xf6db,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf71c,0xf4b6,0xf331,0xf290,0xf2d0,0xf3d3,0xf5d9,0xf7de,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf14c,
-0xf557,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,
-0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf4f6,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf10b,0xf75d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf75d,0xf71c,0xf6fc,0xf434,0xf0aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf16c,0xf75d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf6db,0xf475,0xf311,0xf290,0xf2d0,
-0xf3f4,0xf619,0xf7de,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf10b,
-0xf6fc,0xffff,0xffff,0xffff,0xffff,0xf77d,0xf18d,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf1ee,0xf77d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xf77d,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf619,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf537,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf372,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xf2d0,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf26f,0xf7be,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xf77d,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf24f,0xf7be,0xffff,0xffff,0xffff,0xffff,0xf63a,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf22f,0xf75d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xf7ff,0xf598,0xf414,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf12c,0xf7de,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf77d,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf0aa,0xf557,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf2d0,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xf7ff,0xf4f6,0xf4d6,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf0aa,0xf414,0xffff,0xffff,0xffff,0xffff,0xffff,0xf2b0,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf1ad,0xf65a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xf7de,0xf475,0xf0ca,0xf352,0xffff,0xffff,0xffff,0xffff,0xf3b3,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf16c,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf73d,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf0cb,0xf537,0xf7fe,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf475,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf20e,0xf6db,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xf7be,0xf3d3,0xf0aa,0xf434,0xffff,0xffff,0xffff,0xffff,0xf2f1,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf5f9,0xffff,0xffff,0xffff,0xf79e,0xf0cb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf0ca,0xf619,0xffff,0xffff,0xffff,0xffff,0xf331,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0cb,0xf3b3,0xf71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,
-0xf619,0xf24f,0xf8aa,0xf8aa,0xf12c,0xf73d,0xffff,0xffff,0xf75d,0xf16c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf16c,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf434,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf331,0xf6fc,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0xf1cd,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0eb,0xf414,0xf75d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffde,0xf5b8,0xf1ce,0xf8aa,0xf8aa,0xf1ad,0xf79e,0xffff,0xffff,0xf6fc,0xf0eb,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf331,0xffdf,0xffff,0xffff,0xf4f6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf16c,0xf75d,0xffff,0xffff,0xf75d,0xf14c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0cb,0xf2b0,0xf4b5,0xf5f9,0xf6bb,0xf6fc,0xf69b,0xf5b8,0xf414,0xf1ee,
-0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf18d,0xf495,0xf495,0xf1ad,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf16c,0xffff,
-0xffff,0xffff,0xffff,0xf6fc,0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4f6,
-0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4d6,0xf331,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0ca,0xf26f,0xf434,0xf4f6,0xf516,0xf495,0xf1cd,0xf0aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0eb,0xf2f1,0xf4d6,0xf61a,0xf6db,0xf6fc,0xf69b,
-0xf578,0xf3f3,0xf1ad,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1ee,0xf4b6,0xf475,0xf16c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf0aa,0xf2f1,0xf4f6,0xf3d3,0xf0cb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf24f,0xf63a,0xf61a,0xf22e,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf8aa,0xf0aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf16c,0xffff,
-0xffff,0xffff,0xffff,0xf598,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf0aa,0xf0aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf16c,0xffff,
-0xffff,0xffff,0xffff,0xf598,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf16c,0xffff,
-0xffff,0xffff,0xffff,0xf598,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf16c,0xffff,
-0xffff,0xffff,0xffff,0xf598,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf26f,0xf557,0xf598,0xf598,0xf598,0xf598,0xf598,
-0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,
-0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf5d9,0xffff,
-0xffff,0xffff,0xffff,0xf598,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf22e,0xf7be,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xf598,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf4b6,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xf598,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf4d6,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xf557,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf24f,0xf7de,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xf7de,0xf2b0,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf2d0,0xf598,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,
-0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,
-0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,
-0xf5f9,0xf5b8,0xf311,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,
-0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,
-0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,
-0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
-0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa};
-
- 
+#ifndef AUTAKLOGO_H
+#define AUTAKLOGO_H
+ 
+const uint16_t autaklogo[] PROGMEM = {0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf0cb,0xf10b,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf12c,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf290,
+0xf75d,0xf7de,0xf5d9,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf18d,0xf69b,0xf7de,0xf6fc,0xf22e,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf14c,0xf2d0,0xf1ad,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0cb,0xf73d,
+0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf557,0xffff,0xffff,0xffff,0xf69b,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf20e,0xf77d,0xf7ff,0xf7de,0xf372,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1ad,0xffff,
+0xffff,0xffff,0xffff,0xf5d9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf6db,0xffff,0xffff,0xffff,0xf7de,0xf0cb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf578,0xffff,0xffff,0xffff,0xf73d,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
+0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf10b,0xf14c,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
+0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf3d3,0xf7be,0xf7de,0xf557,0xf0ca,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
+0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf18d,0xf7de,0xffff,0xffff,0xffff,0xf351,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
+0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2d0,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
+0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
+0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
+0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
+0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
+0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf14c,0xf1ad,0xf18d,0xf0eb,0xf0aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
+0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf0cb,0xf14c,0xf1ad,0xf18d,
+0xf0eb,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf1cd,0xf16c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf16c,0xf3f3,0xf61a,0xf79e,0xffdf,0xffff,0xffff,0xffde,0xf6fc,0xf517,
+0xf290,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
+0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf18d,0xf434,0xf65a,0xf79e,0xffff,0xffff,0xffff,
+0xf7de,0xf6bb,0xf4d6,0xf24f,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf0cb,0xf557,0xffff,0xf7be,0xf331,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf12c,0xf4d6,0xf7be,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xf69b,0xf28f,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
+0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf16d,0xf578,0xf69b,0xf69b,
+0xf6fc,0xffff,0xffff,0xffff,0xffff,0xf75d,0xf69b,0xf69b,0xf69b,0xf69b,0xf65a,0xf3b3,0xf0aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf16c,0xf537,0xf7de,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xf61a,0xf22e,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0ca,0xf557,0xffff,0xffff,0xffff,0xf77d,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf24f,0xf71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xf7de,0xf4b6,0xf0cb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
+0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf61a,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf2d0,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf2d0,0xf75d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xf7be,0xf414,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf0aa,0xf537,0xffff,0xffff,0xffff,0xffff,0xffff,0xf1ad,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf2f1,0xf7be,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xf5b9,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xffff,
+0xffff,0xffff,0xffff,0xf5f9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf0cb,0xf7de,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf495,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf3b2,0xf7de,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7ff,0xf517,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,
+0xf517,0xffff,0xffff,0xffff,0xffff,0xffff,0xf71c,0xf0cb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf28f,0xf7be,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf7be,0xf7de,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xf578,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf18d,0xffff,
+0xffff,0xffff,0xffff,0xf63a,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf6dc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf0aa,0xf71c,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf3d3,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf331,0xf7de,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffde,0xf7be,0xffde,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf4b6,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf516,
+0xf7ff,0xffff,0xffff,0xffff,0xffff,0xf77d,0xf22e,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf16c,0xf75d,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7de,0xf557,0xf2d0,0xf14c,0xf0ca,0xf0eb,0xf1ee,0xf3d3,0xf6dc,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf3f3,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf12c,0xffdf,
+0xffff,0xffff,0xffff,0xf6fc,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf6fc,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf2f1,0xf79e,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7ff,0xf61a,0xf0eb,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf1ee,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7be,0xf4f6,0xf290,0xf12c,0xf0ca,0xf0eb,
+0xf20e,0xf434,0xf71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf331,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf4f6,0xf7ff,
+0xffff,0xffff,0xffff,0xffff,0xf77d,0xf24f,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,
+0xf598,0xf7ff,0xffff,0xffff,0xffff,0xffff,0xf6bb,0xf20e,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0cb,
+0xf434,0xf7de,0xffff,0xffff,0xffff,0xffff,0xf7be,0xf1ad,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf77d,
+0xffff,0xffff,0xffff,0xf7de,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf0aa,0xf77d,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf10b,0xf1cd,0xf1cd,
+0xf3b3,0xffff,0xffff,0xffff,0xffff,0xf557,0xf1cd,0xf1cd,0xf1cd,0xf1cd,0xf18d,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf0aa,0xf65a,0xffff,0xffff,0xffff,0xffff,0xffff,0xf63a,0xf1ad,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf0eb,0xf4d6,0xffdf,0xffff,0xffff,0xffff,0xffff,0xf75d,0xf12c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf4d6,0xf7ff,0xffff,
+0xffff,0xffff,0xffff,0xf79d,0xf24f,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf24f,
+0xf7de,0xffff,0xffff,0xffff,0xffff,0xf63a,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf0aa,0xf331,0xf7de,0xffff,0xffff,0xffff,0xffff,0xf578,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf65a,
+0xffff,0xffff,0xffff,0xffff,0xf311,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf1ee,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf331,0xffff,0xffff,0xffff,0xffff,0xffff,0xf598,0xf0cb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf3f3,0xffdf,0xffff,0xffff,0xffff,0xffff,0xf4b6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf4b5,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xf79e,0xf26f,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf5b8,
+0xffff,0xffff,0xffff,0xffff,0xf71c,0xf12c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf414,0xffff,0xffff,0xffff,0xffff,0xf7de,0xf1ad,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf495,
+0xffff,0xffff,0xffff,0xffff,0xf619,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf4d6,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf67a,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf4f6,0xffff,0xffff,0xffff,0xffff,0xf79e,0xf12c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf0aa,0xf495,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xf79e,0xf28f,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf14c,0xf7de,
+0xffff,0xffff,0xffff,0xffff,0xf2d0,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf0ca,0xf67b,0xffff,0xffff,0xffff,0xffff,0xf475,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf26f,
+0xffff,0xffff,0xffff,0xffff,0xf7ff,0xf352,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf24f,0xf7be,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf20e,0xffdf,0xffff,0xffff,0xffff,0xf7de,0xf20e,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0eb,0xf71c,0xffff,0xffff,0xffff,0xffff,0xf392,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf0aa,0xf475,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xf7be,0xf2b0,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf372,0xffff,
+0xffff,0xffff,0xffff,0xf63a,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf69b,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,
+0xf6db,0xffff,0xffff,0xffff,0xffff,0xf79e,0xf2b0,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf24f,0xf75d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf434,0xffff,0xffff,0xffff,0xffff,0xf578,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf3b3,0xffff,0xffff,0xffff,0xffff,0xf5d9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf0aa,0xf454,0xf7df,0xffff,0xffff,0xffff,0xffff,0xf7be,
+0xf2b0,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf537,0xffff,
+0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf0cb,0xf75d,0xffff,0xffff,0xffff,0xffde,0xf12c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf352,0xf7df,0xffff,0xffff,0xffff,0xffff,0xf7de,0xf4d6,0xf18d,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf16c,0xf495,
+0xf7be,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf5f9,0xffff,0xffff,0xffff,0xf7ff,0xf2b0,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf12c,0xf7be,0xffff,0xffff,0xffff,0xf77d,0xf0ca,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf434,0xffdf,0xffff,0xffff,0xffff,0xffff,0xf7be,0xf2d0,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf67a,0xffff,
+0xffff,0xffff,0xf7de,0xf16c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf578,0xffff,0xffff,0xffff,0xffff,0xf28f,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf0aa,0xf63a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7de,0xf67a,0xf537,0xf4d6,0xf537,0xf65a,0xf7de,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf0aa,0xf73d,0xffff,0xffff,0xffff,0xf79e,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf63a,0xffff,0xffff,0xffff,0xffff,0xf1ad,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf475,0xf7df,0xffff,0xffff,0xffff,0xffff,0xf7be,0xf2d1,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf75d,0xffff,
+0xffff,0xffff,0xf75d,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf414,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf1ad,0xf75d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf0eb,0xffde,0xffff,0xffff,0xffff,0xf67a,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf4f6,0xffff,0xffff,0xffff,0xffff,0xf2b0,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf7be,0xffff,
+0xffff,0xffff,0xf69b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf372,0xffff,0xffff,0xffff,0xffff,0xf414,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf22e,0xf75d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xf75d,0xf77d,0xffff,0xffff,0xffff,0xffdf,0xf0eb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf16c,0xffff,0xffff,0xffff,0xffff,0xf5b9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf434,0xffff,0xffff,0xffff,0xffff,0xf331,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0xf1ee,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0ca,0xffde,0xffff,
+0xffff,0xffff,0xf65a,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf331,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf0aa,0xf1cd,0xf67a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xf7ff,0xf67b,0xf1cd,0xf619,0xffff,0xffff,0xffff,0xf73d,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf18d,0xf7ff,0xffff,0xffff,0xffff,0xf598,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf414,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf69b,0xf0eb,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf7be,0xffff,
+0xffff,0xffff,0xf6bb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf392,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0cb,0xf392,0xf6db,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7ff,0xf71c,
+0xf3b3,0xf0cb,0xf8aa,0xf2b0,0xf7be,0xffff,0xf7de,0xf3b3,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf14c,0xffff,0xffff,0xffff,0xffff,0xf5d9,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf455,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7de,0xffff,0xffff,0xffff,0xffff,0xf7ff,0xf4d6,
+0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf71c,0xffff,
+0xffff,0xffff,0xf77d,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf455,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf22e,0xf3f3,0xf517,0xf5b8,0xf5d9,0xf557,0xf434,0xf26f,0xf0ca,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,0xf372,0xf22e,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf0cb,0xf7de,0xffff,0xffff,0xffff,0xf6bb,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf537,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7de,0xf372,0xf5b8,0xffff,0xffff,0xffff,0xffff,0xf7de,
+0xf2d0,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf63a,0xffff,
+0xffff,0xffff,0xf7df,0xf1ee,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf5d9,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf0aa,0xf6fc,0xffff,0xffff,0xffff,0xf7de,0xf12c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf6bb,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xffde,0xf392,0xf8aa,0xf14c,0xf73c,0xffff,0xffff,0xffff,0xffff,
+0xf75d,0xf16c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf4d6,0xffff,
+0xffff,0xffff,0xffff,0xf414,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf10b,0xf79e,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2f1,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf5b8,0xffff,0xffff,0xffff,0xf7ff,0xf331,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1ad,0xffde,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf3b3,0xf8aa,0xf8aa,0xf8aa,0xf2b0,0xf7de,0xffff,0xffff,0xffff,
+0xffff,0xf5f9,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf2f1,0xffff,
+0xffff,0xffff,0xffff,0xf6fc,0xf0cb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf3b3,0xffff,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf2b0,0xffff,0xffff,0xffff,0xffff,0xf537,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf3d3,0xffff,0xffff,0xffff,0xffff,0xf63a,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf495,0xffff,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf495,0xf7ff,0xffff,0xffff,
+0xffff,0xf7ff,0xf3f4,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf10b,0xf79e,
+0xffff,0xffff,0xffff,0xffff,0xf3d3,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf10b,0xf73d,0xffff,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf20e,0xf7ff,0xffff,0xffff,0xffff,0xf67a,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf18d,0xf7de,0xffff,0xffff,0xffff,0xf7df,0xf2f1,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf18d,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0cb,0xf65a,0xffff,0xffff,
+0xffff,0xffff,0xf7be,0xf22e,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf517,
+0xffff,0xffff,0xffff,0xffff,0xf79e,0xf1ee,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf557,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf0eb,0xf7de,0xffff,0xffff,0xffff,0xf7de,0xf1cd,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf5f9,0xffff,0xffff,0xffff,0xffff,0xf73d,0xf16d,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0cb,0xf619,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1ad,0xf79d,0xffff,
+0xffff,0xffff,0xffff,0xf6db,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1cd,
+0xf7de,0xffff,0xffff,0xffff,0xffff,0xf71c,0xf1ee,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf0aa,0xf4b6,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf0aa,0xf65a,0xffff,0xffff,0xffff,0xffff,0xf619,0xf0cb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf28f,0xf7df,0xffff,0xffff,0xffff,0xffff,0xf6bb,0xf18d,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf0cb,0xf578,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf352,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xf537,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf4d6,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79d,0xf3b3,0xf0cb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1ad,
+0xf5f9,0xf7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf0aa,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf3d3,0xffff,0xffff,0xffff,0xffff,0xffff,0xf5f9,0xf1ee,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf0aa,0xf598,0xffff,0xffff,0xffff,0xffff,0xffff,0xf75d,0xf331,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf20e,0xf65a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf557,
+0xf7ff,0xffff,0xffff,0xffff,0xffdf,0xf331,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf10b,0xf6db,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf71c,0xf4b6,0xf331,0xf290,0xf2d0,0xf3d3,0xf5d9,0xf7de,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf14c,
+0xf557,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,
+0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf69b,0xf4f6,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf10b,0xf75d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf75d,0xf71c,0xf6fc,0xf434,0xf0aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf16c,0xf75d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf6db,0xf475,0xf311,0xf290,0xf2d0,
+0xf3f4,0xf619,0xf7de,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf10b,
+0xf6fc,0xffff,0xffff,0xffff,0xffff,0xf77d,0xf18d,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf1ee,0xf77d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xf77d,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf619,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf537,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf372,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xf2d0,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf26f,0xf7be,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xf77d,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf24f,0xf7be,0xffff,0xffff,0xffff,0xffff,0xf63a,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf22f,0xf75d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xf7ff,0xf598,0xf414,0xffff,0xffff,0xffff,0xffff,0xf454,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf12c,0xf7de,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf77d,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf0aa,0xf557,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf4d6,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf2d0,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xf7ff,0xf4f6,0xf4d6,0xffff,0xffff,0xffff,0xffff,0xf372,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf67a,0xffff,0xffff,0xffff,0xffff,0xf10b,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf0aa,0xf414,0xffff,0xffff,0xffff,0xffff,0xffff,0xf2b0,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf1ad,0xf65a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xf7de,0xf475,0xf0ca,0xf352,0xffff,0xffff,0xffff,0xffff,0xf3b3,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf16c,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf73d,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf0cb,0xf537,0xf7fe,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf475,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf20e,0xf6db,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xf7be,0xf3d3,0xf0aa,0xf434,0xffff,0xffff,0xffff,0xffff,0xf2f1,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf5f9,0xffff,0xffff,0xffff,0xf79e,0xf0cb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf0ca,0xf619,0xffff,0xffff,0xffff,0xffff,0xf331,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0cb,0xf3b3,0xf71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,
+0xf619,0xf24f,0xf8aa,0xf8aa,0xf12c,0xf73d,0xffff,0xffff,0xf75d,0xf16c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf16c,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf434,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf331,0xf6fc,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0xf1cd,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0eb,0xf414,0xf75d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffde,0xf5b8,0xf1ce,0xf8aa,0xf8aa,0xf1ad,0xf79e,0xffff,0xffff,0xf6fc,0xf0eb,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf331,0xffdf,0xffff,0xffff,0xf4f6,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf16c,0xf75d,0xffff,0xffff,0xf75d,0xf14c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0cb,0xf2b0,0xf4b5,0xf5f9,0xf6bb,0xf6fc,0xf69b,0xf5b8,0xf414,0xf1ee,
+0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf18d,0xf495,0xf495,0xf1ad,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf16c,0xffff,
+0xffff,0xffff,0xffff,0xf6fc,0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4f6,
+0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4f6,0xf4d6,0xf331,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0ca,0xf26f,0xf434,0xf4f6,0xf516,0xf495,0xf1cd,0xf0aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0eb,0xf2f1,0xf4d6,0xf61a,0xf6db,0xf6fc,0xf69b,
+0xf578,0xf3f3,0xf1ad,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf1ee,0xf4b6,0xf475,0xf16c,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf0aa,0xf2f1,0xf4f6,0xf3d3,0xf0cb,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf24f,0xf63a,0xf61a,0xf22e,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf8aa,0xf0aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf16c,0xffff,
+0xffff,0xffff,0xffff,0xf598,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf0aa,0xf0aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf16c,0xffff,
+0xffff,0xffff,0xffff,0xf598,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf16c,0xffff,
+0xffff,0xffff,0xffff,0xf598,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf16c,0xffff,
+0xffff,0xffff,0xffff,0xf598,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf26f,0xf557,0xf598,0xf598,0xf598,0xf598,0xf598,
+0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,
+0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf598,0xf5d9,0xffff,
+0xffff,0xffff,0xffff,0xf598,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf22e,0xf7be,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xf598,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf4b6,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xf598,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf4d6,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xf557,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf24f,0xf7de,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xf7de,0xf2b0,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf2d0,0xf598,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,
+0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,
+0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,0xf5f9,
+0xf5f9,0xf5b8,0xf311,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,
+0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,
+0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,0xf0aa,
+0xf0aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,
+0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa,0xf8aa};
+
+ 
 #endif
\ No newline at end of file
@@ -1,85 +1,109 @@
-#ifndef CONFIG_H
-#define CONFIG_H
-
-#include "driver/twai.h"
-#include <WiFi.h> 
-
-//Define button pins
-#define BTN4 14
-#define BTN3 26
-#define BTN2 27
-#define BTN1 32
-#define PWR 33
-
-//Define joystick pins
-#define JOYSTICKX 34
-#define JOYSTICKY 35
-
-//System characteristics
-extern float temperature;
-extern float left_assembly_angle, right_assembly_angle;
-extern int x_value;
-extern int y_value;
-extern int yMax, yMin, xMax, xMin;
-extern int yUpperThresh, yLowerThresh, xUpperThresh, xLowerThresh;
-extern int yMidLevel, xMidLevel;
-extern int left_motor, right_motor, left_assembly, right_assembly, rear_assembly;
-extern float voltage1, voltage2;
-extern int speed;
-extern uint8_t maximumVoltage;
-extern uint16_t system_begin_time;
-
-// VESC communication settings
-extern bool flag;  // Flag to see whether a message should be queued for transmission
-
-//Variables for detecting button presses
-extern uint16_t pressedTime1, releaseTime1, elapsedTime1;
-extern uint16_t pressedTime2, releaseTime2, elapsedTime2;
-extern uint16_t pressedTime3, releaseTime3, elapsedTime3;
-extern uint16_t pressedTime4, releaseTime4, elapsedTime4;
-extern bool shortPress1 , shortPress2, longPress1, longPress2;
-extern bool shortPress3, shortPress4, longPress3, longPress4;
-extern bool btn1;
-extern bool btn2;
-extern bool btn3;
-extern bool btn4;
-extern bool prevBtn1;
-extern bool prevBtn2;
-extern bool prevBtn3;
-extern bool prevBtn4;
-
-//Variables to toggle driving/ climbing mode
-extern bool driveMode;
-extern bool lastMode;
-
-//Variables to control backrest and footrest angles
-extern uint8_t minBackAngle;
-extern uint8_t maxBackAngle;
-extern uint8_t minFootAngle;
-extern uint8_t maxFootAngle;
-extern float backAngle;
-extern float footAngle;
-
-//Variables to toggle configuration mode
-extern bool configMode;
-extern uint8_t selection;
-extern bool calibrating;
-
-//Variables to measure timing
-extern uint16_t startingTime, currentTime;
-extern bool calibrationBegin;
-
-// Hotspot settings
-extern const char ssid[];
-extern const char password[];
-
-// Declare transmitted and received message
-extern twai_message_t receivedMessage;
-extern twai_message_t transmittedActuatorsMessage;
-
-// Declare the status information struct
-extern twai_status_info_t status_info;
-
-extern int status;
-
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#include "driver/twai.h"
+#include <WiFi.h> 
+
+//Define button pins
+#define BTN4 14
+#define BTN3 26
+#define BTN2 27
+#define BTN1 32
+#define PWR 33
+
+//Define joystick pins
+#define JOYSTICKX 34
+#define JOYSTICKY 35
+
+//Task settings. The joystick to VESC path runs at a fixed rate on CONTROL_TASK_CORE, the screen is drawn by the render task on the other core
+//and the web server and logging run on the Arduino loop task.
+#define CONTROL_LOOP_HZ 100
+#define CONTROL_TASK_PRIORITY 5
+#define CONTROL_TASK_CORE 1
+#define CONTROL_TASK_STACK 8192
+#define SERVICE_LOOP_DELAY_MS 20
+#define RENDER_FPS 10
+#define RENDER_TASK_PRIORITY 1
+#define RENDER_TASK_CORE 0
+#define RENDER_TASK_STACK 8192
+#define TIMING_REPORT_INTERVAL_MS 5000
+
+//Stages of the joystick calibration in the configuration menu
+enum CALIBRATION_STAGE{
+  CALIBRATION_IDLE,
+  CALIBRATION_REST,
+  CALIBRATION_RANGE
+};
+
+//System characteristics
+extern float temperature;
+extern float left_assembly_angle, right_assembly_angle;
+extern int x_value;
+extern int y_value;
+extern int yMax, yMin, xMax, xMin;
+extern int yUpperThresh, yLowerThresh, xUpperThresh, xLowerThresh;
+extern int yMidLevel, xMidLevel;
+extern int left_motor, right_motor, left_assembly, right_assembly, rear_assembly;
+extern float voltage1, voltage2;
+extern int speed;
+extern uint8_t maximumVoltage;
+extern uint16_t system_begin_time;
+
+// VESC communication settings
+#define VESC_FIRST_NODE 7         // VESC node IDs VESC_FIRST_NODE ... VESC_FIRST_NODE + VESC_NODE_COUNT - 1
+#define VESC_NODE_COUNT 5
+#define VESC_CAN_TIMEOUT_MS 1000  // "Timeout" of the VESCs' app settings: without a command for this long they stop the motor
+#define RIGHT_DRIVE_VESC 9
+#define LEFT_DRIVE_VESC 11
+#define ACTUATORS_MESSAGE_ID 99   // Extended identifier of the actuators controller's command
+
+//Drive train, converts the drive motors' ERPM to the speed on the screen. Set to the wheelchair's drive motors and wheels.
+#define DRIVE_MOTOR_POLE_PAIRS 15
+#define DRIVE_GEAR_RATIO 1.0f       // Motor revolutions per wheel revolution
+#define WHEEL_DIAMETER_M 0.254f
+
+extern bool flag;  // Flag to see whether a message should be queued for transmission
+
+//Debounced button levels, set by button_update()
+extern bool btn1;
+extern bool btn2;
+extern bool btn3;
+extern bool btn4;
+
+//Variables to toggle driving/ climbing mode
+extern bool driveMode;
+extern bool lastMode;
+
+//Variables to control backrest and footrest angles
+extern uint8_t minBackAngle;
+extern uint8_t maxBackAngle;
+extern uint8_t minFootAngle;
+extern uint8_t maxFootAngle;
+extern float backAngle;
+extern float footAngle;
+
+//Variables to toggle configuration mode
+extern bool configMode;
+extern uint8_t selection;
+extern bool calibrating;
+extern uint8_t calibrationStage;
+extern uint8_t actuatorAction;
+
+//Variables to measure timing
+extern uint16_t startingTime, currentTime;
+extern bool calibrationBegin;
+
+// Hotspot settings
+extern const char ssid[];
+extern const char password[];
+
+// Declare transmitted and received message
+extern twai_message_t receivedMessage;
+extern twai_message_t transmittedActuatorsMessage;
+
+// Declare the status information struct
+extern twai_status_info_t status_info;
+
+extern int status;
+
 #endif
\ No newline at end of file
@@ -0,0 +1,153 @@
+#ifndef ARDUINO_MOCK_H
+#define ARDUINO_MOCK_H
+
+/* Host replacement for the parts of the Arduino-ESP32 core (and the FreeRTOS API it exposes) that are used by the controller. It is only on
+the include path of the native environment. Pins, time and the TWAI driver are simulated by the mock devices in mock_devices.h. */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <limits.h>
+#include <math.h>
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+using std::min;
+using std::max;
+using std::abs;
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define INPUT_PULLDOWN 0x09
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+#define DEC 10
+#define HEX 16
+#define PI 3.1415926535897932384626433832795
+
+#define PROGMEM
+#define IRAM_ATTR
+#define RTC_DATA_ATTR
+#define F(string_literal) (string_literal)
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+
+//ESP-IDF error codes
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_NO_MEM 0x101
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_STATE 0x103
+#define ESP_ERR_INVALID_SIZE 0x104
+#define ESP_ERR_NOT_SUPPORTED 0x106
+#define ESP_ERR_TIMEOUT 0x107
+
+//FreeRTOS. The host build is single threaded: the native main calls the task bodies itself, so locks are no-ops and delays advance the
+//simulated time.
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef void *TaskHandle_t;
+typedef void *SemaphoreHandle_t;
+typedef void *QueueHandle_t;
+typedef void (*TaskFunction_t)(void *);
+typedef struct { int owner; } portMUX_TYPE;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL 0
+#define pdPASS 1
+#define portMAX_DELAY 0xffffffffUL
+#define portTICK_PERIOD_MS 1
+#define configTICK_RATE_HZ 1000
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+#define portENTER_CRITICAL_ISR(mux) ((void)(mux))
+#define portEXIT_CRITICAL_ISR(mux) ((void)(mux))
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t stack, void *parameters, UBaseType_t priority,
+                                   TaskHandle_t *handle, BaseType_t core);
+void vTaskSuspend(TaskHandle_t task);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount();
+
+//Arduino API
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t level);
+uint16_t analogRead(uint8_t pin);
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+uint32_t getCpuFrequencyMhz();
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode);
+void detachInterrupt(uint8_t pin);
+int digitalPinToInterrupt(uint8_t pin);
+
+class String{
+  private:
+  std::string text;
+
+  public:
+  String() {}
+  String(const char *value) : text(value ? value : "") {}
+  String(const std::string &value) : text(value) {}
+  String(char value) : text(1, value) {}
+  String(int value) : text(std::to_string(value)) {}
+  String(unsigned int value) : text(std::to_string(value)) {}
+  String(long value) : text(std::to_string(value)) {}
+  String(unsigned long value) : text(std::to_string(value)) {}
+  String(float value, unsigned int decimals = 2);
+  String(double value, unsigned int decimals = 2);
+
+  String &operator+=(const String &other) { text += other.text; return *this; }
+  friend String operator+(const String &a, const String &b) { return String(a.text + b.text); }
+  bool operator==(const String &other) const { return text == other.text; }
+  const char *c_str() const { return text.c_str(); }
+  unsigned int length() const { return text.length(); }
+};
+
+//Serial port. Output goes to stdout and can be muted with mock_serial_output(), input is injected with mock_serial_input().
+class HardwareSerial{
+  public:
+  void begin(unsigned long baud) { (void)baud; }
+  void end() {}
+  operator bool() const { return true; }
+  int available();
+  int read();
+  size_t write(uint8_t c);
+  size_t write(const uint8_t *buffer, size_t size);
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+  size_t print(const char *value);
+  size_t print(const String &value);
+  size_t print(char value);
+  size_t print(unsigned char value);
+  size_t print(int value);
+  size_t print(unsigned int value);
+  size_t print(long value);
+  size_t print(unsigned long value);
+  size_t print(double value, int decimals = 2);
+  size_t println();
+  template <typename T> size_t println(const T &value) { size_t n = print(value); return n + println(); }
+  void flush();
+};
+
+extern HardwareSerial Serial;
+
+#endif
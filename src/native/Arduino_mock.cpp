@@ -0,0 +1,339 @@
+#include <vector>
+#include <Arduino.h>
+#include "esp_timer.h"
+#include "mock_devices.h"
+
+#define MOCK_PIN_COUNT 40
+#define MOCK_PIN_READ_US 1
+
+HardwareSerial Serial;
+
+static uint64_t simulatedTime = 0;
+static uint16_t analogLevels[MOCK_PIN_COUNT];
+static int digitalLevels[MOCK_PIN_COUNT];
+static void (*interruptHandlers[MOCK_PIN_COUNT])(void);
+static int interruptModes[MOCK_PIN_COUNT];
+static bool serialOutput = true;
+static std::string serialInput;
+static MockTimeListener timeListener = NULL;
+static uint64_t listenerTime = 0;
+
+struct MockEspTimer{
+  esp_timer_cb_t callback;
+  void *arg;
+  uint64_t period;          // 0 for a one shot timer
+  uint64_t expiry;
+  bool active;
+};
+static std::vector<MockEspTimer *> espTimers;
+
+static MockEspTimer *next_timer(){
+  MockEspTimer *next = NULL;
+  for(size_t i = 0; i < espTimers.size(); i++){
+    if(espTimers[i]->active && (next == NULL || espTimers[i]->expiry < next->expiry)) next = espTimers[i];
+  }
+  return next;
+}
+
+uint64_t mock_time_us(){
+  return simulatedTime;
+}
+
+void mock_set_time_us(uint64_t time){
+  simulatedTime = time;
+}
+
+void mock_advance_time_us(uint64_t time){
+  static bool notifying = false;
+  uint64_t target = simulatedTime + time;
+  if(!notifying){
+    //Stop at every time the listener asked for and at every timer expiry, in time order. The listener and the timer callbacks may change
+    //pins, deliver or transmit frames, which must not call them again.
+    notifying = true;
+    while(true){
+      MockEspTimer *timer = next_timer();
+      bool listenerDue = timeListener != NULL && listenerTime <= target;
+      bool timerDue = timer != NULL && timer->expiry <= target;
+      if(listenerDue && (!timerDue || listenerTime <= timer->expiry)){
+        if(listenerTime > simulatedTime) simulatedTime = listenerTime;
+        listenerTime = timeListener(simulatedTime);
+        continue;
+      }
+      if(!timerDue) break;
+      if(timer->expiry > simulatedTime) simulatedTime = timer->expiry;
+      if(timer->period > 0) timer->expiry += timer->period;
+      else timer->active = false;
+      timer->callback(timer->arg);
+    }
+    notifying = false;
+  }
+  if(simulatedTime < target) simulatedTime = target;
+}
+
+void mock_set_time_listener(MockTimeListener listener){
+  timeListener = listener;
+  listenerTime = 0;
+}
+
+void mock_set_analog(uint8_t pin, uint16_t value){
+  if(pin < MOCK_PIN_COUNT) analogLevels[pin] = value;
+}
+
+void mock_set_digital(uint8_t pin, int level){
+  if(pin >= MOCK_PIN_COUNT) return;
+  int previous = digitalLevels[pin];
+  digitalLevels[pin] = level ? HIGH : LOW;
+  if(interruptHandlers[pin] == NULL || previous == digitalLevels[pin]) return;
+
+  bool rising = digitalLevels[pin] == HIGH;
+  int mode = interruptModes[pin];
+  if(mode == CHANGE || (mode == RISING && rising) || (mode == FALLING && !rising)) interruptHandlers[pin]();
+}
+
+void mock_serial_output(bool enabled){
+  serialOutput = enabled;
+}
+
+void mock_serial_input(const char *text){
+  serialInput += text;
+}
+
+uint32_t MockClock::now_us(){
+  return (uint32_t)simulatedTime;
+}
+
+void MockClock::sleep_until_us(uint32_t wake_time){
+  int32_t remaining = (int32_t)(wake_time - (uint32_t)simulatedTime);
+  if(remaining > 0) mock_advance_time_us(remaining);
+}
+
+// Arduino API
+unsigned long millis(){
+  return simulatedTime / 1000;
+}
+
+unsigned long micros(){
+  return simulatedTime;
+}
+
+void delay(uint32_t ms){
+  mock_advance_time_us((uint64_t)ms * 1000);
+}
+
+void delayMicroseconds(uint32_t us){
+  mock_advance_time_us(us);
+}
+
+void pinMode(uint8_t pin, uint8_t mode){
+  (void)pin;
+  (void)mode;
+}
+
+int digitalRead(uint8_t pin){
+  //Reading a pin takes a little time, so a loop that polls a pin sees it change
+  mock_advance_time_us(MOCK_PIN_READ_US);
+  return pin < MOCK_PIN_COUNT ? digitalLevels[pin] : LOW;
+}
+
+void digitalWrite(uint8_t pin, uint8_t level){
+  if(pin < MOCK_PIN_COUNT) digitalLevels[pin] = level ? HIGH : LOW;
+}
+
+uint16_t analogRead(uint8_t pin){
+  return pin < MOCK_PIN_COUNT ? analogLevels[pin] : 0;
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max){
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+uint32_t getCpuFrequencyMhz(){
+  return 240;
+}
+
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode){
+  if(pin >= MOCK_PIN_COUNT) return;
+  interruptHandlers[pin] = handler;
+  interruptModes[pin] = mode;
+}
+
+void detachInterrupt(uint8_t pin){
+  if(pin < MOCK_PIN_COUNT) interruptHandlers[pin] = NULL;
+}
+
+int digitalPinToInterrupt(uint8_t pin){
+  return pin;
+}
+
+// FreeRTOS
+SemaphoreHandle_t xSemaphoreCreateMutex(){
+  static int mutex;
+  return &mutex;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks){
+  (void)semaphore;
+  (void)ticks;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore){
+  (void)semaphore;
+  return pdTRUE;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t stack, void *parameters, UBaseType_t priority,
+                                   TaskHandle_t *handle, BaseType_t core){
+  //There are no tasks on the host, the native main calls the task bodies itself
+  (void)task; (void)name; (void)stack; (void)parameters; (void)priority; (void)core;
+  if(handle != NULL) *handle = NULL;
+  return pdFAIL;
+}
+
+void vTaskSuspend(TaskHandle_t task){
+  (void)task;
+}
+
+void vTaskDelete(TaskHandle_t task){
+  (void)task;
+}
+
+void vTaskDelay(TickType_t ticks){
+  mock_advance_time_us((uint64_t)ticks * portTICK_PERIOD_MS * 1000);
+}
+
+TickType_t xTaskGetTickCount(){
+  return simulatedTime / (portTICK_PERIOD_MS * 1000);
+}
+
+// esp_timer
+esp_err_t esp_timer_create(const esp_timer_create_args_t *create_args, esp_timer_handle_t *out_handle){
+  if(create_args == NULL || create_args->callback == NULL || out_handle == NULL) return ESP_ERR_INVALID_ARG;
+  MockEspTimer *timer = new MockEspTimer();
+  timer->callback = create_args->callback;
+  timer->arg = create_args->arg;
+  espTimers.push_back(timer);
+  *out_handle = timer;
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us){
+  if(timer == NULL) return ESP_ERR_INVALID_ARG;
+  if(timer->active) return ESP_ERR_INVALID_STATE;
+  timer->period = 0;
+  timer->expiry = simulatedTime + timeout_us;
+  timer->active = true;
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period){
+  if(timer == NULL || period == 0) return ESP_ERR_INVALID_ARG;
+  if(timer->active) return ESP_ERR_INVALID_STATE;
+  timer->period = period;
+  timer->expiry = simulatedTime + period;
+  timer->active = true;
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer){
+  if(timer == NULL) return ESP_ERR_INVALID_ARG;
+  if(!timer->active) return ESP_ERR_INVALID_STATE;
+  timer->active = false;
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer){
+  if(timer == NULL) return ESP_ERR_INVALID_ARG;
+  if(timer->active) return ESP_ERR_INVALID_STATE;
+  espTimers.erase(std::find(espTimers.begin(), espTimers.end(), timer));
+  delete timer;
+  return ESP_OK;
+}
+
+int64_t esp_timer_get_time(){
+  return simulatedTime;
+}
+
+// String
+String::String(float value, unsigned int decimals) : String((double)value, decimals) {}
+
+String::String(double value, unsigned int decimals){
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), "%.*f", (int)decimals, value);
+  text = buffer;
+}
+
+// Serial
+int HardwareSerial::available(){
+  return serialInput.size();
+}
+
+int HardwareSerial::read(){
+  if(serialInput.empty()) return -1;
+  int c = (unsigned char)serialInput[0];
+  serialInput.erase(0, 1);
+  return c;
+}
+
+size_t HardwareSerial::write(uint8_t c){
+  if(serialOutput) putchar(c);
+  return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size){
+  if(serialOutput) fwrite(buffer, 1, size, stdout);
+  return size;
+}
+
+size_t HardwareSerial::printf(const char *format, ...){
+  if(!serialOutput) return 0;
+  va_list args;
+  va_start(args, format);
+  int length = vprintf(format, args);
+  va_end(args);
+  return length > 0 ? length : 0;
+}
+
+size_t HardwareSerial::print(const char *value){
+  return this->printf("%s", value);
+}
+
+size_t HardwareSerial::print(const String &value){
+  return this->printf("%s", value.c_str());
+}
+
+size_t HardwareSerial::print(char value){
+  return write((uint8_t)value);
+}
+
+size_t HardwareSerial::print(unsigned char value){
+  return this->printf("%u", value);
+}
+
+size_t HardwareSerial::print(int value){
+  return this->printf("%d", value);
+}
+
+size_t HardwareSerial::print(unsigned int value){
+  return this->printf("%u", value);
+}
+
+size_t HardwareSerial::print(long value){
+  return this->printf("%ld", value);
+}
+
+size_t HardwareSerial::print(unsigned long value){
+  return this->printf("%lu", value);
+}
+
+size_t HardwareSerial::print(double value, int decimals){
+  return this->printf("%.*f", decimals, value);
+}
+
+size_t HardwareSerial::println(){
+  return this->printf("\n");
+}
+
+void HardwareSerial::flush(){
+  fflush(stdout);
+}
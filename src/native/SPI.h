@@ -0,0 +1,6 @@
+#ifndef SPI_MOCK_H
+#define SPI_MOCK_H
+
+// Host replacement for SPI.h. The screen is simulated by the TFT_eSPI mock, so nothing is needed here.
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef TFT_ESPI_MOCK_H
+#define TFT_ESPI_MOCK_H
+
+/* Host replacement for the TFT_eSPI library. Nothing is drawn, the mock only counts the pixels that would have been sent over SPI, so the
+cost of the screen can be compared between builds (see mock_tft_stats()). */
+
+#include <Arduino.h>
+
+#define TFT_BLACK 0x0000
+#define TFT_BLUE 0x001F
+#define TFT_RED 0xF800
+#define TFT_GREEN 0x07E0
+#define TFT_ORANGE 0xFDA0
+#define TFT_WHITE 0xFFFF
+
+struct MockTftStats{
+  uint64_t pixels_pushed;   // Pixels sent to the screen (direct drawing and pushed sprites)
+  uint64_t sprite_pixels;   // Pixels drawn into sprites
+  uint32_t sprites_pushed;
+  uint32_t screen_fills;
+};
+
+MockTftStats mock_tft_stats();
+void mock_tft_reset_stats();
+void mock_tft_count_screen(uint64_t pixels);
+void mock_tft_count_sprite(uint64_t pixels);
+void mock_tft_count_push();
+void mock_tft_count_fill();
+
+class TFT_eSPI{
+  public:
+  int32_t width_px;
+  int32_t height_px;
+
+  TFT_eSPI(int16_t width = 240, int16_t height = 320) : width_px(width), height_px(height) {}
+  void init() {}
+  void setRotation(uint8_t rotation) { if(rotation & 1) std::swap(width_px, height_px); }
+  void startWrite() {}
+  void endWrite() {}
+  void setCursor(int16_t x, int16_t y) { (void)x; (void)y; }
+  void drawPixel(int32_t x, int32_t y, uint32_t color) { (void)x; (void)y; (void)color; mock_tft_count_screen(1); }
+  void fillScreen(uint32_t color) { (void)color; mock_tft_count_fill(); mock_tft_count_screen((uint64_t)width_px * height_px); }
+};
+
+class TFT_eSprite : public TFT_eSPI{
+  private:
+  int32_t sprite_width;
+  int32_t sprite_height;
+
+  public:
+  TFT_eSprite(TFT_eSPI *tft) : TFT_eSPI(), sprite_width(0), sprite_height(0) { (void)tft; }
+  void *createSprite(int16_t width, int16_t height, uint8_t frames = 1) { (void)frames; sprite_width = width; sprite_height = height; return this; }
+  void deleteSprite() { sprite_width = 0; sprite_height = 0; }
+  void fillSprite(uint32_t color) { (void)color; mock_tft_count_sprite((uint64_t)sprite_width * sprite_height); }
+  void drawPixel(int32_t x, int32_t y, uint32_t color) { (void)x; (void)y; (void)color; mock_tft_count_sprite(1); }
+  void pushSprite(int32_t x, int32_t y) { (void)x; (void)y; mock_tft_count_push(); mock_tft_count_screen((uint64_t)sprite_width * sprite_height); }
+  void pushSprite(int32_t x, int32_t y, uint16_t transparent) { (void)transparent; pushSprite(x, y); }
+  void setTextColor(uint16_t foreground, uint16_t background) { (void)foreground; (void)background; }
+  void setTextSize(uint8_t size) { (void)size; }
+  int16_t drawString(const String &text, int32_t x, int32_t y, uint8_t font = 1) { (void)x; (void)y; (void)font; return text.length(); }
+  void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) { (void)color; mock_tft_count_sprite(std::max(abs(x1 - x0), abs(y1 - y0)) + 1); }
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) { (void)x; (void)y; (void)color; mock_tft_count_sprite(2 * (w + h)); }
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) { (void)x; (void)y; (void)color; if(w > 0 && h > 0) mock_tft_count_sprite((uint64_t)w * h); }
+  size_t print(const char *text) { return strlen(text); }
+  size_t printf(const char *format, ...) { (void)format; return 0; }
+};
+
+#endif
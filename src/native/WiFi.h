@@ -0,0 +1,9 @@
+#ifndef WIFI_MOCK_H
+#define WIFI_MOCK_H
+
+// Host replacement for WiFi.h. Only the status constants used by config.cpp are needed.
+
+#define WL_IDLE_STATUS 0
+#define WL_CONNECTED 3
+
+#endif
@@ -0,0 +1,248 @@
+#include <math.h>
+#include <string>
+#include <vector>
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "mock_devices.h"
+#include "bus_stats_check.h"
+#include "TWAI_handler.h"
+#include "TWAI_dispatch.h"
+#include "TWAI_stats.h"
+
+#define CHECK_PERIOD_MS 10            // The mixes are counted in steps of one control period
+
+static uint32_t failures = 0;
+
+static void check(bool ok, const char *what){
+  if(ok) return;
+  failures++;
+  printf("FAILED: %s\n", what);
+}
+
+static std::string bit_string(uint32_t value, int count){
+  std::string bits;
+  for(int i = count - 1; i >= 0; i--) bits += value >> i & 1 ? '1' : '0';
+  return bits;
+}
+
+static std::string reference_crc(const std::string &bits){
+  //Polynomial long division by x^15 + x^14 + x^10 + x^8 + x^7 + x^4 + x^3 + 1
+  const std::string polynomial = "1100010110011001";
+  std::string remainder = bits + std::string(15, '0');
+  for(size_t i = 0; i < bits.size(); i++){
+    if(remainder[i] == '0') continue;
+    for(size_t j = 0; j < polynomial.size(); j++) remainder[i + j] = remainder[i + j] == polynomial[j] ? '0' : '1';
+  }
+  return remainder.substr(bits.size());
+}
+
+static uint32_t reference_bits(const twai_message_t *message){
+  /* Length of a frame on the bus, from its bit string
+    Arguments:
+      - const twai_message_t *message: The frame
+    Returns:
+      - uint32_t: Bits from the start of frame to the end of the interframe space
+  */
+  uint8_t dataBytes = message->rtr ? 0 : std::min<uint8_t>(message->data_length_code, 8);
+  std::string bits = "0";
+  if(message->extd){
+    bits += bit_string(message->identifier >> 18, 11) + "11" + bit_string(message->identifier, 18) + (message->rtr ? "1" : "0") + "00";
+  }
+  else bits += bit_string(message->identifier, 11) + (message->rtr ? "1" : "0") + "00";
+  bits += bit_string(message->data_length_code, 4);
+  for(uint8_t i = 0; i < dataBytes; i++) bits += bit_string(message->data[i], 8);
+  bits += reference_crc(bits);
+
+  std::string stuffed;
+  int run = 0;
+  char level = 0;
+  for(size_t i = 0; i < bits.size(); i++){
+    stuffed += bits[i];
+    run = bits[i] == level ? run + 1 : 1;
+    level = bits[i];
+    if(run == 5){
+      level = level == '0' ? '1' : '0';
+      stuffed += level;
+      run = 1;
+    }
+  }
+  //CRC delimiter, ACK slot and delimiter, end of frame and interframe space
+  return stuffed.size() + 13;
+}
+
+static uint32_t next_random(uint32_t *state){
+  *state = *state * 1664525 + 1013904223;
+  return *state >> 8;
+}
+
+static void check_frame_lengths(){
+  const uint8_t crcInput[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+  check(twai_crc15(crcInput, sizeof(crcInput)) == 0x059E, "CRC-15 of \"123456789\" is 0x059E");
+
+  uint32_t seed = 7;
+  uint32_t mismatches = 0, outOfBounds = 0;
+  uint16_t longest[2] = {0, 0};
+  for(int i = 0; i < 100000; i++){
+    twai_message_t message = {};
+    message.extd = next_random(&seed) & 1;
+    message.rtr = next_random(&seed) % 8 == 0;
+    message.identifier = next_random(&seed) & (message.extd ? TWAI_EXTD_ID_MASK : TWAI_STD_ID_MASK);
+    message.data_length_code = next_random(&seed) % 9;
+    //Mostly runs of equal bits, which need stuff bits, and some random bytes
+    uint8_t fill = next_random(&seed) % 3 == 0 ? next_random(&seed) : (next_random(&seed) & 1 ? 0xFF : 0x00);
+    for(int j = 0; j < 8; j++) message.data[j] = next_random(&seed) % 4 == 0 ? next_random(&seed) : fill;
+    if(i < 4){
+      //All dominant and all recessive frames
+      message.identifier = i & 1 ? (message.extd ? TWAI_EXTD_ID_MASK : TWAI_STD_ID_MASK) : 0;
+      message.rtr = false;
+      message.data_length_code = 8;
+      memset(message.data, i & 1 ? 0xFF : 0x00, 8);
+    }
+
+    uint8_t stuffBits;
+    uint16_t bits = twai_frame_bits(&message, &stuffBits);
+    if(bits != reference_bits(&message)) mismatches++;
+    //Without stuff bits a frame is g + 8s + 13 bits long, with g = 34 (standard) or 54 (extended) bits that are stuffed before the data.
+    //At most one in four of the stuffed bits after the first is a stuff bit.
+    uint32_t stuffedBits = (message.extd ? 54 : 34) + 8 * (message.rtr ? 0 : message.data_length_code);
+    if((uint32_t)(bits - stuffBits) != stuffedBits + 13 || stuffBits > (stuffedBits - 1) / 4) outOfBounds++;
+    if(!message.rtr && message.data_length_code == 8 && bits > longest[message.extd]) longest[message.extd] = bits;
+  }
+  printf("Frame lengths: %u mismatches with the bit string encoder, %u outside the bounds in 100000 frames\n", mismatches, outOfBounds);
+  printf("Longest 8 byte frames: %u bits standard (at most 135), %u bits extended (at most 160)\n", longest[0], longest[1]);
+  check(mismatches == 0, "frame lengths equal the bit string encoder's");
+  check(outOfBounds == 0, "frame lengths within the bounds");
+  check(longest[0] <= 135 && longest[1] <= 160, "8 byte frames within the worst case length");
+}
+
+struct MixFrame{
+  twai_message_t message;
+  uint32_t every;             // Sent every this many control periods
+  bool tx;
+};
+
+static twai_message_t mix_frame(uint32_t identifier, bool extd, uint8_t length, uint32_t value){
+  twai_message_t message = {};
+  message.identifier = identifier;
+  message.extd = extd;
+  message.data_length_code = length;
+  for(int i = 0; i < length; i++) message.data[i] = value >> (8 * (i % 4));
+  return message;
+}
+
+static void run_mix(const char *name, const std::vector<MixFrame> &mix){
+  /* Counts a frame mix for 3 s and compares the utilization and per ID rates with the ones calculated from the mix
+    Arguments:
+      - const char *name: Name of the mix
+      - const std::vector<MixFrame> &mix: The frames and their periods
+    Returns:
+      - void
+  */
+  twai_stats_reset();
+  twai_stats_update();
+  double expectedBits = 0;
+  for(size_t i = 0; i < mix.size(); i++) expectedBits += reference_bits(&mix[i].message) * (1000.0 / CHECK_PERIOD_MS / mix[i].every);
+  for(uint32_t period = 0; period < 3000 / CHECK_PERIOD_MS; period++){
+    for(size_t i = 0; i < mix.size(); i++) if(period % mix[i].every == 0) twai_stats_count(&mix[i].message, mix[i].tx);
+    mock_advance_time_us(CHECK_PERIOD_MS * 1000);
+    twai_stats_update();
+  }
+
+  TwaiBusStats stats = get_twai_stats();
+  double expected = expectedBits / stats.bitrate;
+  printf("%s: utilization %.3f%%, expected %.3f%%\n", name, stats.utilization * 100, expected * 100);
+  check(fabs(stats.utilization - expected) < 1e-5, "utilization of the mix");
+  check(fabs(stats.peak_utilization - expected) < 1e-5, "peak utilization of a steady mix");
+  bool ratesOk = stats.tracked_ids == mix.size();
+  for(size_t i = 0; i < mix.size() && ratesOk; i++){
+    const TwaiIdStats &entry = stats.ids[i];
+    double rate = 1000.0 / CHECK_PERIOD_MS / mix[i].every;
+    ratesOk = entry.identifier == mix[i].message.identifier && entry.tx == mix[i].tx && fabs(entry.frame_rate - rate) < 1e-3 &&
+              fabs(entry.byte_rate - rate * mix[i].message.data_length_code) < 1e-3;
+  }
+  check(ratesOk, "per ID frame and byte rates of the mix");
+}
+
+static void check_mixes(){
+  std::vector<MixFrame> setpoints;
+  for(uint8_t node = 7; node <= 11; node++){
+    MixFrame frame = {};
+    encode_vesc_fixed<0, CAN_PACKET_SET_RPM>(&frame.message, (node - 9) * 1500);
+    frame.message.identifier |= node;
+    frame.every = 1;
+    frame.tx = true;
+    setpoints.push_back(frame);
+  }
+  run_mix("5 RPM setpoints at 100 Hz", setpoints);
+
+  std::vector<MixFrame> all = setpoints;
+  for(uint8_t node = 7; node <= 11; node++){
+    MixFrame frame = {mix_frame(vesc_frame_id(node, CAN_PACKET_STATUS), true, 8, node * 1000), 2, false};
+    all.push_back(frame);
+    frame.message = mix_frame(vesc_frame_id(node, CAN_PACKET_STATUS_4), true, 8, 0x015E012C);
+    frame.every = 10;
+    all.push_back(frame);
+  }
+  for(uint32_t id = 100; id <= 102; id++){
+    MixFrame frame = {mix_frame(id, false, 4, id * 7), 10, false};
+    all.push_back(frame);
+  }
+  run_mix("Setpoints, VESC status and actuators controller", all);
+
+  //8 byte frames of zeros with low identifiers, about as stuffed as frames get
+  std::vector<MixFrame> stuffed;
+  for(uint32_t id = 0; id < 30; id++){
+    MixFrame frame = {mix_frame(id, false, 8, 0), 1, false};
+    stuffed.push_back(frame);
+  }
+  run_mix("30 zero filled 8 byte frames every 10 ms", stuffed);
+}
+
+static void check_error_windows(){
+  twai_stats_reset();
+  twai_stats_update();
+  //The transmit error counter rises by 8 every second and the receive error counter falls by 1, with 3 bus errors per second
+  for(uint32_t second = 1; second <= 70; second++){
+    mock_twai_set_error_counters(8 * second, 100 - second);
+    mock_twai_add_bus_errors(3);
+    mock_advance_time_us(1000000);
+    twai_stats_update();
+  }
+  TwaiBusStats stats = get_twai_stats();
+  bool ok = true;
+  for(int i = 0; i < TWAI_STATS_ERROR_WINDOWS; i++){
+    const TwaiErrorWindow &window = stats.errors[i];
+    printf("Errors over %u s: TEC %+d, REC %+d, %u bus errors\n", window.seconds, window.tx_errors, window.rx_errors, window.bus_errors);
+    ok = ok && window.tx_errors == 8 * window.seconds && window.rx_errors == -window.seconds && window.bus_errors == 3 * window.seconds;
+  }
+  check(ok && stats.errors[2].seconds == TWAI_STATS_HISTORY_S, "error counter changes over the windows");
+  check(stats.tx_error_counter == 560 && stats.rx_error_counter == 30, "current error counters");
+  mock_twai_set_error_counters(0, 0);
+}
+
+static void check_json(){
+  static char json[4096];
+  size_t length = twai_stats_json(json, sizeof(json));
+  check(length == strlen(json) && json[0] == '{' && length > 2 && strcmp(json + length - 2, "]}") == 0, "complete JSON");
+  char small[200];
+  length = twai_stats_json(small, sizeof(small));
+  check(length == strlen(small) && length < sizeof(small), "JSON truncated to the buffer");
+}
+
+int run_bus_stats_check(){
+  /* Runs the checks
+    Arguments:
+      - void
+    Returns:
+      - int: Exit code, 1 if a check failed
+  */
+  twai_driver_install(&g_config, &t_config, &f_config);
+  twai_start();
+  check(twai_bitrate(&t_config) == 500000, "bit rate of t_config");
+  check_frame_lengths();
+  check_mixes();
+  check_error_windows();
+  check_json();
+  printf("Bus statistics: %u checks failed\n", failures);
+  return failures == 0 ? 0 : 1;
+}
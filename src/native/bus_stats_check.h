@@ -0,0 +1,10 @@
+#ifndef BUS_STATS_CHECK_H
+#define BUS_STATS_CHECK_H
+
+/* Checks of the bus statistics (TWAI_stats.h) on known inputs. The frame lengths are compared with a straightforward bit string encoder of
+the CAN 2.0 frame format and with the textbook bounds, the CRC with the standard check value, and the utilization, per ID rates and error
+windows with frame mixes and error counts whose numbers are known in advance. Prints the results on stdout. */
+
+int run_bus_stats_check();
+
+#endif
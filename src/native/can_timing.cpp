@@ -0,0 +1,236 @@
+#include <algorithm>
+#include <vector>
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "can_timing.h"
+#include "config.h"
+#include "TWAI_handler.h"
+#include "TWAI_schedule.h"
+#include "TWAI_stats.h"
+#include "virtual_bus.h"
+
+#define TIMING_BUSY_LIMIT_NS 10000000000ULL   // A busy period longer than 10 s is taken as unbounded
+
+static uint32_t failures = 0;
+
+static void check(bool ok, const char *what){
+  if(ok) return;
+  failures++;
+  printf("FAILED: %s\n", what);
+}
+
+static uint64_t ceil_div(uint64_t a, uint64_t b){
+  return (a + b - 1) / b;
+}
+
+void can_response_times(const CanTimingMessage *messages, size_t count, uint32_t bitrate, CanTimingResult *results){
+  /* Calculates the worst case response times of a message set, see can_timing.h
+    Arguments:
+      - const CanTimingMessage *messages: The message set, in any order, each identifier once
+      - size_t count: Number of messages
+      - uint32_t bitrate: Bits per second
+      - CanTimingResult *results: Filled with the result of each message, in the order of messages
+    Returns:
+      - void
+  */
+  uint64_t bitTime = 1000000000ULL / bitrate;
+  std::vector<uint32_t> priorities(count);
+  std::vector<uint64_t> transmission(count), period(count), jitter(count);
+  for(size_t i = 0; i < count; i++){
+    priorities[i] = arbitration_field(&messages[i].frame);
+    transmission[i] = (uint64_t)messages[i].bits * 1000000000ULL / bitrate;
+    period[i] = messages[i].period_us * 1000ULL;
+    jitter[i] = messages[i].jitter_us * 1000ULL;
+  }
+
+  for(size_t m = 0; m < count; m++){
+    CanTimingResult *result = &results[m];
+    *result = CanTimingResult();
+    result->transmission_ns = transmission[m];
+    //A lower priority frame that has started is sent first, the bus is not preempted
+    uint64_t blocking = 0;
+    double utilization = 0;
+    for(size_t k = 0; k < count; k++){
+      if(priorities[k] > priorities[m]) blocking = std::max(blocking, transmission[k]);
+      else utilization += (double)transmission[k] / period[k];
+    }
+    result->blocking_ns = blocking;
+    result->response_ns = UINT64_MAX;
+    if(utilization >= 1) continue;
+
+    //Level-m busy period: the bus is busy with frames of priority m or higher, started by the blocking frame
+    uint64_t busy = transmission[m], next = 0;
+    while(busy <= TIMING_BUSY_LIMIT_NS){
+      next = blocking;
+      for(size_t k = 0; k < count; k++){
+        if(priorities[k] <= priorities[m]) next += ceil_div(busy + jitter[k], period[k]) * transmission[k];
+      }
+      if(next == busy) break;
+      busy = next;
+    }
+    if(busy > TIMING_BUSY_LIMIT_NS) continue;
+    result->busy_period_ns = busy;
+    result->instances = ceil_div(busy + jitter[m], period[m]);
+
+    //Every instance in the busy period: queued behind the earlier instances and the higher priority frames released until its own
+    //transmission starts, which is one bit time after the bus became idle
+    uint64_t response = 0;
+    bool missed = false;
+    for(uint32_t q = 0; q < result->instances && !missed; q++){
+      uint64_t queued = blocking + q * transmission[m];
+      while(true){
+        uint64_t next = blocking + q * transmission[m];
+        for(size_t k = 0; k < count; k++){
+          if(priorities[k] < priorities[m]) next += ceil_div(queued + jitter[k] + bitTime, period[k]) * transmission[k];
+        }
+        //Past the deadline the instance cannot meet it any more, the queuing delay only grows
+        missed = jitter[m] + next + transmission[m] > q * period[m] + messages[m].deadline_us * 1000ULL;
+        bool done = next == queued || missed;
+        queued = next;
+        if(done) break;
+      }
+      response = std::max(response, jitter[m] + queued + transmission[m] - q * period[m]);
+    }
+    result->response_ns = response;
+    result->schedulable = !missed;
+  }
+}
+
+static void check_textbook_example(){
+  /* The example of Davis et al.: messages A, B and C with 125 bit frames at 125 kbit/s (1 ms each), periods and deadlines of 2.5, 3.5 and
+  3.5 ms. The original analysis only looks at the first instance of C and gives 3 ms, the second one is pushed back by the next A and
+  finishes 3.5 ms after its release. */
+  CanTimingMessage messages[3] = {};
+  const uint32_t periods[3] = {2500, 3500, 3500};
+  for(int i = 0; i < 3; i++){
+    snprintf(messages[i].name, sizeof(messages[i].name), "%c", 'A' + i);
+    messages[i].frame.identifier = i + 1;
+    messages[i].bits = 125;
+    messages[i].period_us = periods[i];
+    messages[i].deadline_us = periods[i];
+  }
+  CanTimingResult results[3];
+  can_response_times(messages, 3, 125000, results);
+  printf("Textbook example: R(A) %.1f ms, R(B) %.1f ms, R(C) %.1f ms over %u instances of C (expected 2.0, 3.0, 3.5 over 2)\n",
+         results[0].response_ns / 1e6, results[1].response_ns / 1e6, results[2].response_ns / 1e6, results[2].instances);
+  check(results[0].response_ns == 2000000 && results[1].response_ns == 3000000, "response times of A and B");
+  check(results[2].response_ns == 3500000 && results[2].instances == 2 && results[2].busy_period_ns == 7000000,
+        "response time of C from its second instance");
+  check(results[0].schedulable && results[1].schedulable && results[2].schedulable, "textbook example schedulable");
+
+  //With a shorter deadline for C only the second instance misses it
+  messages[2].deadline_us = 3200;
+  can_response_times(messages, 3, 125000, results);
+  check(!results[2].schedulable && results[1].schedulable, "C misses a 3.2 ms deadline");
+
+  //Over 100% utilization the lowest priority level's busy period never ends
+  messages[2].period_us = messages[2].deadline_us = 1500;
+  can_response_times(messages, 3, 125000, results);
+  check(results[0].schedulable && results[1].schedulable, "higher priority messages of an overloaded bus");
+  check(!results[2].schedulable && results[2].response_ns == UINT64_MAX, "unbounded response time on an overloaded bus");
+
+  check(twai_frame_bits_max(false, 8) == 135 && twai_frame_bits_max(true, 8) == 160, "longest 8 byte frames of 135 and 160 bits");
+}
+
+static CanTimingMessage message(const char *name, const twai_message_t &frame, uint32_t period_us, uint32_t jitter_us){
+  CanTimingMessage message = {};
+  snprintf(message.name, sizeof(message.name), "%s", name);
+  message.frame = frame;
+  message.bits = twai_frame_bits_max(frame.extd, frame.data_length_code);
+  message.period_us = period_us;
+  message.jitter_us = jitter_us;
+  message.deadline_us = period_us;
+  return message;
+}
+
+static std::vector<CanTimingMessage> message_set(bool planned){
+  /* The message set on the bus
+    Arguments:
+      - bool planned: Add the actuators command and the VESCs' status packets
+    Returns:
+      - std::vector<CanTimingMessage>: The messages
+  */
+  std::vector<CanTimingMessage> messages;
+  char name[24];
+  //The TX task hands a frame over in its slot, or a slot later after waiting for room in the driver's queue
+  for(uint8_t node = VESC_FIRST_NODE; node < VESC_FIRST_NODE + VESC_NODE_COUNT; node++){
+    snprintf(name, sizeof(name), "Setpoint VESC %u", node);
+    messages.push_back(message(name, createVESCMessage(node, CAN_PACKET_SET_RPM, 0), tx_schedule_period_us(node - VESC_FIRST_NODE),
+                               TX_SLOT_US));
+  }
+  //The actuators controller reports at 10 Hz, the assembly angles as two floats
+  twai_message_t angles = {};
+  angles.identifier = 42;
+  angles.data_length_code = 8;
+  messages.push_back(message("Assembly angles", angles, 100000, 0));
+  messages.push_back(message("Voltage 1", actuators_controller_frame(100, 0), 100000, 0));
+  messages.push_back(message("Voltage 2", actuators_controller_frame(101, 0), 100000, 0));
+  messages.push_back(message("Temperature", actuators_controller_frame(102, 0), 100000, 0));
+  if(!planned) return messages;
+
+  messages.push_back(message("Actuators command", createActuatorsMessage(ACTUATORS_MESSAGE_ID, true, ACTUATOR_STOP),
+                             tx_schedule_period_us(TX_ACTUATORS_MAILBOX), TX_SLOT_US));
+  //Status 1 (speed, current) at 50 Hz, status 4 and 5 (temperatures, input voltage) at 10 Hz
+  for(uint8_t node = VESC_FIRST_NODE; node < VESC_FIRST_NODE + VESC_NODE_COUNT; node++){
+    snprintf(name, sizeof(name), "Status 1 VESC %u", node);
+    messages.push_back(message(name, vesc_status_frame(node, CAN_PACKET_STATUS, 0, 0, 0), 20000, 0));
+    snprintf(name, sizeof(name), "Status 4 VESC %u", node);
+    messages.push_back(message(name, vesc_status_frame(node, CAN_PACKET_STATUS_4, 0, 0, 0), 100000, 0));
+    snprintf(name, sizeof(name), "Status 5 VESC %u", node);
+    messages.push_back(message(name, vesc_status_frame(node, CAN_PACKET_STATUS_5, 0, 0, 0), 100000, 0));
+  }
+  return messages;
+}
+
+static bool earlier_arbitration(const CanTimingMessage &a, const CanTimingMessage &b){
+  return arbitration_field(&a.frame) < arbitration_field(&b.frame);
+}
+
+static bool analyze(const char *name, std::vector<CanTimingMessage> messages){
+  /* Prints the response times of a message set, highest priority first
+    Arguments:
+      - const char *name: Name of the set
+      - std::vector<CanTimingMessage> messages: The messages
+    Returns:
+      - bool: true if every message meets its deadline
+  */
+  std::sort(messages.begin(), messages.end(), earlier_arbitration);
+  std::vector<CanTimingResult> results(messages.size());
+  uint32_t bitrate = twai_bitrate(&t_config);
+  can_response_times(messages.data(), messages.size(), bitrate, results.data());
+
+  double utilization = 0;
+  bool schedulable = true;
+  for(size_t i = 0; i < messages.size(); i++){
+    utilization += (double)messages[i].bits / bitrate * 1e6 / messages[i].period_us;
+    schedulable = schedulable && results[i].schedulable;
+  }
+  printf("%s: %u messages, worst case utilization %.1f%% at %u bit/s, %s\n", name, (unsigned int)messages.size(), utilization * 100,
+         bitrate, schedulable ? "all deadlines met" : "DEADLINES MISSED");
+  for(size_t i = 0; i < messages.size(); i++){
+    const CanTimingMessage &message = messages[i];
+    const CanTimingResult &result = results[i];
+    char response[16];
+    if(result.response_ns == UINT64_MAX) snprintf(response, sizeof(response), "unbounded");
+    else snprintf(response, sizeof(response), "%.0f us", result.response_ns / 1e3);
+    printf("  %-18s %s ID %8x: %3u bits (%3u us), T %6u us, J %4u us, D %6u us, blocking %3u us, R %9s over %u instances%s\n",
+           message.name, message.frame.extd ? "extended" : "standard", message.frame.identifier, message.bits,
+           result.transmission_ns / 1000, message.period_us, message.jitter_us, message.deadline_us, result.blocking_ns / 1000, response,
+           result.instances, result.schedulable ? "" : ", MISSED");
+  }
+  return schedulable;
+}
+
+int run_can_timing(){
+  /* Runs the checks and the analysis of the message sets
+    Arguments:
+      - void
+    Returns:
+      - int: Exit code, 1 if a check failed or a message misses its deadline
+  */
+  check_textbook_example();
+  check(analyze("Current message set", message_set(false)), "current message set meets its deadlines");
+  check(analyze("Planned message set", message_set(true)), "planned message set meets its deadlines");
+  printf("CAN timing: %u checks failed\n", failures);
+  return failures == 0 ? 0 : 1;
+}
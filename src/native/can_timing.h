@@ -0,0 +1,41 @@
+#ifndef CAN_TIMING_H
+#define CAN_TIMING_H
+
+/* Worst case response time analysis of the CAN message set, before it is flashed. Every message is a periodic frame with a release jitter
+and a deadline, its priority is its arbitration field (arbitration_field()) and its transmission time the longest it can take on the bus
+with bit stuffing (twai_frame_bits_max()) at the bit rate of t_config. The response time, from the release to the end of the frame, is
+bounded with the analysis of Davis, Burns, Bril and Lukkien, "Controller Area Network (CAN) schedulability analysis: Refuted, revisited
+and revised" (2007): blocking by the longest lower priority frame, interference by the higher priority ones, and every instance of the
+message in its level-m busy period, since a frame can be pushed back into the next instance's window. The analysis assumes that every
+node offers its highest priority ready frame to the arbitration and that there are no errors.
+
+The analysis is checked against the textbook example of the paper first, then run on the controller's message set as built by
+createVESCMessage() and createActuatorsMessage() at the periods of the TX schedule (TWAI_schedule.h), with the actuators controller's
+reports, and on the planned set that adds the actuators command and the VESCs' status packets. Prints the response times on stdout. */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "driver/twai.h"
+
+struct CanTimingMessage{
+  char name[24];
+  twai_message_t frame;     // Identifier and format, for the priority
+  uint32_t bits;            // Longest transmission, e.g. twai_frame_bits_max()
+  uint32_t period_us;       // Shortest time between two releases
+  uint32_t jitter_us;       // Release jitter
+  uint32_t deadline_us;     // From the release, at most the period
+};
+
+struct CanTimingResult{
+  uint32_t blocking_ns;     // Longest lower priority frame
+  uint32_t transmission_ns;
+  uint64_t busy_period_ns;  // Level-m busy period, 0 if it does not end (hep utilization of 1 or more)
+  uint32_t instances;       // Instances of the message checked in the busy period
+  uint64_t response_ns;     // Worst case response time, UINT64_MAX if unbounded
+  bool schedulable;
+};
+
+void can_response_times(const CanTimingMessage *messages, size_t count, uint32_t bitrate, CanTimingResult *results);
+int run_can_timing();
+
+#endif
@@ -0,0 +1,174 @@
+#include <chrono>
+#include <vector>
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "dispatch_bench.h"
+#include "TWAI_dispatch.h"
+
+#define VESC_STATUS_NODES 5
+#define VESC_STATUS_COMMANDS 6
+
+// VESC status packets 1 to 6 (CAN_PACKET_STATUS ... CAN_PACKET_STATUS_6)
+static const uint8_t statusCommands[VESC_STATUS_COMMANDS] = {9, 14, 15, 16, 27, 58};
+
+struct Decoded{
+  float values[4];
+  float angles[2];
+  int32_t status[VESC_STATUS_NODES * VESC_STATUS_COMMANDS];
+  uint32_t unknown;
+};
+
+static Decoded decoded;
+
+static int32_t be_int32(const uint8_t *data){
+  return data[0] << 24 | data[1] << 16 | data[2] << 8 | data[3];
+}
+
+static void decode_int32(const twai_message_t *message, void *context){
+  *(float *)context = be_int32(message->data);
+}
+
+static void decode_angles(const twai_message_t *message, void *context){
+  memcpy(context, message->data, 2 * sizeof(float));
+}
+
+static void decode_status(const twai_message_t *message, void *context){
+  *(int32_t *)context = be_int32(message->data);
+}
+
+static void chain(const twai_message_t *message){
+  //handle_received_frame() before the dispatcher
+  if(message->identifier == 100) decoded.values[0] = be_int32(message->data);
+  else if(message->identifier == 101) decoded.values[1] = be_int32(message->data);
+  else if(message->identifier == 102) decoded.values[2] = be_int32(message->data);
+  else if(message->identifier == 42) memcpy(decoded.angles, message->data, 2 * sizeof(float));
+  else decoded.unknown++;
+}
+
+struct LinearEntry{
+  uint32_t identifier;
+  bool extd;
+  FrameDecoder decoder;
+  void *context;
+};
+
+static std::vector<LinearEntry> linear;
+
+static void linear_chain(const twai_message_t *message){
+  //The if/else chain with one branch per decoder
+  for(size_t i = 0; i < linear.size(); i++){
+    if(linear[i].identifier == message->identifier && linear[i].extd == (bool)message->extd){
+      linear[i].decoder(message, linear[i].context);
+      return;
+    }
+  }
+  decoded.unknown++;
+}
+
+static void add(FrameDispatcher *dispatcher, uint32_t identifier, bool extd, FrameDecoder decoder, void *context){
+  dispatcher->add(identifier, extd, decoder, context, "");
+  LinearEntry entry = {identifier, extd, decoder, context};
+  linear.push_back(entry);
+}
+
+static twai_message_t frame(uint32_t identifier, bool extd, uint32_t seed){
+  twai_message_t message = {};
+  message.identifier = identifier;
+  message.extd = extd;
+  message.data_length_code = 8;
+  for(int i = 0; i < 8; i++) message.data[i] = seed >> (i * 3);
+  return message;
+}
+
+static uint32_t next_random(uint32_t *state){
+  *state = *state * 1664525 + 1013904223;
+  return *state >> 8;
+}
+
+template <typename Handler>
+static double measure(Handler handler, const std::vector<twai_message_t> &frames, uint32_t count, uint32_t *checksum){
+  /* Handles count frames, cycling through the mix
+    Arguments:
+      - Handler handler: Called with each frame
+      - const std::vector<twai_message_t> &frames: The mix
+      - uint32_t count: Number of frames to handle
+      - uint32_t *checksum: Filled with a checksum of the decoded values, equal for handlers that decode the same way
+    Returns:
+      - double: Time per frame in ns
+  */
+  decoded = Decoded();
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for(uint32_t i = 0; i < count; i++) handler(&frames[i % frames.size()]);
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  uint32_t sum = decoded.unknown;
+  const uint8_t *bytes = (const uint8_t *)&decoded;
+  for(size_t i = 0; i < sizeof(decoded); i++) sum = sum * 31 + bytes[i];
+  *checksum = sum;
+  return seconds * 1e9 / count;
+}
+
+int run_dispatch_benchmark(uint32_t frames){
+  /* Runs the benchmark
+    Arguments:
+      - uint32_t frames: Number of frames handled per mix and method
+    Returns:
+      - int: Exit code, 1 if the methods decoded differently
+  */
+  static FrameDispatcher actuators;
+  static FrameDispatcher all;
+  //The actuators controller's frames, in both dispatchers. The linear chain gets all decoders.
+  uint32_t ids[4] = {100, 101, 102, 42};
+  for(int i = 0; i < 4; i++){
+    FrameDecoder decoder = ids[i] == 42 ? decode_angles : decode_int32;
+    void *context = ids[i] == 42 ? (void *)decoded.angles : (void *)&decoded.values[i];
+    actuators.add(ids[i], false, decoder, context, "");
+    add(&all, ids[i], false, decoder, context);
+  }
+  for(int node = 0; node < VESC_STATUS_NODES; node++){
+    for(int command = 0; command < VESC_STATUS_COMMANDS; command++){
+      add(&all, vesc_frame_id(7 + node, statusCommands[command]), true, decode_status, &decoded.status[node * VESC_STATUS_COMMANDS + command]);
+    }
+  }
+
+  //Frame mixes
+  uint32_t seed = 1;
+  std::vector<twai_message_t> actuatorsMix, statusMix, unknownMix;
+  for(int i = 0; i < 1024; i++){
+    actuatorsMix.push_back(frame(ids[next_random(&seed) % 4], false, next_random(&seed)));
+    uint32_t pick = next_random(&seed) % (4 + VESC_STATUS_NODES * VESC_STATUS_COMMANDS);
+    if(pick < 4) statusMix.push_back(frame(ids[pick], false, next_random(&seed)));
+    else{
+      pick -= 4;
+      uint32_t identifier = vesc_frame_id(7 + pick / VESC_STATUS_COMMANDS, statusCommands[pick % VESC_STATUS_COMMANDS]);
+      statusMix.push_back(frame(identifier, true, next_random(&seed)));
+    }
+    //VESC commands addressed to the motors, not decoded
+    unknownMix.push_back(frame(vesc_frame_id(7 + next_random(&seed) % 5, next_random(&seed) % 5), true, next_random(&seed)));
+  }
+
+  struct Mix{
+    const char *name;
+    const std::vector<twai_message_t> *frames;
+    bool actuatorsOnly;
+  };
+  Mix mixes[3] = {{"actuators controller", &actuatorsMix, true}, {"actuators + VESC status", &statusMix, false},
+                  {"undecoded VESC commands", &unknownMix, false}};
+
+  printf("ns per frame, %u frames per mix   chain (4)  linear (%u)  dispatcher (4)  dispatcher (%u, %u probes)\n", frames,
+         (unsigned)linear.size(), all.handler_count(), all.max_probes());
+  bool match = true;
+  for(int m = 0; m < 3; m++){
+    const std::vector<twai_message_t> &mix = *mixes[m].frames;
+    uint32_t chainSum, linearSum, actuatorsSum, allSum;
+    double chainNs = measure(chain, mix, frames, &chainSum);
+    double linearNs = measure(linear_chain, mix, frames, &linearSum);
+    double actuatorsNs = measure([](const twai_message_t *message){ if(!actuators.dispatch(message)) decoded.unknown++; }, mix, frames,
+                                 &actuatorsSum);
+    double allNs = measure([](const twai_message_t *message){ if(!all.dispatch(message)) decoded.unknown++; }, mix, frames, &allSum);
+    printf("%-34s %9.2f  %10.2f  %14.2f  %14.2f\n", mixes[m].name, chainNs, linearNs, actuatorsNs, allNs);
+    //The 4 identifier methods only decode the same as the others when the mix has no VESC status frames
+    if(chainSum != actuatorsSum || linearSum != allSum || (mixes[m].actuatorsOnly && chainSum != allSum)) match = false;
+  }
+  printf("Decoded values %s\n", match ? "match" : "DIFFER");
+  return match ? 0 : 1;
+}
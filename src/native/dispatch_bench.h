@@ -0,0 +1,10 @@
+#ifndef DISPATCH_BENCH_H
+#define DISPATCH_BENCH_H
+
+/* Benchmark of the received frame dispatcher (TWAI_dispatch.h) against the identifier if/else chain that handle_received_frame() used
+before, on synthetic frame mixes. The chain is measured as it was, with the actuators controller's 4 identifiers, and grown to also decode
+the VESC status frames, as a linear search over the same decoders. Prints the time per frame of each on stdout. */
+
+int run_dispatch_benchmark(uint32_t frames);
+
+#endif
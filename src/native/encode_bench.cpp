@@ -0,0 +1,164 @@
+#include <chrono>
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "encode_bench.h"
+#include "TWAI_handler.h"
+
+#define GOLDEN_NODE 7
+
+//Within the range every scaling keeps in an int32_t
+static const float goldenValues[] = {0, 1, -1, 0.5f, -0.25f, 0.001f, -0.999f, 12.345f, -1500, 1500, 2000.125f, -2047.9f};
+
+static uint32_t failures = 0;
+
+static bool same_frame(const twai_message_t *a, const twai_message_t *b){
+  return a->flags == b->flags && a->identifier == b->identifier && a->data_length_code == b->data_length_code &&
+         memcmp(a->data, b->data, sizeof(a->data)) == 0;
+}
+
+static void print_frame(const char *label, const twai_message_t *message){
+  printf("  %s: flags %x, ID %x, DLC %u, data", label, message->flags, message->identifier, message->data_length_code);
+  for(int i = 0; i < 8; i++) printf(" %02x", message->data[i]);
+  printf("\n");
+}
+
+static void check(const char *name, const twai_message_t *expected, const twai_message_t *encoded){
+  if(same_frame(expected, encoded)) return;
+  failures++;
+  printf("Mismatch: %s\n", name);
+  print_frame("expected", expected);
+  print_frame("encoded", encoded);
+}
+
+static twai_message_t dirty_frame(){
+  //A frame full of garbage, the encoder must overwrite all of it
+  twai_message_t message;
+  memset(&message, 0xA5, sizeof(message));
+  return message;
+}
+
+template <COMMAND_ID Command>
+static void check_float(const char *name){
+  //The float encoder against createVESCMessage() for all golden values
+  for(size_t i = 0; i < sizeof(goldenValues) / sizeof(goldenValues[0]); i++){
+    twai_message_t expected = createVESCMessage(GOLDEN_NODE, Command, goldenValues[i]);
+    twai_message_t encoded = dirty_frame();
+    encode_vesc<GOLDEN_NODE, Command>(&encoded, goldenValues[i]);
+    check(name, &expected, &encoded);
+  }
+}
+
+template <COMMAND_ID Command, uint32_t InputScale>
+static void check_fixed(const char *name, int32_t value, int32_t raw){
+  //The fixed-point encoder against the exact bus value
+  twai_message_t expected = {};
+  expected.flags = TWAI_MSG_FLAG_EXTD;
+  expected.identifier = (uint32_t)Command << 8 | GOLDEN_NODE;
+  expected.data_length_code = 4;
+  for(int i = 0; i < 4; i++) expected.data[i] = (uint32_t)raw >> (24 - 8 * i);
+  twai_message_t encoded = dirty_frame();
+  encode_vesc_fixed<GOLDEN_NODE, Command, InputScale>(&encoded, value);
+  check(name, &expected, &encoded);
+}
+
+static void check_golden_vectors(){
+  check_float<CAN_PACKET_SET_DUTY>("duty");
+  check_float<CAN_PACKET_SET_CURRENT>("current");
+  check_float<CAN_PACKET_SET_CURRENT_BRAKE>("brake current");
+  check_float<CAN_PACKET_SET_RPM>("RPM");
+  check_float<CAN_PACKET_SET_POS>("position");
+  check_float<CAN_PACKET_SET_CURRENT_REL>("relative current");
+  check_float<CAN_PACKET_SET_CURRENT_BRAKE_REL>("relative brake current");
+  check_float<CAN_PACKET_SET_CURRENT_HANDBRAKE>("handbrake current");
+  check_float<CAN_PACKET_SET_CURRENT_HANDBRAKE_REL>("relative handbrake current");
+
+  //RPM as the control loop sends it, the int setpoints go through unchanged
+  const int32_t rpm[] = {0, 1, -1, 1500, -1500, 32767, -32768, 100000, INT32_MAX, INT32_MIN};
+  for(size_t i = 0; i < sizeof(rpm) / sizeof(rpm[0]); i++) check_fixed<CAN_PACKET_SET_RPM, 1>("fixed RPM", rpm[i], rpm[i]);
+  //Currents in mA, duty cycles in units of 1e-5 and 1e-3. A float in between would give e.g. 699 for 0.7 A.
+  check_fixed<CAN_PACKET_SET_CURRENT, 1000>("fixed current", 700, 700);
+  check_fixed<CAN_PACKET_SET_CURRENT, 1000>("fixed current", -12345, -12345);
+  check_fixed<CAN_PACKET_SET_CURRENT, 1>("fixed current in A", -3, -3000);
+  check_fixed<CAN_PACKET_SET_DUTY, 100000>("fixed duty", 12345, 12345);
+  check_fixed<CAN_PACKET_SET_DUTY, 1000>("fixed duty in 1e-3", -999, -99900);
+  check_fixed<CAN_PACKET_SET_POS, 1000>("fixed position in 1e-3 degrees", 359999, 359999000);
+  check_fixed<CAN_PACKET_SET_CURRENT_BRAKE_REL, 100>("fixed relative brake current in %", 37, 37000);
+}
+
+static twai_message_t frames[5];
+static volatile int32_t setpoint;
+
+template <typename Encoder>
+static double measure(Encoder encoder, uint32_t iterations, uint32_t *checksum){
+  /* Encodes 5 setpoints per iteration
+    Arguments:
+      - Encoder encoder: Called with the setpoint, fills frames
+      - uint32_t iterations: Number of iterations
+      - uint32_t *checksum: Filled with a checksum of the last frames
+    Returns:
+      - double: Time per frame in ns
+  */
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for(uint32_t i = 0; i < iterations; i++){
+    //Read through a volatile so the values are not known at compile time
+    encoder(setpoint + (int32_t)(i & 0x3FF) - 512);
+    //The frames are sent in every iteration, they must not be optimized out
+    asm volatile("" : : "r"(frames) : "memory");
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  uint32_t sum = 0;
+  const uint8_t *bytes = (const uint8_t *)frames;
+  for(size_t i = 0; i < sizeof(frames); i++) sum = sum * 31 + bytes[i];
+  *checksum = sum;
+  return seconds * 1e9 / iterations / 5;
+}
+
+static void encode_old(int32_t value){
+  frames[0] = createVESCMessage(7, CAN_PACKET_SET_RPM, value);
+  frames[1] = createVESCMessage(8, CAN_PACKET_SET_RPM, -value);
+  frames[2] = createVESCMessage(9, CAN_PACKET_SET_RPM, value);
+  frames[3] = createVESCMessage(10, CAN_PACKET_SET_RPM, -value);
+  frames[4] = createVESCMessage(11, CAN_PACKET_SET_RPM, value);
+}
+
+static void encode_float(int32_t value){
+  encode_vesc<7, CAN_PACKET_SET_RPM>(&frames[0], value);
+  encode_vesc<8, CAN_PACKET_SET_RPM>(&frames[1], -value);
+  encode_vesc<9, CAN_PACKET_SET_RPM>(&frames[2], value);
+  encode_vesc<10, CAN_PACKET_SET_RPM>(&frames[3], -value);
+  encode_vesc<11, CAN_PACKET_SET_RPM>(&frames[4], value);
+}
+
+static void encode_fixed(int32_t value){
+  encode_vesc_fixed<7, CAN_PACKET_SET_RPM>(&frames[0], value);
+  encode_vesc_fixed<8, CAN_PACKET_SET_RPM>(&frames[1], -value);
+  encode_vesc_fixed<9, CAN_PACKET_SET_RPM>(&frames[2], value);
+  encode_vesc_fixed<10, CAN_PACKET_SET_RPM>(&frames[3], -value);
+  encode_vesc_fixed<11, CAN_PACKET_SET_RPM>(&frames[4], value);
+}
+
+int run_encode_benchmark(uint32_t iterations){
+  /* Checks the golden vectors and runs the benchmark
+    Arguments:
+      - uint32_t iterations: Number of control loop iterations per encoder
+    Returns:
+      - int: Exit code, 1 if an encoder produced a wrong frame
+  */
+  check_golden_vectors();
+  printf("Golden vectors: %u mismatches\n", failures);
+
+  setpoint = 1500;
+  uint32_t checksums[3];
+  double oldNs = measure(encode_old, iterations, &checksums[0]);
+  double floatNs = measure(encode_float, iterations, &checksums[1]);
+  double fixedNs = measure(encode_fixed, iterations, &checksums[2]);
+  printf("Encoding 5 RPM setpoints, %u iterations:\n", iterations);
+  printf("  createVESCMessage(): %6.2f ns per frame\n", oldNs);
+  printf("  encode_vesc():       %6.2f ns per frame\n", floatNs);
+  printf("  encode_vesc_fixed(): %6.2f ns per frame\n", fixedNs);
+  if(checksums[0] != checksums[1] || checksums[0] != checksums[2]){
+    printf("The encoders produced different frames\n");
+    failures++;
+  }
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,11 @@
+#ifndef ENCODE_BENCH_H
+#define ENCODE_BENCH_H
+
+/* Golden vectors and benchmark of the compile-time specialized VESC frame encoder (encode_vesc() and encode_vesc_fixed() in TWAI_handler.h)
+against createVESCMessage(). The golden vectors cover every command with a value, the frames of both encoders must be equal byte for byte,
+and the fixed-point encoder must produce the exact bus value. The benchmark encodes the 5 setpoints of a control loop iteration with each
+encoder and prints the time per frame on stdout. */
+
+int run_encode_benchmark(uint32_t iterations);
+
+#endif
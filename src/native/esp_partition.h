@@ -0,0 +1,57 @@
+#ifndef ESP_PARTITION_MOCK_H
+#define ESP_PARTITION_MOCK_H
+
+/* Host replacement for the ESP-IDF partition API (esp_partition.h) with the data partitions of the Arduino core's default partition table.
+The flash behaves like NOR flash: an erase sets a 4 KB sector to 0xFF, a write can only clear bits. Every operation counts its bytes and
+takes the time of the real chip in simulated time (mock_devices.h), during which the ESP32 runs nothing but IRAM code. */
+
+#include <Arduino.h>
+
+#define MOCK_FLASH_SECTOR_SIZE 4096
+#define MOCK_FLASH_PAGE_SIZE 256
+#define MOCK_FLASH_PAGE_PROGRAM_US 700      // Typical times of the 4 MB chip of the ESP32 modules
+#define MOCK_FLASH_SECTOR_ERASE_US 45000
+#define MOCK_FLASH_READ_US_PER_KB 25
+
+typedef enum{
+  ESP_PARTITION_TYPE_APP = 0x00,
+  ESP_PARTITION_TYPE_DATA = 0x01
+} esp_partition_type_t;
+
+typedef enum{
+  ESP_PARTITION_SUBTYPE_DATA_NVS = 0x02,
+  ESP_PARTITION_SUBTYPE_DATA_COREDUMP = 0x03,
+  ESP_PARTITION_SUBTYPE_DATA_SPIFFS = 0x82,
+  ESP_PARTITION_SUBTYPE_ANY = 0xff
+} esp_partition_subtype_t;
+
+typedef struct{
+  esp_partition_type_t type;
+  esp_partition_subtype_t subtype;
+  uint32_t address;
+  uint32_t size;
+  char label[17];
+  bool encrypted;
+} esp_partition_t;
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char *label);
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t src_offset, void *dst, size_t size);
+esp_err_t esp_partition_write(const esp_partition_t *partition, size_t dst_offset, const void *src, size_t size);
+esp_err_t esp_partition_erase_range(const esp_partition_t *partition, size_t offset, size_t size);
+
+struct MockFlashStats{
+  uint64_t bytes_read;
+  uint64_t bytes_written;   // Bytes passed to esp_partition_write()
+  uint64_t pages_programmed;  // 256 byte pages touched by the writes
+  uint32_t sectors_erased;
+  uint32_t corrupted;       // Writes that needed a 0 bit to become 1, the flash kept the 0
+  uint64_t busy_us;         // Simulated time spent in flash operations
+  uint32_t max_erases;      // Erase cycles of the most erased sector
+};
+
+MockFlashStats mock_flash_stats();
+void mock_flash_reset_stats();
+//Erase cycles of each sector of a partition, for the wear distribution
+uint32_t mock_flash_erases(const esp_partition_t *partition, uint32_t sector);
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef ESP_TIMER_MOCK_H
+#define ESP_TIMER_MOCK_H
+
+/* Host replacement for the ESP-IDF high resolution timer (esp_timer.h). The timers run on the simulated time: their callbacks are called
+from mock_advance_time_us() at the times they expire, in time order. */
+
+#include <Arduino.h>
+
+typedef struct MockEspTimer *esp_timer_handle_t;
+typedef void (*esp_timer_cb_t)(void *arg);
+
+typedef enum{
+  ESP_TIMER_TASK,
+  ESP_TIMER_ISR
+} esp_timer_dispatch_t;
+
+typedef struct{
+  esp_timer_cb_t callback;
+  void *arg;
+  esp_timer_dispatch_t dispatch_method;
+  const char *name;
+  bool skip_unhandled_events;
+} esp_timer_create_args_t;
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *create_args, esp_timer_handle_t *out_handle);
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us);
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period);
+esp_err_t esp_timer_stop(esp_timer_handle_t timer);
+esp_err_t esp_timer_delete(esp_timer_handle_t timer);
+int64_t esp_timer_get_time();
+
+#endif
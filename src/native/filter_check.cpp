@@ -0,0 +1,154 @@
+#include <math.h>
+#include <random>
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "mock_devices.h"
+#include "filter_check.h"
+#include "config.h"
+#include "TWAI_handler.h"
+#include "TWAI_filter.h"
+#include "TWAI_dispatch.h"
+#include "TWAI_rx.h"
+#include "VESC_status.h"
+
+#define RANDOM_SETS 40
+#define EXT_SAMPLES 1000000         // Random extended identifiers per set
+#define VESC_ID_RANGE 0x10000       // Extended identifiers COMMAND_ID << 8 | node
+
+static uint32_t failures = 0;
+
+static void check(bool ok, const char *what){
+  if(ok) return;
+  failures++;
+  printf("FAILED: %s\n", what);
+}
+
+static bool passes(uint32_t identifier, bool extd, std::mt19937 &random){
+  //Delivers a data frame with random data bytes, which the filter must not compare, and takes it out of the RX queue again
+  twai_message_t message = {};
+  message.identifier = identifier;
+  message.extd = extd;
+  message.data_length_code = 8;
+  for(uint8_t i = 0; i < 8; i++) message.data[i] = random();
+  if(!mock_twai_deliver(&message)) return false;
+  twai_receive(&message, 0);
+  return true;
+}
+
+static bool passes_with_some_data(uint32_t identifier, const twai_filter_config_t *filter, std::mt19937 &random){
+  /* Delivers standard data frames with every first data byte until one passes, as twai_filter_count() counts identifiers that only pass
+  with some data bytes. The single filter compares the second data byte too, only the one in the acceptance code can match.
+    Arguments:
+      - uint32_t identifier: The standard identifier
+      - const twai_filter_config_t *filter: The installed filter
+      - std::mt19937 &random: Source of the other data bytes
+    Returns:
+      - bool: true if a frame passed
+  */
+  for(uint32_t data0 = 0; data0 < 256; data0++){
+    twai_message_t message = {};
+    message.identifier = identifier;
+    message.data_length_code = 8;
+    for(uint8_t i = 0; i < 8; i++) message.data[i] = random();
+    message.data[0] = data0;
+    message.data[1] = filter->acceptance_code & 0xFF;
+    if(!mock_twai_deliver(&message)) continue;
+    twai_receive(&message, 0);
+    return true;
+  }
+  return false;
+}
+
+static bool wanted(const TwaiFilterId *ids, uint8_t count, uint32_t identifier, bool extd){
+  for(uint8_t i = 0; i < count; i++) if(ids[i].identifier == identifier && ids[i].extd == extd) return true;
+  return false;
+}
+
+static void check_set(const char *name, const TwaiFilterId *ids, uint8_t count, bool print){
+  /* Builds the filter of a set, installs it in the mock driver and counts what passes
+    Arguments:
+      - const char *name: Name of the set
+      - const TwaiFilterId *ids: The wanted identifiers
+      - uint8_t count: Their number
+      - bool print: Print the counts
+    Returns:
+      - void
+  */
+  std::mt19937 random(count);
+  twai_filter_config_t filter;
+  TwaiFilterReport report;
+  check(twai_filter_build(ids, count, &filter, &report), name);
+  twai_general_config_t config = g_config;
+  config.rx_queue_len = 1;
+  twai_driver_install(&config, &t_config, &filter);
+  twai_start();
+
+  bool allWanted = true;
+  for(uint8_t i = 0; i < count; i++) allWanted = allWanted && passes(ids[i].identifier, ids[i].extd, random);
+  uint32_t leakedStd = 0;
+  for(uint32_t identifier = 0; identifier <= TWAI_STD_ID_MASK; identifier++){
+    leakedStd += passes_with_some_data(identifier, &filter, random) && !wanted(ids, count, identifier, false);
+  }
+  uint32_t leakedVesc = 0;
+  for(uint32_t identifier = 0; identifier < VESC_ID_RANGE; identifier++){
+    leakedVesc += passes(identifier, true, random) && !wanted(ids, count, identifier, true);
+  }
+  uint32_t sampled = 0;
+  for(uint32_t i = 0; i < EXT_SAMPLES; i++) sampled += passes(random() & TWAI_EXTD_ID_MASK, true, random);
+
+  twai_stop();
+  twai_driver_uninstall();
+
+  //The sample's share of passing identifiers against the reported one, within 5 standard deviations
+  uint32_t wantedExt = 0;
+  for(uint8_t i = 0; i < count; i++) wantedExt += ids[i].extd;
+  double share = (report.leaked_ext + wantedExt) / (double)(TWAI_EXTD_ID_MASK + 1);
+  double expected = share * EXT_SAMPLES;
+  bool sampleMatches = fabs(sampled - expected) <= 5 * sqrt(expected) + 1;
+  if(print){
+    printf("%s: %s filter, code %08x, mask %08x. %u wanted identifiers pass, %u other standard (reported %u), %u other VESC range "
+           "extended, %u of %u random extended (reported %u of 2^29, %.0f expected)\n", name, report.single_filter ? "single" : "dual",
+           filter.acceptance_code, filter.acceptance_mask, allWanted ? count : 0, leakedStd, report.leaked_std, leakedVesc, sampled,
+           EXT_SAMPLES, report.leaked_ext, expected);
+  }
+  check(allWanted, "every wanted identifier passes");
+  check(leakedStd == report.leaked_std, "the reported standard identifiers pass");
+  check(sampleMatches, "the reported share of extended identifiers passes");
+}
+
+int run_filter_check(){
+  /* Runs the checks
+    Arguments:
+      - void
+    Returns:
+      - int: Exit code, 1 if a check failed
+  */
+  //The identifiers of rx_begin(): the actuators controller's and the VESCs' status packets
+  static const uint32_t actuators[] = {100, 101, 102, 42};
+  TwaiFilterId ids[TWAI_FILTER_MAX_IDS];
+  uint8_t count = 0;
+  for(uint8_t i = 0; i < sizeof(actuators) / sizeof(actuators[0]); i++) ids[count++] = {actuators[i], false};
+  for(uint8_t node = VESC_FIRST_NODE; node < VESC_FIRST_NODE + VESC_NODE_COUNT; node++){
+    for(uint8_t i = 0; i < VESC_STATUS_COUNT; i++) ids[count++] = {vesc_frame_id(node, vescStatusPackets[i].command), true};
+  }
+  twai_filter_config_t filter;
+  twai_filter_build(ids, count, &filter, NULL);
+  rx_begin();
+  check(f_config.acceptance_code == filter.acceptance_code && f_config.acceptance_mask == filter.acceptance_mask &&
+        f_config.single_filter == filter.single_filter, "rx_begin() installs the filter of these identifiers");
+  check_set("Firmware identifiers", ids, count, true);
+
+  std::mt19937 random(1);
+  for(uint32_t set = 0; set < RANDOM_SETS; set++){
+    count = 1 + random() % 12;
+    for(uint8_t i = 0; i < count; i++){
+      do{
+        ids[i].extd = random() % 2;
+        ids[i].identifier = random() & (ids[i].extd ? random() % 2 ? 0xFFFF : TWAI_EXTD_ID_MASK : TWAI_STD_ID_MASK);
+      } while(wanted(ids, i, ids[i].identifier, ids[i].extd));
+    }
+    check_set("Random set", ids, count, false);
+  }
+  printf("Filter: %u random sets, %u checks failed\n", RANDOM_SETS, failures);
+  return failures == 0 ? 0 : 1;
+}
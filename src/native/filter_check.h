@@ -0,0 +1,11 @@
+#ifndef FILTER_CHECK_H
+#define FILTER_CHECK_H
+
+/* Checks of the acceptance filter builder (TWAI_filter.h) against the mock driver's filter, which applies the installed code and mask the
+way the controller does. For the firmware's received identifiers and for random sets of mixed formats, every wanted identifier must pass
+and the unwanted identifiers that pass must be the ones the builder reports: all 2048 standard identifiers are tried, the extended ones in
+the VESC range and on a random sample. Prints what leaks through on stdout. */
+
+int run_filter_check();
+
+#endif
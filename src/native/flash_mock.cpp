@@ -0,0 +1,118 @@
+#include <vector>
+#include "esp_partition.h"
+#include "mock_devices.h"
+
+// Mock flash chip with the data partitions of the Arduino core's default partition table (default.csv). The contents start erased.
+static esp_partition_t partitions[] = {
+  {ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_NVS, 0x9000, 0x5000, "nvs", false},
+  {ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_SPIFFS, 0x290000, 0x160000, "spiffs", false},
+  {ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_COREDUMP, 0x3F0000, 0x10000, "coredump", false},
+};
+#define MOCK_PARTITION_COUNT (sizeof(partitions) / sizeof(partitions[0]))
+
+static std::vector<uint8_t> contents[MOCK_PARTITION_COUNT];
+static std::vector<uint32_t> erases[MOCK_PARTITION_COUNT];
+static MockFlashStats flashStats = {};
+
+static size_t index_of(const esp_partition_t *partition){
+  return partition - partitions;
+}
+
+static std::vector<uint8_t> &contents_of(const esp_partition_t *partition){
+  size_t index = index_of(partition);
+  if(contents[index].empty()){
+    contents[index].assign(partition->size, 0xFF);
+    erases[index].assign(partition->size / MOCK_FLASH_SECTOR_SIZE, 0);
+  }
+  return contents[index];
+}
+
+static void busy(uint64_t duration){
+  //The chip is busy, the caller waits
+  flashStats.busy_us += duration;
+  mock_advance_time_us(duration);
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char *label){
+  for(size_t i = 0; i < MOCK_PARTITION_COUNT; i++){
+    if(partitions[i].type != type || (subtype != ESP_PARTITION_SUBTYPE_ANY && partitions[i].subtype != subtype)) continue;
+    if(label == NULL || strcmp(label, partitions[i].label) == 0) return &partitions[i];
+  }
+  return NULL;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t src_offset, void *dst, size_t size){
+  if(partition == NULL || dst == NULL) return ESP_ERR_INVALID_ARG;
+  if(src_offset > partition->size || size > partition->size - src_offset) return ESP_ERR_INVALID_SIZE;
+  std::vector<uint8_t> &flash = contents_of(partition);
+  memcpy(dst, &flash[src_offset], size);
+  flashStats.bytes_read += size;
+  busy((size * MOCK_FLASH_READ_US_PER_KB + 1023) / 1024);
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t *partition, size_t dst_offset, const void *src, size_t size){
+  /* Programs the bytes like NOR flash does, each touched page takes MOCK_FLASH_PAGE_PROGRAM_US
+    Arguments:
+      - const esp_partition_t *partition: The partition
+      - size_t dst_offset: Offset in the partition
+      - const void *src: The data
+      - size_t size: Its length
+    Returns:
+      - esp_err_t: ESP_OK, ESP_ERR_INVALID_ARG or ESP_ERR_INVALID_SIZE
+  */
+  if(partition == NULL || src == NULL) return ESP_ERR_INVALID_ARG;
+  if(dst_offset > partition->size || size > partition->size - dst_offset) return ESP_ERR_INVALID_SIZE;
+  if(size == 0) return ESP_OK;
+  std::vector<uint8_t> &flash = contents_of(partition);
+  const uint8_t *bytes = (const uint8_t *)src;
+  bool corrupted = false;
+  for(size_t i = 0; i < size; i++){
+    uint8_t programmed = flash[dst_offset + i] & bytes[i];
+    corrupted = corrupted || programmed != bytes[i];
+    flash[dst_offset + i] = programmed;
+  }
+  uint64_t pages = (dst_offset + size - 1) / MOCK_FLASH_PAGE_SIZE - dst_offset / MOCK_FLASH_PAGE_SIZE + 1;
+  flashStats.bytes_written += size;
+  flashStats.pages_programmed += pages;
+  flashStats.corrupted += corrupted;
+  busy(pages * MOCK_FLASH_PAGE_PROGRAM_US);
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t *partition, size_t offset, size_t size){
+  /* Erases whole sectors, each takes MOCK_FLASH_SECTOR_ERASE_US
+    Arguments:
+      - const esp_partition_t *partition: The partition
+      - size_t offset: Offset in the partition, a multiple of the sector size
+      - size_t size: A multiple of the sector size
+    Returns:
+      - esp_err_t: ESP_OK, ESP_ERR_INVALID_ARG or ESP_ERR_INVALID_SIZE
+  */
+  if(partition == NULL) return ESP_ERR_INVALID_ARG;
+  if(offset > partition->size || size > partition->size - offset) return ESP_ERR_INVALID_SIZE;
+  if(offset % MOCK_FLASH_SECTOR_SIZE != 0 || size % MOCK_FLASH_SECTOR_SIZE != 0) return ESP_ERR_INVALID_SIZE;
+  std::vector<uint8_t> &flash = contents_of(partition);
+  std::vector<uint32_t> &cycles = erases[index_of(partition)];
+  memset(&flash[offset], 0xFF, size);
+  for(size_t sector = offset / MOCK_FLASH_SECTOR_SIZE; sector < (offset + size) / MOCK_FLASH_SECTOR_SIZE; sector++){
+    cycles[sector]++;
+    if(cycles[sector] > flashStats.max_erases) flashStats.max_erases = cycles[sector];
+  }
+  flashStats.sectors_erased += size / MOCK_FLASH_SECTOR_SIZE;
+  busy(size / MOCK_FLASH_SECTOR_SIZE * MOCK_FLASH_SECTOR_ERASE_US);
+  return ESP_OK;
+}
+
+MockFlashStats mock_flash_stats(){
+  return flashStats;
+}
+
+void mock_flash_reset_stats(){
+  flashStats = MockFlashStats();
+}
+
+uint32_t mock_flash_erases(const esp_partition_t *partition, uint32_t sector){
+  contents_of(partition);
+  return sector < erases[index_of(partition)].size() ? erases[index_of(partition)][sector] : 0;
+}
@@ -0,0 +1,127 @@
+#include <stdio.h>
+#include "gesture_check.h"
+#include "Gesture.h"
+
+#define TICK_MS 10                // The control task ticks the gestures once per period
+#define IDLE_MINUTES 40           // Past the 35.8 min of a signed 32 bit us difference
+#define EDGE_SKEW_US 3            // An edge timestamped this long after button_update() took the time
+
+enum STEP{
+  PRESS,
+  RELEASE,
+  WAIT,                           // Ticks every TICK_MS up to the time
+  EARLY_TICK                      // One tick EDGE_SKEW_US before the previous edge, the time is unused
+};
+
+struct Step{
+  uint8_t type;
+  uint32_t ms;                    // Since the start of the sequence
+};
+
+static uint32_t failures = 0;
+
+static void check(bool ok, const char *what){
+  if(ok) return;
+  failures++;
+  printf("FAILED: %s\n", what);
+}
+
+static void add(uint32_t *totals, uint8_t gestures){
+  //Counts of GESTURE_SHORT, GESTURE_LONG, GESTURE_DOUBLE and GESTURE_REPEAT
+  for(int i = 0; i < 4; i++) totals[i] += (gestures >> i) & 1;
+}
+
+static void run(const char *name, const GestureConfig *config, uint32_t start, const Step *steps, size_t length, uint8_t shorts,
+                uint8_t longs, uint8_t doubles, uint8_t repeats){
+  /* Feeds a sequence to a new state and compares the number of each gesture
+    Arguments:
+      - const char *name: Name of the sequence
+      - const GestureConfig *config: The button's parameters
+      - uint32_t start: Time of the sequence's start in us, to cross the wrap
+      - const Step *steps: The sequence, in time order
+      - size_t length: Its number of steps
+      - uint8_t shorts, longs, doubles, repeats: Expected number of each gesture
+    Returns:
+      - void
+  */
+  GestureState state = {};
+  uint32_t totals[4] = {0, 0, 0, 0};
+  uint32_t now = 0;
+  for(size_t i = 0; i < length; i++){
+    if(steps[i].type == EARLY_TICK){
+      add(totals, gesture_tick(&state, config, start + now * 1000 - EDGE_SKEW_US));
+      continue;
+    }
+    if(steps[i].type == WAIT){
+      for(; now + TICK_MS <= steps[i].ms; now += TICK_MS){
+        add(totals, gesture_tick(&state, config, start + (now + TICK_MS) * 1000));
+      }
+      continue;
+    }
+    now = steps[i].ms;
+    add(totals, gesture_edge(&state, config, steps[i].type == PRESS, start + now * 1000));
+  }
+  bool ok = totals[0] == shorts && totals[1] == longs && totals[2] == doubles && totals[3] == repeats;
+  printf("%-42s short %u, long %u, double %u, repeat %u\n", name, totals[0], totals[1], totals[2], totals[3]);
+  check(ok, name);
+}
+
+int run_gesture_check(){
+  /* Runs the checks
+    Arguments:
+      - void
+    Returns:
+      - int: Exit code, 1 if a check failed
+  */
+  //lockout, short, long, double, repeat delay, repeat interval
+  static const GestureConfig single = {50, 400, 800, 0, 0, 0};
+  static const GestureConfig doubles = {50, 400, 800, 300, 0, 0};
+  static const GestureConfig repeat = {50, 400, 800, 0, 600, 200};
+  static const uint32_t nearWrap = 0xFFFFFFFF - 150000;     // 150 ms before the wrap
+  static const uint32_t idle = IDLE_MINUTES * 60000;
+
+  static const Step shortPress[] = {{PRESS, 100}, {RELEASE, 200}, {WAIT, 1000}};
+  run("Short press", &single, 0, shortPress, 3, 1, 0, 0, 0);
+  run("Short press, double presses enabled", &doubles, 0, shortPress, 3, 1, 0, 0, 0);
+  static const Step slowPress[] = {{PRESS, 100}, {RELEASE, 600}, {WAIT, 1000}};
+  run("Press longer than short_ms", &single, 0, slowPress, 3, 0, 0, 0, 0);
+  static const Step longPress[] = {{PRESS, 100}, {WAIT, 2500}, {RELEASE, 2500}, {WAIT, 3000}};
+  run("Long press", &single, 0, longPress, 4, 0, 1, 0, 0);
+  static const Step doublePress[] = {{PRESS, 100}, {RELEASE, 200}, {WAIT, 250}, {PRESS, 280}, {RELEASE, 380}, {WAIT, 1500}};
+  run("Double press", &doubles, 0, doublePress, 6, 0, 0, 1, 0);
+  static const Step twoPresses[] = {{PRESS, 100}, {RELEASE, 200}, {WAIT, 600}, {PRESS, 600}, {RELEASE, 700}, {WAIT, 1500}};
+  run("Two presses out of the double window", &doubles, 0, twoPresses, 6, 2, 0, 0, 0);
+  //Repeats at 600, 800, ..., 1800 ms of holding
+  static const Step held[] = {{PRESS, 100}, {WAIT, 2000}, {RELEASE, 2000}, {WAIT, 2500}};
+  run("Hold to repeat", &repeat, 0, held, 4, 0, 1, 0, 7);
+  static const Step bounce[] = {{PRESS, 100}, {RELEASE, 200}, {PRESS, 230}, {RELEASE, 300}, {WAIT, 400}, {PRESS, 400}, {RELEASE, 500},
+                                {WAIT, 1000}};
+  run("Press within the lockout", &single, 0, bounce, 8, 2, 0, 0, 0);
+
+  run("Short press across the wrap", &single, nearWrap, shortPress, 3, 1, 0, 0, 0);
+  run("Long press across the wrap", &single, nearWrap, longPress, 4, 0, 1, 0, 0);
+  run("Double press across the wrap", &doubles, nearWrap, doublePress, 6, 0, 0, 1, 0);
+  run("Lockout across the wrap", &single, nearWrap, bounce, 8, 2, 0, 0, 0);
+  run("Hold to repeat across the wrap", &repeat, nearWrap, held, 4, 0, 1, 0, 7);
+
+  //Ticks at a time taken before an edge that is fed first: no time passed since the edge
+  static const Step earlyPress[] = {{PRESS, 100}, {EARLY_TICK, 0}, {RELEASE, 200}, {WAIT, 1000}};
+  run("Tick before a press", &single, 0, earlyPress, 4, 1, 0, 0, 0);
+  run("Tick before a press across the wrap", &single, nearWrap, earlyPress, 4, 1, 0, 0, 0);
+  static const Step earlyRelease[] = {{PRESS, 100}, {RELEASE, 200}, {EARLY_TICK, 0}, {PRESS, 280}, {RELEASE, 380}, {WAIT, 1500}};
+  run("Tick before the release of a double press", &doubles, 0, earlyRelease, 6, 0, 0, 1, 0);
+  static const Step earlyBounce[] = {{PRESS, 100}, {RELEASE, 200}, {EARLY_TICK, 0}, {PRESS, 230}, {RELEASE, 300}, {WAIT, 400},
+                                     {PRESS, 400}, {RELEASE, 500}, {WAIT, 1000}};
+  run("Tick before a release, then a bounce", &single, 0, earlyBounce, 9, 2, 0, 0, 0);
+
+  //A press 40 min after the last release is outside the lockout, whether the state was ticked meanwhile or not
+  const Step idleTicked[] = {{PRESS, 100}, {RELEASE, 200}, {WAIT, idle}, {PRESS, idle + 10}, {RELEASE, idle + 100}, {WAIT, idle + 500}};
+  run("Press after 40 min, ticked", &single, 0, idleTicked, 6, 2, 0, 0, 0);
+  const Step idleEdges[] = {{PRESS, 100}, {RELEASE, 200}, {PRESS, idle + 10}, {RELEASE, idle + 100}, {WAIT, idle + 500}};
+  run("Press after 40 min, not ticked", &single, 0, idleEdges, 5, 2, 0, 0, 0);
+  const Step firstPress[] = {{PRESS, idle}, {RELEASE, idle + 100}, {WAIT, idle + 500}};
+  run("First press after 40 min of uptime", &single, 0, firstPress, 3, 1, 0, 0, 0);
+
+  printf("Gestures: %u checks failed\n", failures);
+  return failures == 0 ? 0 : 1;
+}
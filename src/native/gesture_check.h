@@ -0,0 +1,10 @@
+#ifndef GESTURE_CHECK_H
+#define GESTURE_CHECK_H
+
+/* Checks of the button gesture recognizer (Gesture.h) on synthetic edge sequences: short, long, double and repeated presses, presses within
+the lockout, sequences across the wrap of the 32 bit us time and presses after idle times longer than the signed range of that time. Prints
+the results on stdout. */
+
+int run_gesture_check();
+
+#endif
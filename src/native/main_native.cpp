@@ -0,0 +1,239 @@
+/*  Entry point of the native (Linux host) environment. It runs the controller's control path, main_loop() and everything it calls, against
+    the mock devices in mock_devices.h and reports how fast it runs. The simulated time advances by one control period per iteration, the
+    throughput is measured in wall clock time.
+
+    Usage: program [iterations] [-v]
+           program --replay <trace> [-v]
+           program --dispatch [iterations]
+           program --encode [iterations]
+           program --bus
+           program --recovery
+           program --vbus [seconds]
+           program --motor
+           program --timing
+           program --sniffer
+           program --recorder
+           program --gesture
+           program --filter
+           program --periodic
+           program --vesc
+      - iterations: Number of main_loop() iterations, of frames per mix and method with --dispatch or of encoded setpoint sets per encoder
+        with --encode (default 100000)
+      - --replay: Replay a recorded trace instead of the synthetic inputs and print the transmitted frames (see replay.h)
+      - --dispatch: Benchmark the received frame dispatcher against an if/else chain (see dispatch_bench.h)
+      - --encode: Check the VESC frame encoders against golden vectors and benchmark them (see encode_bench.h)
+      - --bus: Check the bus statistics and the utilization estimate on known frame mixes (see bus_stats_check.h)
+      - --recovery: Check the bus error recovery on injected bus-offs (see recovery_check.h)
+      - --vbus: Load test the CAN paths on the virtual bus, seconds of simulated time per scenario (default 10, see vbus_bench.h)
+      - --motor: Check the VESC motor model and run the stair climbing sequence and assembly PID tuning on it (see motor_bench.h)
+      - --timing: Check the CAN response time analysis and run it on the message set (see can_timing.h)
+      - --sniffer: Check the SLCAN sniffer's output against a saturated virtual bus (see sniffer_check.h)
+      - --recorder: Check the black box recorder's encoding, export and flash wear (see recorder_check.h)
+      - --gesture: Check the button gesture recognizer on synthetic edge sequences (see gesture_check.h)
+      - --filter: Check the acceptance filters built from identifier sets against the mock driver's filter (see filter_check.h)
+      - --periodic: Check the periodic task timer's jitter and overrun statistics on scripted iterations (see periodic_check.h)
+      - --vesc: Check the VESC status packet decoders on golden frames (see vesc_check.h)
+      - -v: Print the controller's serial output, with the log level set to debug
+*/
+
+#include <chrono>
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "driver/twai.h"
+#include "mock_devices.h"
+#include "config.h"
+#include "TWAI_handler.h"
+#include "TWAI_rx.h"
+#include "TWAI_tx.h"
+#include "TWAI_schedule.h"
+#include "Latency.h"
+#include "TWAI_recovery.h"
+#include "TWAI_stats.h"
+#include "TWAI_dispatch.h"
+#include "VESC_status.h"
+#include "Screen_handler.h"
+#include "Control_handler.h"
+#include "Task_timing.h"
+#include "Profiler.h"
+#include "Log.h"
+#include "Button_handler.h"
+#include "replay.h"
+#include "dispatch_bench.h"
+#include "encode_bench.h"
+#include "bus_stats_check.h"
+#include "recovery_check.h"
+#include "virtual_bus.h"
+#include "vbus_bench.h"
+#include "motor_bench.h"
+#include "can_timing.h"
+#include "sniffer_check.h"
+#include "recorder_check.h"
+#include "gesture_check.h"
+#include "filter_check.h"
+#include "periodic_check.h"
+#include "vesc_check.h"
+
+static TFT_eSPI tft = TFT_eSPI();
+static TFT_eSprite img = TFT_eSprite(&tft);
+
+//Last RPM setpoint sent to each VESC, reported back in its status packets
+static int32_t vescRpm[VESC_NODE_COUNT];
+
+static void count_frame(const twai_message_t *message, void *context){
+  (*(uint32_t *)context)++;
+  uint8_t index = (message->identifier & 0xFF) - VESC_FIRST_NODE;
+  if(message->extd && message->identifier >> 8 == CAN_PACKET_SET_RPM && index < VESC_NODE_COUNT){
+    vescRpm[index] = (int32_t)((uint32_t)message->data[0] << 24 | message->data[1] << 16 | message->data[2] << 8 | message->data[3]);
+  }
+}
+
+static int sweep(uint32_t iteration, int low, int high){
+  //Triangle wave over the joystick's range, one full sweep every 400 iterations
+  uint32_t phase = iteration % 400;
+  if(phase >= 200) phase = 400 - phase;
+  return low + (high - low) * (int)phase / 200;
+}
+
+static void render_frame(){
+  //Same drawing as the firmware's render task
+  ScreenState state = screenState.read();
+  if(state.configMode) configureMode(&state, &tft, &img);
+  else createScreen(state.speed, state.driveMode, &tft, &img);
+  displayBatteries(state.voltage1, state.voltage2, &tft, &img);
+}
+
+int main(int argc, char **argv){
+  uint32_t iterations = 100000;
+  bool verbose = false;
+  const char *replayPath = NULL;
+  bool dispatchBenchmark = false;
+  bool encodeBenchmark = false;
+  bool busStatsCheck = false;
+  bool recoveryCheck = false;
+  bool virtualBus = false;
+  bool motorModel = false;
+  bool canTiming = false;
+  bool snifferCheck = false;
+  bool recorderCheck = false;
+  bool gestureCheck = false;
+  bool filterCheck = false;
+  bool periodicCheck = false;
+  bool vescCheck = false;
+  uint32_t vbusSeconds = 10;
+  for(int i = 1; i < argc; i++){
+    if(strcmp(argv[i], "-v") == 0) verbose = true;
+    else if(strcmp(argv[i], "--replay") == 0 && i + 1 < argc) replayPath = argv[++i];
+    else if(strcmp(argv[i], "--dispatch") == 0) dispatchBenchmark = true;
+    else if(strcmp(argv[i], "--encode") == 0) encodeBenchmark = true;
+    else if(strcmp(argv[i], "--bus") == 0) busStatsCheck = true;
+    else if(strcmp(argv[i], "--recovery") == 0) recoveryCheck = true;
+    else if(strcmp(argv[i], "--vbus") == 0) virtualBus = true;
+    else if(strcmp(argv[i], "--motor") == 0) motorModel = true;
+    else if(strcmp(argv[i], "--timing") == 0) canTiming = true;
+    else if(strcmp(argv[i], "--sniffer") == 0) snifferCheck = true;
+    else if(strcmp(argv[i], "--recorder") == 0) recorderCheck = true;
+    else if(strcmp(argv[i], "--gesture") == 0) gestureCheck = true;
+    else if(strcmp(argv[i], "--filter") == 0) filterCheck = true;
+    else if(strcmp(argv[i], "--periodic") == 0) periodicCheck = true;
+    else if(strcmp(argv[i], "--vesc") == 0) vescCheck = true;
+    else iterations = vbusSeconds = strtoul(argv[i], NULL, 10);
+  }
+  mock_serial_output(verbose);
+  if(verbose) logLevel = LOG_LEVEL_DEBUG;
+  if(replayPath != NULL) return run_replay(replayPath);
+  if(dispatchBenchmark) return run_dispatch_benchmark(iterations);
+  if(encodeBenchmark) return run_encode_benchmark(iterations);
+  if(busStatsCheck) return run_bus_stats_check();
+  if(recoveryCheck) return run_recovery_check();
+  if(virtualBus) return run_vbus_benchmark(vbusSeconds);
+  if(motorModel) return run_motor_benchmark();
+  if(canTiming) return run_can_timing();
+  if(snifferCheck) return run_sniffer_check();
+  if(recorderCheck) return run_recorder_check();
+  if(gestureCheck) return run_gesture_check();
+  if(filterCheck) return run_filter_check();
+  if(periodicCheck) return run_periodic_check();
+  if(vescCheck) return run_vesc_check();
+
+  uint32_t transmittedFrames = 0;
+  mock_twai_set_tx_handler(count_frame, &transmittedFrames);
+  rx_begin();
+  twai_recovery_begin();
+  g_config.rx_queue_len = TWAI_RX_QUEUE_LEN;
+  g_config.tx_queue_len = TWAI_TX_QUEUE_LEN;
+  twai_driver_install(&g_config, &t_config, &f_config);
+  twai_start();
+  button_begin();
+
+  mock_set_analog(JOYSTICKX, xMidLevel);
+  mock_set_analog(JOYSTICKY, yMidLevel);
+  driveMode = true;
+  publish_screen_state();
+
+  MockClock clock;
+  PeriodicTimer controlTimer(&clock, 1000000 / CONTROL_LOOP_HZ);
+  uint32_t renderDivider = CONTROL_LOOP_HZ / RENDER_FPS;
+  if(renderDivider == 0) renderDivider = 1;
+
+  profiler_reset();
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  controlTimer.begin();
+  tx_schedule_start();
+  for(uint32_t i = 0; i < iterations; i++){
+    mock_set_analog(JOYSTICKX, sweep(i, xMin, xMax));
+    mock_set_analog(JOYSTICKY, sweep(i + 100, yMin, yMax));
+
+    //The actuators controller reports every 100 ms
+    if(i % (CONTROL_LOOP_HZ / 10) == 0){
+      twai_message_t message = actuators_controller_frame(100, 24);
+      mock_twai_deliver(&message);
+      message = actuators_controller_frame(101, 23);
+      mock_twai_deliver(&message);
+      message = actuators_controller_frame(102, 31);
+      mock_twai_deliver(&message);
+    }
+    //The VESCs report their speed at 50 Hz, temperatures and input voltage at 10 Hz
+    for(int node = 0; node < VESC_NODE_COUNT && i % 2 == 0; node++){
+      twai_message_t message = vesc_status_frame(VESC_FIRST_NODE + node, CAN_PACKET_STATUS, vescRpm[node], 0, 0);
+      mock_twai_deliver(&message);
+      if(i % (CONTROL_LOOP_HZ / 10) != 0) continue;
+      message = vesc_status_frame(VESC_FIRST_NODE + node, CAN_PACKET_STATUS_4, 300 << 16 | 350, 0, 0);
+      mock_twai_deliver(&message);
+      message = vesc_status_frame(VESC_FIRST_NODE + node, CAN_PACKET_STATUS_5, 0, 240, 0);
+      mock_twai_deliver(&message);
+    }
+    while(receive_frame(0) == ESP_OK);
+    twai_recovery_run(0);
+
+    //Another node keeps the bus busy for 3 control periods every second, the TX mailboxes hold the setpoints meanwhile
+    if(i % CONTROL_LOOP_HZ == 0) mock_twai_set_tx_blocked(true);
+    else if(i % CONTROL_LOOP_HZ == 3) mock_twai_set_tx_blocked(false);
+
+    main_loop();
+    log_drain();
+    if(i % renderDivider == 0){
+      PROFILE_START(STAGE_SCREEN);
+      render_frame();
+      PROFILE_END(STAGE_SCREEN);
+    }
+    controlTimer.wait_for_next_period();
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  mock_serial_output(true);
+  MockTftStats tftStats = mock_tft_stats();
+  TaskTimingStats timing = controlTimer.get_stats();
+  Serial.printf("%u iterations in %.3f s: %.0f iterations/s, %.2f us per iteration\n", iterations, seconds, iterations / seconds,
+                seconds * 1e6 / iterations);
+  Serial.printf("Simulated time %.1f s, %u control periods, %u overruns\n", mock_time_us() / 1e6, timing.cycles, timing.overruns);
+  Serial.printf("TWAI frames transmitted: %u, screen pixels pushed: %llu\n", transmittedFrames, (unsigned long long)tftStats.pixels_pushed);
+  print_tx_stats();
+  print_tx_schedule_stats();
+  print_latency_stats();
+  print_rx_stats();
+  print_twai_stats();
+  print_recovery_stats();
+  print_vesc_telemetry();
+  profiler_dump();
+  return 0;
+}
@@ -0,0 +1,55 @@
+#ifndef MOCK_DEVICES_H
+#define MOCK_DEVICES_H
+
+/* Simulated hardware of the native environment. The host program sets the joystick, the buttons and the received TWAI frames through these
+functions and advances the simulated time, the controller's code reads them through the normal Arduino/ESP-IDF API. */
+
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "Task_timing.h"
+
+//Simulated time. millis()/micros(), esp_timer and the FreeRTOS delays use it, it only advances when the host program, a delay or a
+//digitalRead() advances it. Expired esp_timer timers (esp_timer.h) call their callbacks meanwhile.
+uint64_t mock_time_us();
+void mock_set_time_us(uint64_t time);
+void mock_advance_time_us(uint64_t time);
+//Called when the simulated time reaches the time the listener returned last (the first call is at the next advance), e.g. to apply the
+//inputs of a replayed trace at their recorded times. The listener returns the next time it wants to be called.
+typedef uint64_t (*MockTimeListener)(uint64_t time);
+void mock_set_time_listener(MockTimeListener listener);
+
+//Pins. Changing a digital level calls the interrupt handler attached to the pin, if the edge matches its mode.
+void mock_set_analog(uint8_t pin, uint16_t value);
+void mock_set_digital(uint8_t pin, int level);
+
+//Serial port
+void mock_serial_output(bool enabled);
+void mock_serial_input(const char *text);
+
+//TWAI controller. Transmitted frames are handed to the TX handler, while the bus is blocked they wait in the driver's TX queue. Received
+//frames are put in the driver's RX queue with mock_twai_deliver().
+typedef void (*MockTwaiTxHandler)(const twai_message_t *message, void *context);
+void mock_twai_set_tx_handler(MockTwaiTxHandler handler, void *context);
+bool mock_twai_deliver(const twai_message_t *message);
+void mock_twai_set_state(twai_state_t state);
+void mock_twai_raise_alerts(uint32_t alerts);
+void mock_twai_set_error_counters(uint32_t tx_errors, uint32_t rx_errors);
+void mock_twai_add_bus_errors(uint32_t errors);
+void mock_twai_set_tx_blocked(bool blocked);
+uint32_t mock_twai_transmitted();
+//Used by the virtual bus (virtual_bus.h): while attached, transmitted frames wait in the driver's TX queue until the bus sends them
+void mock_twai_attach_bus(bool attached);
+bool mock_twai_tx_next(twai_message_t *message);
+void mock_twai_tx_done();
+void mock_twai_rx_done();
+void mock_twai_arbitration_lost();
+void mock_twai_bus_error(bool transmitter);
+
+//Clock running on the simulated time, for PeriodicTimer. Sleeping advances the simulated time to the wake up time.
+class MockClock : public Clock{
+  public:
+  uint32_t now_us();
+  void sleep_until_us(uint32_t wake_time);
+};
+
+#endif
@@ -0,0 +1,27 @@
+#include <TFT_eSPI.h>
+
+static MockTftStats tftStats = {};
+
+MockTftStats mock_tft_stats(){
+  return tftStats;
+}
+
+void mock_tft_reset_stats(){
+  tftStats = MockTftStats();
+}
+
+void mock_tft_count_screen(uint64_t pixels){
+  tftStats.pixels_pushed += pixels;
+}
+
+void mock_tft_count_sprite(uint64_t pixels){
+  tftStats.sprite_pixels += pixels;
+}
+
+void mock_tft_count_push(){
+  tftStats.sprites_pushed++;
+}
+
+void mock_tft_count_fill(){
+  tftStats.screen_fills++;
+}
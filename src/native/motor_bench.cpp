@@ -0,0 +1,268 @@
+#include <math.h>
+#include <chrono>
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "mock_devices.h"
+#include "virtual_bus.h"
+#include "vesc_model.h"
+#include "motor_bench.h"
+#include "config.h"
+#include "TWAI_handler.h"
+#include "TWAI_rx.h"
+#include "TWAI_tx.h"
+#include "TWAI_schedule.h"
+#include "TWAI_recovery.h"
+#include "Control_handler.h"
+#include "Button_handler.h"
+#include "PID_Controller.h"
+#include "Log.h"
+
+#define SLICE_US 1000                 // The RX path runs after each slice of bus time
+#define PERIOD_US (1000000 / CONTROL_LOOP_HZ)
+#define LEFT_ASSEMBLY_VESC 8
+#define RIGHT_ASSEMBLY_VESC 10
+#define ASSEMBLY_GEAR_RATIO 100.0f
+#define PID_TARGET_DEG 90.0f
+#define PID_SETTLED_DEG 2.0f
+
+struct PidGains{
+  float kp;
+  float kd;
+  float ki;
+};
+
+//A step of a closed loop, run at the start of every control period
+typedef void (*ControlStep)(void *context);
+
+static uint32_t failures = 0;
+
+static void check(bool ok, const char *what){
+  if(ok) return;
+  failures++;
+  printf("FAILED: %s\n", what);
+}
+
+static float omega(float erpm, const VescMotorConfig &config){
+  return erpm / config.pole_pairs * 2 * (float)M_PI / 60;
+}
+
+static void check_model(){
+  //Free motor well within its current limit: first order step response, 1 - 1/e of the target after one time constant
+  VescMotorConfig free = VESC_DRIVE_MOTOR;
+  free.friction = 0;
+  free.current_max = 1000;
+  VescMotorModel motor(free);
+  motor.set_erpm(3000);
+  motor.advance(free.time_constant);
+  float expected = 3000 * (1 - expf(-1));
+  printf("Step response: %.1f ERPM after one time constant, expected %.1f\n", motor.erpm(), expected);
+  check(fabsf(motor.erpm() - expected) < 0.005f * expected, "first order step response");
+
+  //Drive motor at its current limit: accelerates against the friction only, omega = kt I / b (1 - e^(-b t / J))
+  const VescMotorConfig &drive = VESC_DRIVE_MOTOR;
+  VescMotorModel limited(drive);
+  limited.set_erpm(9000);
+  limited.advance(0.2f);
+  expected = drive.kt * drive.current_max / drive.friction * (1 - expf(-drive.friction * 0.2f / drive.inertia));
+  float actual = omega(limited.erpm(), drive);
+  printf("Current limit: %.2f rad/s after 0.2 s at %.0f A, expected %.2f rad/s\n", actual, limited.current(), expected);
+  check(fabsf(actual - expected) < 0.01f * expected && limited.current() == drive.current_max, "acceleration at the current limit");
+
+  //Assembly held at standstill: the current carries the load
+  const VescMotorConfig &assembly = VESC_ASSEMBLY_MOTOR;
+  VescMotorModel held(assembly);
+  held.set_erpm(0);
+  held.advance(1);
+  printf("Held load: %.3f A, expected %.3f A, %.2f ERPM\n", held.current(), assembly.load_torque / assembly.kt, held.erpm());
+  check(fabsf(held.current() - assembly.load_torque / assembly.kt) < 0.001f && fabsf(held.erpm()) < 1, "current holding the load");
+
+  //Commands above the speed limit are limited
+  VescMotorModel fast(assembly);
+  fast.set_erpm(2 * assembly.erpm_max);
+  fast.advance(1);
+  check(fabsf(fast.erpm() - assembly.erpm_max) < 0.01f * assembly.erpm_max, "speed limit");
+
+  //Released after the VESC's timeout, the assembly turns back under its weight
+  mock_advance_time_us(1000000);
+  VescNode node(LEFT_ASSEMBLY_VESC, 20000, 100000, assembly);
+  twai_message_t command = {};
+  encode_vesc_fixed<LEFT_ASSEMBLY_VESC, CAN_PACKET_SET_RPM>(&command, 1000);
+  node.receive(&command, mock_time_us());
+  node.advance_to(mock_time_us() + VESC_CAN_TIMEOUT_MS * 1000 - 1000);
+  float commanded = node.motor.erpm();
+  node.advance_to(mock_time_us() + VESC_CAN_TIMEOUT_MS * 1000 + 200000);
+  printf("Timeout: %.0f ERPM while commanded, %.0f ERPM 200 ms after the timeout\n", commanded, node.motor.erpm());
+  check(fabsf(commanded - 1000) < 1 && node.motor.erpm() < 0, "motor released after the timeout");
+}
+
+static void run_periods(VirtualBus &bus, uint32_t periods, ControlStep step, void *context){
+  /* Runs the controller on the virtual bus for a number of control periods
+    Arguments:
+      - VirtualBus &bus: The bus and its nodes
+      - uint32_t periods: Control periods to run
+      - ControlStep step: Run at the start of each period, main_loop() if NULL
+      - void *context: Passed to step
+    Returns:
+      - void
+  */
+  for(uint32_t period = 0; period < periods; period++){
+    if(step != NULL) step(context);
+    else main_loop();
+    log_drain();
+    for(uint32_t slice = 0; slice < PERIOD_US / SLICE_US; slice++){
+      uint64_t end = mock_time_us() + SLICE_US;
+      bus.run_until(end);
+      mock_advance_time_us(end - mock_time_us());
+      while(receive_frame(0) == ESP_OK);
+      twai_recovery_run(0);
+    }
+  }
+}
+
+static ActuatorsNode *add_nodes(VirtualBus &bus, uint32_t actuators_period_us, VescNode **assemblies){
+  //VESCs 7 to 11 with the assembly motors at 8 and 10, and the actuators controller reporting their angles
+  for(uint8_t node = VESC_FIRST_NODE; node < VESC_FIRST_NODE + VESC_NODE_COUNT; node++){
+    bool assembly = node == LEFT_ASSEMBLY_VESC || node == RIGHT_ASSEMBLY_VESC || node == VESC_FIRST_NODE;
+    VescNode *vesc = new VescNode(node, 20000, 100000, assembly ? VESC_ASSEMBLY_MOTOR : VESC_DRIVE_MOTOR);
+    if(node == LEFT_ASSEMBLY_VESC) assemblies[0] = vesc;
+    if(node == RIGHT_ASSEMBLY_VESC) assemblies[1] = vesc;
+    bus.add_node(vesc);
+  }
+  ActuatorsNode *actuators = new ActuatorsNode(actuators_period_us);
+  actuators->set_assemblies(assemblies[0], assemblies[1], ASSEMBLY_GEAR_RATIO);
+  bus.add_node(actuators);
+  return actuators;
+}
+
+static void run_stair_sequence(){
+  /* Stair climbing mode through main_loop(): both front assemblies forward for 3 s, hold, back for 3 s, hold
+    Arguments:
+      - void
+    Returns:
+      - void
+  */
+  VirtualBus bus;
+  VescNode *assemblies[2] = {NULL, NULL};
+  ActuatorsNode *actuators = add_nodes(bus, 100000, assemblies);
+  driveMode = false;
+  const struct{
+    const char *name;
+    int joystick;
+    uint32_t periods;
+  } phases[] = {{"Rest", yMidLevel, 100}, {"Forward", yMax, 300}, {"Hold", yMidLevel, 100}, {"Back", yMin, 300}, {"Hold", yMidLevel, 100}};
+
+  //Assembly speed at 1500 ERPM, the stair climbing mode's setpoint
+  float degreesPerSecond = 1500.0f / VESC_ASSEMBLY_MOTOR.pole_pairs / 60 * 360 / ASSEMBLY_GEAR_RATIO;
+  float angles[5];
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  uint32_t periods = 0;
+  for(int i = 0; i < 5; i++){
+    mock_set_analog(JOYSTICKY, phases[i].joystick);
+    run_periods(bus, phases[i].periods, NULL, NULL);
+    periods += phases[i].periods;
+    angles[i] = actuators->angle(assemblies[0]);
+    printf("Stairs: %s, left assembly at %.2f deg, right at %.2f deg, left motor at %.0f ERPM, %.2f A\n", phases[i].name, angles[i],
+           actuators->angle(assemblies[1]), assemblies[0]->motor.erpm(), assemblies[0]->motor.current());
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  double simulated = periods / (double)CONTROL_LOOP_HZ;
+  printf("Stairs: %.1f s simulated in %.3f s (%.0fx real time), %.2f deg/s expected at 1500 ERPM\n", simulated, seconds,
+         simulated / seconds, degreesPerSecond);
+  //The assemblies start and stop within a control period and the speed loop's time constant
+  check(fabsf(angles[1] - angles[0] - 3 * degreesPerSecond) < 0.05f * 3 * degreesPerSecond, "assemblies turned forward");
+  //Stopping takes up to a control period and the speed loop's time constant, then the assemblies are held against their weight
+  float stopping = degreesPerSecond * (VESC_ASSEMBLY_MOTOR.time_constant + 2.0f / CONTROL_LOOP_HZ);
+  check(fabsf(angles[2] - angles[1]) < stopping, "assemblies stopped and held");
+  check(fabsf(angles[4] - angles[0]) < 1, "assemblies back at their start");
+  driveMode = true;
+}
+
+struct PidLoop{
+  PID *pid;
+  float target;
+};
+
+static void pid_step(void *context){
+  //The assembly PID as drive mode would run it: from the received angle to the left assembly's RPM setpoint, sent in the assembly's slots
+  PidLoop *loop = (PidLoop *)context;
+  float angle = actuatorsControllerData.read().left_assembly_angle;
+  float output = loop->pid->PID_Control(angle, loop->target);
+  output = fmaxf(-3000, fminf(3000, output));
+  twai_message_t message = {};
+  encode_vesc_fixed<LEFT_ASSEMBLY_VESC, CAN_PACKET_SET_RPM>(&message, lroundf(output));
+  tx_submit(&message, micros());
+}
+
+static bool tune_pid(const PidGains &gains, uint32_t seconds, float *settling, float *overshoot){
+  /* Moves the left assembly from 0 to PID_TARGET_DEG with a set of gains
+    Arguments:
+      - const PidGains &gains: The gains
+      - uint32_t seconds: Simulated time
+      - float *settling: Receives the time in s after which the angle stays within PID_SETTLED_DEG of the target, -1 if it does not
+      - float *overshoot: Receives the overshoot in % of the step
+    Returns:
+      - bool: true if the assembly settled
+  */
+  VirtualBus bus;
+  VescNode *assemblies[2] = {NULL, NULL};
+  //The angle is reported at the control loop's rate for the PID
+  ActuatorsNode *actuators = add_nodes(bus, PERIOD_US, assemblies);
+  //Constructed before its first call, like the firmware's PIDs: the PID takes its first time step from its construction
+  PID pid(gains.kp, gains.kd, gains.ki);
+  run_periods(bus, 10, NULL, NULL);
+  PidLoop loop = {&pid, PID_TARGET_DEG};
+
+  float peak = 0, rise = -1;
+  *settling = -1;
+  for(uint32_t period = 0; period < seconds * CONTROL_LOOP_HZ; period++){
+    run_periods(bus, 1, pid_step, &loop);
+    float angle = actuators->angle(assemblies[0]);
+    float time = (period + 1) / (float)CONTROL_LOOP_HZ;
+    peak = fmaxf(peak, angle);
+    if(rise < 0 && angle >= 0.9f * PID_TARGET_DEG) rise = time;
+    if(fabsf(angle - PID_TARGET_DEG) > PID_SETTLED_DEG) *settling = -1;
+    else if(*settling < 0) *settling = time;
+  }
+  *overshoot = fmaxf(0, peak - PID_TARGET_DEG) / PID_TARGET_DEG * 100;
+  printf("PID kp %.0f kd %.1f ki %.1f: rise %.2f s, overshoot %.1f%%, settled %.2f s, final %.2f deg\n", gains.kp, gains.kd, gains.ki,
+         rise, *overshoot, *settling, actuators->angle(assemblies[0]));
+  return *settling >= 0;
+}
+
+int run_motor_benchmark(){
+  /* Runs the checks, the stair climbing sequence and the PID tuning
+    Arguments:
+      - void
+    Returns:
+      - int: Exit code, 1 if a check failed
+  */
+  rx_begin();
+  twai_recovery_begin();
+  g_config.rx_queue_len = TWAI_RX_QUEUE_LEN;
+  g_config.tx_queue_len = TWAI_TX_QUEUE_LEN;
+  twai_driver_install(&g_config, &t_config, &f_config);
+  twai_start();
+  button_begin();
+  mock_twai_attach_bus(true);
+  mock_set_analog(JOYSTICKX, xMidLevel);
+  mock_set_analog(JOYSTICKY, yMidLevel);
+  driveMode = true;
+
+  check_model();
+  tx_schedule_start();
+  run_stair_sequence();
+
+  //The firmware's gains (all 0) do not move the assembly. Proportional gains up to 400 settle without overshoot, the speed is then limited
+  //by the 3000 ERPM clamp. The integral term winds up during the long move and overshoots.
+  const PidGains gains[] = {{0, 0, 0}, {20, 0, 0}, {100, 0, 0}, {400, 0, 0}, {400, 20, 0}, {100, 5, 10}};
+  float settling, overshoot;
+  for(size_t i = 0; i < sizeof(gains) / sizeof(gains[0]); i++){
+    bool settled = tune_pid(gains[i], 10, &settling, &overshoot);
+    if(i == 0) check(!settled && overshoot == 0, "no motion with zero gains");
+    if(i == 3) check(settled && settling < 4 && overshoot < 1, "assembly settles with the proportional gain");
+  }
+
+  mock_twai_attach_bus(false);
+  printf("Motor model: %u checks failed\n", failures);
+  return failures == 0 ? 0 : 1;
+}
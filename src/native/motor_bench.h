@@ -0,0 +1,12 @@
+#ifndef MOTOR_BENCH_H
+#define MOTOR_BENCH_H
+
+/* Closed loop simulation with the VESC motor model (vesc_model.h) on the virtual bus. Checks the model's step response, current limit,
+held load and speed limit against their closed form solutions, runs a stair climbing sequence through main_loop() with the assemblies
+driven by simulated VESCs, and tunes the assembly PID (PID_Controller.h) on the closed loop: for each set of gains the left assembly is
+moved to its target angle, with the angle reported by the simulated actuators controller. Prints the results and the simulation speed
+on stdout. */
+
+int run_motor_benchmark();
+
+#endif
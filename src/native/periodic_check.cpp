@@ -0,0 +1,111 @@
+#include <stdio.h>
+#include "mock_devices.h"
+#include "periodic_check.h"
+#include "Task_timing.h"
+
+#define PERIOD_US 1000
+#define NO_LONG_CYCLE 0xFFFFFFFF
+
+//Mock clock that wakes up late from every sleep, by the latency the script sets before each wait
+class LateClock : public MockClock{
+  public:
+  uint32_t latency;
+  LateClock(){
+    this->latency = 0;
+  }
+  void sleep_until_us(uint32_t wake_time){
+    MockClock::sleep_until_us(wake_time + this->latency);
+  }
+};
+
+//Script of the iterations and the statistics it must give
+struct Scenario{
+  const char *name;
+  uint32_t start;               // Mock time of begin(), in us
+  uint32_t cycles;
+  uint32_t busy;                // Work of every iteration
+  uint32_t long_cycle;          // Iteration that works long_busy instead, NO_LONG_CYCLE for none
+  uint32_t long_busy;
+  uint32_t latency_step;        // The wait after iteration i wakes up (i % 5) * latency_step late
+  uint32_t overruns;
+  uint32_t skipped;
+  int32_t max_jitter;
+  int64_t total_jitter;
+  uint32_t max_busy;
+  uint32_t elapsed;             // From begin() to the end of the last wait
+};
+
+static const Scenario scenarios[] = {
+  {"On time",                        0,           50,  300, NO_LONG_CYCLE, 0,    0,  0, 0, 0,   0,    300,  50000},
+  {"Late wake ups",                  0,           50,  300, NO_LONG_CYCLE, 0,    25, 0, 0, 100, 2500, 300,  50100},
+  {"Overrun within a period",        0,           20,  300, 10,            1500, 0,  1, 0, 500, 500,  1500, 20000},
+  {"Overrun by several periods",     0,           20,  300, 10,            3500, 0,  1, 2, 500, 500,  3500, 22000},
+  {"Overrun to a period boundary",   0,           20,  300, 10,            2000, 0,  1, 1, 0,   0,    2000, 21000},
+  {"Late wake ups and an overrun",   0,           20,  300, 12,            1500, 25, 1, 0, 525, 1475, 1500, 20100},
+  {"Across the 32 bit wrap",         0xFFFF9E57,  50,  300, 20,            3500, 25, 1, 2, 600, 3100, 3500, 52100},
+};
+
+static uint32_t failures = 0;
+
+static void check(bool ok, const char *what){
+  if(ok) return;
+  failures++;
+  printf("FAILED: %s\n", what);
+}
+
+static void run(const Scenario *scenario){
+  /* Runs a script on a new timer and compares the statistics
+    Arguments:
+      - const Scenario *scenario: The script
+    Returns:
+      - void
+  */
+  LateClock clock;
+  mock_set_time_us(scenario->start);
+  PeriodicTimer timer(&clock, PERIOD_US);
+  timer.begin();
+  for(uint32_t i = 0; i < scenario->cycles; i++){
+    mock_advance_time_us(i == scenario->long_cycle ? scenario->long_busy : scenario->busy);
+    clock.latency = (i % 5) * scenario->latency_step;
+    timer.wait_for_next_period();
+  }
+  TaskTimingStats stats = timer.get_stats();
+  uint32_t elapsed = clock.now_us() - scenario->start;
+  printf("%-32s cycles %u, overruns %u, skipped %u, jitter %d to %d us (total %lld), max busy %u us, %u us elapsed\n", scenario->name,
+         stats.cycles, stats.overruns, stats.skipped, stats.min_jitter, stats.max_jitter, (long long)stats.total_jitter, stats.max_busy,
+         elapsed);
+  check(stats.cycles == scenario->cycles && stats.overruns == scenario->overruns && stats.skipped == scenario->skipped, scenario->name);
+  check(stats.min_jitter == 0 && stats.max_jitter == scenario->max_jitter && stats.total_jitter == scenario->total_jitter, scenario->name);
+  check(stats.max_busy == scenario->max_busy && elapsed == scenario->elapsed, scenario->name);
+}
+
+int run_periodic_check(){
+  /* Runs the checks
+    Arguments:
+      - void
+    Returns:
+      - int: Exit code, 1 if a check failed
+  */
+  for(size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) run(&scenarios[i]);
+
+  //Statistics start over after a reset, a new period applies from the next release on
+  LateClock clock;
+  mock_set_time_us(0);
+  PeriodicTimer timer(&clock, PERIOD_US);
+  timer.begin();
+  mock_advance_time_us(3500);
+  timer.wait_for_next_period();
+  timer.reset_stats();
+  timer.set_period(2 * PERIOD_US);
+  for(uint32_t i = 0; i < 10; i++){
+    mock_advance_time_us(300);
+    timer.wait_for_next_period();
+  }
+  TaskTimingStats stats = timer.get_stats();
+  check(stats.period == 2 * PERIOD_US && stats.cycles == 10 && stats.overruns == 0 && stats.skipped == 0 && stats.max_jitter == 0 &&
+        stats.max_busy == 300, "Reset and period change");
+  check(clock.now_us() == 3 * PERIOD_US + 10 * 2 * PERIOD_US, "Reset and period change");
+
+  printf("Periodic timer: %u checks failed\n", failures);
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,10 @@
+#ifndef PERIODIC_CHECK_H
+#define PERIODIC_CHECK_H
+
+/* Checks of the periodic task timer (Task_timing.h) on the mock clock. Scripted iterations run on time, wake up late, overrun by less than
+a period, by several periods and up to a period boundary, and cross the wrap of the 32 bit us time: the jitter, overrun and skipped period
+counters must be the exact ones of the script and the schedule must not drift. Prints the statistics on stdout. */
+
+int run_periodic_check();
+
+#endif
@@ -0,0 +1,365 @@
+#include <random>
+#include <string>
+#include <vector>
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "esp_partition.h"
+#include "esp_timer.h"
+#include "mock_devices.h"
+#include "virtual_bus.h"
+#include "recorder_check.h"
+#include "config.h"
+#include "Recorder.h"
+#include "TWAI_handler.h"
+#include "TWAI_rx.h"
+#include "TWAI_tx.h"
+#include "TWAI_schedule.h"
+#include "TWAI_recovery.h"
+#include "Control_handler.h"
+#include "Task_timing.h"
+#include "Button_handler.h"
+#include "Log.h"
+
+#define CODEC_RECORDS 100000
+#define SPREAD_MS 90000             // Records of the export check, one per RECORDER_WRITE_PERIOD_MS
+#define DRIVE_S 60                  // Drive pattern of the realistic run: driving, then stationary, DRIVE_CYCLES times
+#define STOP_S 15
+#define DRIVE_CYCLES 6
+#define ENDURANCE_CYCLES 100000     // Erase cycles of the flash's sectors
+
+static uint32_t failures = 0;
+
+static void check(bool ok, const char *what){
+  if(ok) return;
+  failures++;
+  printf("FAILED: %s\n", what);
+}
+
+static bool same_record(const RecorderRecord &a, const RecorderRecord &b){
+  const twai_message_t &x = a.frame, &y = b.frame;
+  if(a.type != b.type || a.time != b.time) return false;
+  if(x.identifier != y.identifier || x.extd != y.extd || x.rtr != y.rtr || x.data_length_code != y.data_length_code) return false;
+  return x.rtr || memcmp(x.data, y.data, x.data_length_code) == 0;
+}
+
+static RecorderRecord record(uint8_t type, uint64_t time, uint32_t identifier, bool extd, bool rtr, uint8_t length, const uint8_t *data){
+  RecorderRecord result = {};
+  result.type = type;
+  result.time = time;
+  result.frame.identifier = identifier;
+  result.frame.extd = extd;
+  result.frame.rtr = rtr;
+  result.frame.data_length_code = length;
+  for(uint8_t i = 0; i < length && data != NULL; i++) result.frame.data[i] = data[i];
+  return result;
+}
+
+static void check_codec(){
+  //Random records back to back, with every kind of frame and time steps from 0 to the largest
+  std::mt19937_64 random(1);
+  std::vector<RecorderRecord> records;
+  std::vector<uint8_t> encoded;
+  uint64_t time = 0;
+  bool fits = true;
+  for(uint32_t i = 0; i < CODEC_RECORDS; i++){
+    RecorderRecord next = {};
+    next.type = 1 + random() % 3;
+    uint64_t step = random();
+    switch(i % 4){
+      case 0: step = 0; break;
+      case 1: step %= 128; break;
+      case 2: step %= 1ULL << 21; break;
+      default: step = i == CODEC_RECORDS - 1 ? UINT64_MAX - time : step % (1ULL << 40);
+    }
+    time += step;
+    next.time = time;
+    next.frame.extd = random() % 2;
+    next.frame.rtr = random() % 10 == 0;
+    next.frame.identifier = random() & (next.frame.extd ? TWAI_EXTD_ID_MASK : TWAI_STD_ID_MASK);
+    next.frame.data_length_code = random() % (TWAI_FRAME_MAX_DLC + 1);
+    for(uint8_t j = 0; j < next.frame.data_length_code && !next.frame.rtr; j++) next.frame.data[j] = random();
+    uint8_t buffer[RECORDER_RECORD_MAX];
+    size_t length = recorder_encode(&next, records.empty() ? 0 : records.back().time, buffer);
+    fits = fits && length <= RECORDER_RECORD_MAX && buffer[0] != 0xFF;
+    encoded.insert(encoded.end(), buffer, buffer + length);
+    records.push_back(next);
+  }
+  check(fits, "records fit RECORDER_RECORD_MAX and never start with the end of page byte");
+
+  size_t offset = 0;
+  uint32_t decoded = 0;
+  uint64_t previous = 0;
+  RecorderRecord result;
+  size_t length;
+  while(decoded < records.size() && (length = recorder_decode(&encoded[offset], encoded.size() - offset, previous, &result)) != 0){
+    if(!same_record(result, records[decoded])) break;
+    offset += length;
+    previous = result.time;
+    decoded++;
+  }
+  printf("Codec: %u random records in %u bytes, %u decoded\n", CODEC_RECORDS, (unsigned int)encoded.size(), decoded);
+  check(decoded == records.size() && offset == encoded.size(), "every record decoded as encoded");
+
+  uint8_t buffer[RECORDER_RECORD_MAX];
+  uint8_t data[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+  RecorderRecord longest = record(RECORDER_SETPOINT, UINT64_MAX, TWAI_EXTD_ID_MASK, true, false, 8, data);
+  length = recorder_encode(&longest, 0, buffer);
+  check(length == RECORDER_RECORD_MAX, "the longest record is RECORDER_RECORD_MAX bytes");
+  bool truncated = true;
+  for(size_t size = 0; size < length; size++) truncated = truncated && recorder_decode(buffer, size, 0, &result) == 0;
+  check(truncated, "truncated records are not decoded");
+  buffer[0] = 0xFF;
+  check(recorder_decode(buffer, length, 0, &result) == 0, "the end of page byte ends the records");
+}
+
+static void check_candump(){
+  //Golden lines of candump -l, as read by canplayer and log2asc
+  static const uint8_t short_data[] = {0x11, 0x22};
+  static const uint8_t rpm[] = {0x00, 0x00, 0x03, 0xE8};
+  static const uint8_t reverse[] = {0xFF, 0xFF, 0xFC, 0x18};
+  static const struct{
+    RecorderRecord record;
+    const char *line;
+  } golden[] = {
+    {record(RECORDER_RX, 1500000, 0x123, false, false, 2, short_data), "(0000000001.500000) can0 123#1122"},
+    {record(RECORDER_TX, 12000001, 0x30A, true, false, 4, rpm),
+     "(0000000012.000001) can0 0000030A#000003E8"},
+    {record(RECORDER_SETPOINT, 61000000, 0x30A, true, false, 4, reverse),
+     "(0000000061.000000) setpoint 0000030A#FFFFFC18"},
+    {record(RECORDER_RX, 999, 0x7FF, false, true, 0, NULL), "(0000000000.000999) can0 7FF#R"},
+    {record(RECORDER_RX, 0, 0x005, false, true, 3, NULL), "(0000000000.000000) can0 005#R3"},
+    {record(RECORDER_RX, 0, 0x000, false, false, 0, NULL), "(0000000000.000000) can0 000#"},
+  };
+  for(size_t i = 0; i < sizeof(golden) / sizeof(golden[0]); i++){
+    char line[RECORDER_LINE_LENGTH];
+    candump_format(&golden[i].record, line, sizeof(line));
+    if(strcmp(line, golden[i].line) != 0) printf("Expected %s, got %s\n", golden[i].line, line);
+    check(strcmp(line, golden[i].line) == 0, "candump line");
+  }
+  uint8_t data[8] = {};
+  RecorderRecord longest = record(RECORDER_SETPOINT, UINT64_MAX, TWAI_EXTD_ID_MASK, true, false, 8, data);
+  char line[RECORDER_LINE_LENGTH];
+  check(candump_format(&longest, line, sizeof(line)) < RECORDER_LINE_LENGTH, "the longest line fits RECORDER_LINE_LENGTH");
+}
+
+static void collect_line(const char *line, void *context){
+  ((std::vector<std::string> *)context)->push_back(line);
+}
+
+static std::vector<std::string> export_lines(uint32_t minutes, uint16_t sessions_back){
+  std::vector<std::string> lines;
+  recorder_export(minutes, sessions_back, collect_line, &lines);
+  return lines;
+}
+
+static std::vector<std::string> expected_lines(const std::vector<RecorderRecord> &records, uint64_t cutoff){
+  std::vector<std::string> lines;
+  for(size_t i = 0; i < records.size(); i++){
+    if(records[i].time < cutoff) continue;
+    char line[RECORDER_LINE_LENGTH];
+    candump_format(&records[i], line, sizeof(line));
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+static void check_export(){
+  //Records at known times, written by the recorder task's steps, must come back as the requested minutes of the session
+  check(recorder_begin(), "recorder started on the " RECORDER_PARTITION " partition");
+  std::vector<RecorderRecord> records;
+  for(uint32_t ms = 0; ms < SPREAD_MS; ms += RECORDER_WRITE_PERIOD_MS){
+    uint8_t data[8] = {(uint8_t)ms, (uint8_t)(ms >> 8), (uint8_t)(ms >> 16)};
+    twai_message_t frame = record(0, 0, 0x100 + ms % 0x80, ms % 3 == 0, false, 1 + ms % 8, data).frame;
+    records.push_back(record(ms / RECORDER_WRITE_PERIOD_MS % 2 ? RECORDER_TX : RECORDER_RX, esp_timer_get_time(), 0, false, false, 0, NULL));
+    records.back().frame = frame;
+    recorder_frame(records.back().type, &frame);
+    recorder_write();
+    mock_advance_time_us(RECORDER_WRITE_PERIOD_MS * 1000 - (esp_timer_get_time() - records.back().time) % 1000);
+  }
+  recorder_sync();
+  RecorderStats stats = get_recorder_stats();
+  check(stats.records == records.size() && stats.dropped == 0, "no records dropped while stationary");
+
+  std::vector<std::string> lines = export_lines(1, 0);
+  uint64_t end = records.back().time;
+  check(lines == expected_lines(records, end - 60000000), "the last minute of the session");
+  check(export_lines(2, 0) == expected_lines(records, 0), "the whole session");
+  check(export_lines(0, 0) == expected_lines(records, end), "the last record");
+  check(export_lines(5, 1).empty(), "no previous session on a new partition");
+
+  //Restart: the session before is found in the flash and the next one starts after it
+  recorder_end();
+  uint32_t erased = mock_flash_stats().sectors_erased;
+  check(recorder_begin(), "recorder restarted");
+  check(get_recorder_stats().session == stats.session + 1, "the session number counts the starts");
+  check(export_lines(2, 1) == expected_lines(records, 0), "the previous session after the restart");
+  check(export_lines(2, 0).empty(), "nothing in the new session yet");
+  std::vector<RecorderRecord> next;
+  for(uint32_t i = 0; i < 100; i++){
+    uint8_t data[4] = {(uint8_t)i};
+    next.push_back(record(RECORDER_SETPOINT, esp_timer_get_time(), 0x30A, true, false, 4, data));
+    recorder_setpoint(&next.back().frame);
+    mock_advance_time_us(1000);
+  }
+  recorder_sync();
+  check(export_lines(1, 0) == expected_lines(next, 0), "the new session");
+  check(export_lines(2, 1) == expected_lines(records, 0), "the previous session after the new one started");
+  check(mock_flash_stats().sectors_erased == erased, "the sectors erased ahead by the previous session are used without erasing");
+  printf("Export: %u records over %u s, %u in the last minute, %u of the next session\n", (unsigned int)records.size(), SPREAD_MS / 1000,
+         (unsigned int)lines.size(), (unsigned int)next.size());
+}
+
+//Last RPM setpoint sent to each VESC, reported back in its status packets
+static int32_t vescRpm[VESC_NODE_COUNT];
+
+static void count_frame(const twai_message_t *message, void *context){
+  uint8_t index = (message->identifier & 0xFF) - VESC_FIRST_NODE;
+  if(message->extd && message->identifier >> 8 == CAN_PACKET_SET_RPM && index < VESC_NODE_COUNT){
+    vescRpm[index] = (int32_t)((uint32_t)message->data[0] << 24 | message->data[1] << 16 | message->data[2] << 8 | message->data[3]);
+  }
+}
+
+struct ExportSummary{
+  uint64_t lines;
+  uint64_t bytes;           // With the line ends
+  uint64_t first_us;
+  uint64_t last_us;
+};
+
+static void add_line(const char *line, void *context){
+  ExportSummary *summary = (ExportSummary *)context;
+  unsigned long long seconds = 0, us = 0;
+  sscanf(line, "(%llu.%llu)", &seconds, &us);
+  if(summary->lines == 0) summary->first_us = seconds * 1000000 + us;
+  summary->last_us = seconds * 1000000 + us;
+  summary->lines++;
+  summary->bytes += strlen(line) + 1;
+}
+
+static void check_realistic_run(){
+  /* The controller with the VESCs' and the actuators controller's traffic of the native main, driving with a moving joystick for DRIVE_S and
+  standing still for STOP_S, DRIVE_CYCLES times, with a step of the recorder task after each control period */
+  mock_twai_set_tx_handler(count_frame, NULL);
+  rx_begin();
+  twai_recovery_begin();
+  g_config.rx_queue_len = TWAI_RX_QUEUE_LEN;
+  g_config.tx_queue_len = TWAI_TX_QUEUE_LEN;
+  twai_driver_install(&g_config, &t_config, &f_config);
+  twai_start();
+  button_begin();
+  driveMode = true;
+  publish_screen_state();
+
+  //A new session, stationary for RECORDER_IDLE_MS before the first drive
+  recorder_end();
+  check(recorder_begin(), "recorder restarted for the run");
+  mock_set_analog(JOYSTICKX, xMidLevel);
+  mock_set_analog(JOYSTICKY, yMidLevel);
+  mock_flash_reset_stats();
+  uint64_t runStart = mock_time_us();
+  MockClock clock;
+  PeriodicTimer controlTimer(&clock, 1000000 / CONTROL_LOOP_HZ);
+  controlTimer.begin();
+  tx_schedule_start();
+  uint32_t cycle = (DRIVE_S + STOP_S) * CONTROL_LOOP_HZ;
+  uint32_t iterations = DRIVE_CYCLES * cycle + RECORDER_IDLE_MS * CONTROL_LOOP_HZ / 1000;
+  uint32_t movingOverruns = 0, stationaryOverruns = 0;
+  uint64_t movingBytes = 0, movingUs = 0;
+  for(uint32_t i = 0; i < iterations; i++){
+    uint32_t phase = (i + cycle - RECORDER_IDLE_MS * CONTROL_LOOP_HZ / 1000) % cycle;
+    bool driving = i >= RECORDER_IDLE_MS * CONTROL_LOOP_HZ / 1000 && phase < DRIVE_S * CONTROL_LOOP_HZ;
+    uint32_t sweep = phase % 400 < 200 ? phase % 400 : 400 - phase % 400;
+    mock_set_analog(JOYSTICKX, driving ? xMidLevel + (xMax - xMidLevel) * (int)sweep / 400 : xMidLevel);
+    mock_set_analog(JOYSTICKY, driving ? yMidLevel + (yMax - yMidLevel) * (int)(200 + sweep) / 400 : yMidLevel);
+
+    uint64_t start = mock_time_us();
+    uint64_t bytes = get_recorder_stats().record_bytes;
+    if(i % (CONTROL_LOOP_HZ / 10) == 0){
+      twai_message_t message = actuators_controller_frame(100, 24);
+      mock_twai_deliver(&message);
+      message = actuators_controller_frame(101, 23);
+      mock_twai_deliver(&message);
+      message = actuators_controller_frame(102, 31);
+      mock_twai_deliver(&message);
+    }
+    for(int node = 0; node < VESC_NODE_COUNT && i % 2 == 0; node++){
+      twai_message_t message = vesc_status_frame(VESC_FIRST_NODE + node, CAN_PACKET_STATUS, vescRpm[node], 0, 0);
+      mock_twai_deliver(&message);
+      if(i % (CONTROL_LOOP_HZ / 10) != 0) continue;
+      message = vesc_status_frame(VESC_FIRST_NODE + node, CAN_PACKET_STATUS_4, 300 << 16 | 350, 0, 0);
+      mock_twai_deliver(&message);
+      message = vesc_status_frame(VESC_FIRST_NODE + node, CAN_PACKET_STATUS_5, 0, 240, 0);
+      mock_twai_deliver(&message);
+    }
+    while(receive_frame(0) == ESP_OK);
+    twai_recovery_run(0);
+    main_loop();
+    log_drain();
+    //The recorder task runs when the control task waits
+    recorder_write();
+    uint32_t overruns = controlTimer.get_stats().overruns;
+    //The TX schedule's slots send the setpoints meanwhile
+    controlTimer.wait_for_next_period();
+    overruns = controlTimer.get_stats().overruns - overruns;
+    if(driving){
+      movingOverruns += overruns;
+      movingBytes += get_recorder_stats().record_bytes - bytes;
+      movingUs += mock_time_us() - start;
+    }
+    else stationaryOverruns += overruns;
+  }
+  recorder_sync();
+
+  RecorderStats stats = get_recorder_stats();
+  MockFlashStats flash = mock_flash_stats();
+  const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, RECORDER_PARTITION);
+  uint32_t sectors = partition->size / RECORDER_SECTOR_SIZE;
+  uint32_t leastErased = UINT32_MAX;
+  for(uint32_t sector = 0; sector < sectors; sector++){
+    uint32_t erases = mock_flash_erases(partition, sector);
+    if(erases < leastErased) leastErased = erases;
+  }
+  ExportSummary exported = {};
+  check(recorder_export(RECORDER_EXPORT_MINUTES, 0, add_line, &exported) == exported.lines, "export count");
+  double seconds = (mock_time_us() - runStart) / 1e6;
+  double rate = stats.record_bytes / seconds;
+  double historyBytes = (double)(sectors - RECORDER_ERASE_AHEAD) * RECORDER_SECTOR_SIZE *
+                        stats.record_bytes / ((double)stats.pages_written * RECORDER_PAGE_SIZE);
+  //The erases go around the partition, every sector wears at the mean rate
+  double hours = ENDURANCE_CYCLES / ((double)stats.sectors_erased / sectors / (seconds / 3600));
+
+  printf("Realistic run: %.0f s, %u records, %llu bytes (%.1f per record), %.1f KB/s, %.1f KB/s while driving\n", seconds, stats.records,
+         (unsigned long long)stats.record_bytes, (double)stats.record_bytes / stats.records, rate / 1024,
+         movingBytes / (movingUs / 1e6) / 1024);
+  printf("Flash: %u pages written, %llu bytes programmed, %u sectors erased, %.3f bytes programmed and %.3f erased per record byte\n",
+         stats.pages_written, (unsigned long long)flash.bytes_written, stats.sectors_erased, (double)flash.bytes_written / stats.record_bytes,
+         (double)stats.sectors_erased * RECORDER_SECTOR_SIZE / stats.record_bytes);
+  printf("Busy %.1f s (%.2f%% of the time), %u overruns of the control task while driving, %u while stationary\n", flash.busy_us / 1e6,
+         flash.busy_us / 1e4 / seconds, movingOverruns, stationaryOverruns);
+  printf("Wear: every sector erased %u to %u times, %.0f hours of this use until %u cycles\n", leastErased, flash.max_erases, hours, ENDURANCE_CYCLES);
+  printf("History: %.1f minutes at the run's rate, %.1f driving | Export of %u minutes: %llu lines, %llu bytes (%.2f per record byte)\n",
+         historyBytes / rate / 60, historyBytes / (movingBytes / (movingUs / 1e6)) / 60, RECORDER_EXPORT_MINUTES,
+         (unsigned long long)exported.lines, (unsigned long long)exported.bytes,
+         (double)exported.bytes / exported.lines / ((double)stats.record_bytes / stats.records));
+  printf("%u dropped, %u erase waits, %u write errors\n", stats.dropped, stats.erase_waits, stats.write_errors);
+  check(stats.dropped == 0, "no records dropped");
+  check(stats.write_errors == 0 && flash.corrupted == 0, "no failed or overlapping writes");
+  check(movingOverruns == 0, "no flash operation delays the control task while driving");
+  check(stats.pages_written * RECORDER_PAGE_SIZE == flash.bytes_written, "one programming per page");
+  check(exported.last_us - exported.first_us + 10000 >= RECORDER_EXPORT_MINUTES * 60000000ULL, "the flash holds the exported minutes");
+}
+
+int run_recorder_check(){
+  /* Runs the checks
+    Arguments:
+      - void
+    Returns:
+      - int: Exit code, 1 if a check failed
+  */
+  check_codec();
+  check_candump();
+  check_export();
+  check_realistic_run();
+  printf("Recorder: %u checks failed\n", failures);
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,12 @@
+#ifndef RECORDER_CHECK_H
+#define RECORDER_CHECK_H
+
+/* Checks of the black box recorder (Recorder.h) on the mock flash (esp_partition.h). Random records must survive the encoder and decoder,
+the candump lines are compared with golden ones, records at known times must come back from the flash as the candump log of the requested
+minutes, also from the previous session after a restart. Then the controller drives and stops for several simulated minutes with the
+recorder task writing every RECORDER_WRITE_PERIOD_MS: no record may be lost and no flash operation may delay the control task while the
+chair moves. Prints the write amplification, the size of the export and the wear on stdout. */
+
+int run_recorder_check();
+
+#endif
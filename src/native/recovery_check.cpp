@@ -0,0 +1,194 @@
+#include <algorithm>
+#include <vector>
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "mock_devices.h"
+#include "recovery_check.h"
+#include "config.h"
+#include "TWAI_handler.h"
+#include "TWAI_rx.h"
+#include "TWAI_tx.h"
+#include "TWAI_schedule.h"
+#include "TWAI_recovery.h"
+#include "Control_handler.h"
+#include "Button_handler.h"
+#include "Log.h"
+
+#define CHECK_PERIOD_US (1000000 / CONTROL_LOOP_HZ)
+#define RECOVERY_BITS_US 2816         // 128 x 11 recessive bits at 500 kbit/s
+
+struct SentFrame{
+  uint64_t time;
+  twai_message_t message;
+};
+
+static uint32_t failures = 0;
+static std::vector<SentFrame> sentFrames;
+
+static void check(bool ok, const char *what){
+  if(ok) return;
+  failures++;
+  printf("FAILED: %s\n", what);
+}
+
+static void record_frame(const twai_message_t *message, void *context){
+  SentFrame frame = {mock_time_us(), *message};
+  sentFrames.push_back(frame);
+}
+
+static void run_periods(uint32_t periods){
+  /* Runs the control loop for a number of periods, with the recovery task running in between like it would on its own core
+    Arguments:
+      - uint32_t periods: Control periods to run
+    Returns:
+      - void
+  */
+  for(uint32_t i = 0; i < periods; i++){
+    uint64_t end = mock_time_us() + CHECK_PERIOD_US;
+    main_loop();
+    log_drain();
+    while(mock_time_us() + 1000 <= end) twai_recovery_run(pdMS_TO_TICKS((end - mock_time_us()) / 1000));
+    mock_advance_time_us(end - mock_time_us());
+  }
+}
+
+static void bus_off(uint32_t rx_errors){
+  mock_twai_set_error_counters(255, rx_errors);
+  mock_twai_set_state(TWAI_STATE_BUS_OFF);
+}
+
+static uint32_t resend_periods(){
+  //Control periods until every VESC's slot has come, the resent setpoints wait for their slots (TWAI_schedule.h)
+  uint32_t longest = 0;
+  for(uint8_t i = 0; i < VESC_NODE_COUNT; i++) longest = std::max(longest, tx_schedule_period_us(i));
+  return (longest + CHECK_PERIOD_US - 1) / CHECK_PERIOD_US;
+}
+
+static bool setpoints_resent(size_t before){
+  /* Checks that every motor's current setpoint was sent after a restart
+    Arguments:
+      - size_t before: Number of frames sent before the restart
+    Returns:
+      - bool: true if all of them were sent
+  */
+  for(int i = 0; i < VESC_NODE_COUNT; i++){
+    bool found = false;
+    for(size_t j = before; j < sentFrames.size() && !found; j++){
+      const twai_message_t &frame = sentFrames[j].message;
+      found = frame.identifier == transmittedVESCMessage[i].identifier && memcmp(frame.data, transmittedVESCMessage[i].data, 8) == 0;
+    }
+    if(!found) return false;
+  }
+  return true;
+}
+
+static uint64_t recover_bus_off(const char *name, uint32_t rx_errors, int32_t joystick){
+  /* Puts the controller in bus-off, moves the joystick meanwhile and runs until the bus is back
+    Arguments:
+      - const char *name: Name of the scenario
+      - uint32_t rx_errors: Receive error counter at the bus-off
+      - int32_t joystick: Joystick position set during the bus-off
+    Returns:
+      - uint64_t: Time in us from the bus-off to the first frame sent after it, 0 if the bus did not come back within 2 s
+  */
+  size_t before = sentFrames.size();
+  uint32_t busOffs = get_recovery_stats().bus_off_count;
+  uint64_t start = mock_time_us();
+  bus_off(rx_errors);
+  run_periods(1);
+  check(get_recovery_stats().bus_off_count == busOffs + 1, "bus-off detected");
+  mock_set_analog(JOYSTICKY, joystick);
+  for(int i = 0; i < 200 && !twai_recovery_bus_up(); i++) run_periods(1);
+  run_periods(resend_periods());
+
+  TwaiRecoveryStats stats = get_recovery_stats();
+  uint64_t firstFrame = sentFrames.size() > before ? sentFrames[before].time - start : 0;
+  printf("%s: bus back after %u us, first frame after %llu us, backoff %u ms\n", name, stats.last_duration_us,
+         (unsigned long long)firstFrame, stats.backoff_ms);
+  check(twai_recovery_bus_up(), "bus back after the bus-off");
+  check(firstFrame >= stats.last_duration_us, "no frames sent during the bus-off");
+  check(setpoints_resent(before), "current setpoints sent right after the restart");
+  check(firstFrame > 0 && firstFrame <= stats.last_duration_us + CHECK_PERIOD_US, "first frame within a period of the restart");
+  return firstFrame;
+}
+
+int run_recovery_check(){
+  /* Runs the checks
+    Arguments:
+      - void
+    Returns:
+      - int: Exit code, 1 if a check failed
+  */
+  mock_twai_set_tx_handler(record_frame, NULL);
+  rx_begin();
+  twai_recovery_begin();
+  g_config.rx_queue_len = TWAI_RX_QUEUE_LEN;
+  g_config.tx_queue_len = TWAI_TX_QUEUE_LEN;
+  twai_driver_install(&g_config, &t_config, &f_config);
+  twai_start();
+  button_begin();
+  mock_set_analog(JOYSTICKX, xMidLevel);
+  mock_set_analog(JOYSTICKY, yMidLevel);
+  driveMode = true;
+  tx_schedule_start();
+  run_periods(10);
+
+  //Error passive: reported, the controller keeps sending
+  size_t before = sentFrames.size();
+  mock_twai_set_error_counters(0, 130);
+  mock_set_analog(JOYSTICKY, yMax);
+  run_periods(5);
+  TwaiRecoveryStats stats = get_recovery_stats();
+  check(stats.error_passive && stats.error_passive_count == 1, "error passive reported");
+  check(stats.bus_off_count == 0 && stats.restarts == 0 && twai_recovery_bus_up(), "no action when error passive");
+  check(setpoints_resent(before), "setpoints sent while error passive");
+  mock_twai_set_error_counters(0, 0);
+  run_periods(1);
+  check(!get_recovery_stats().error_passive, "error active again");
+
+  //Bus-off after a stable bus: recovered right away, in the time of the recovery sequence
+  recover_bus_off("Bus-off", 0, yMin);
+  stats = get_recovery_stats();
+  check(stats.bus_off_count == 1 && stats.recovered == 1 && stats.reinstalled == 0 && stats.restarts == 1, "bus-off recovered");
+  check(stats.last_duration_us == RECOVERY_BITS_US && stats.backoff_ms == 0, "recovery sequence time without backoff");
+
+  //Bus-offs soon after a recovery: the backoff doubles
+  uint32_t backoff = RECOVERY_BACKOFF_MIN_MS;
+  for(int i = 0; i < 3; i++, backoff *= 2){
+    recover_bus_off("Repeated bus-off", 0, i & 1 ? yMax : yMin);
+    stats = get_recovery_stats();
+    check(stats.backoff_ms == backoff && stats.last_duration_us == backoff * 1000 + RECOVERY_BITS_US, "backoff of a repeated bus-off");
+  }
+
+  //A bus-off after RECOVERY_STABLE_MS is recovered without waiting again
+  run_periods(RECOVERY_STABLE_MS * 1000 / CHECK_PERIOD_US);
+  recover_bus_off("Bus-off after a stable bus", 0, yMidLevel);
+  stats = get_recovery_stats();
+  check(stats.backoff_ms == 0 && stats.last_duration_us == RECOVERY_BITS_US, "backoff reset after a stable bus");
+
+  //Receive error counter above 0 at the bus-off: the recovery would never complete, the driver is reinstalled
+  recover_bus_off("Bus-off with REC above 0", 5, yMax);
+  stats = get_recovery_stats();
+  check(stats.reinstalled == 1 && stats.recovered == 5, "driver reinstalled when the recovery cannot complete");
+
+  //Bus errors during the recovery: it does not complete until the bus is quiet, the driver cannot be reinstalled meanwhile
+  run_periods(RECOVERY_STABLE_MS * 1000 / CHECK_PERIOD_US);
+  before = sentFrames.size();
+  bus_off(0);
+  twai_recovery_run(0);
+  mock_twai_set_error_counters(255, 3);
+  run_periods(20);
+  check(!twai_recovery_bus_up() && get_recovery_stats().failures > 0, "recovery that does not complete times out");
+  mock_twai_set_error_counters(255, 0);
+  for(int i = 0; i < 200 && !twai_recovery_bus_up(); i++) run_periods(1);
+  run_periods(resend_periods());
+  stats = get_recovery_stats();
+  printf("Recovery with bus errors: bus back after %u us, %u failed attempts\n", stats.last_duration_us, stats.failures);
+  check(twai_recovery_bus_up() && stats.recovered == 6 && stats.reinstalled == 1, "recovery completes once the bus is quiet");
+  check(stats.last_duration_us > 20 * CHECK_PERIOD_US && setpoints_resent(before), "setpoints sent after the late recovery");
+
+  mock_serial_output(true);
+  print_recovery_stats();
+  printf("Recovery: %u checks failed\n", failures);
+  return failures == 0 ? 0 : 1;
+}
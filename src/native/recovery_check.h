@@ -0,0 +1,11 @@
+#ifndef RECOVERY_CHECK_H
+#define RECOVERY_CHECK_H
+
+/* Checks of the bus error recovery (TWAI_recovery.h) against the mock driver, with the control loop running at its period meanwhile. Error
+passive, a bus-off recovered with twai_initiate_recovery(), repeated bus-offs with their backoff, a bus-off with the receive error counter
+above 0 and a recovery that does not complete are injected, and the recovery's actions, durations and the setpoints sent after each restart
+are compared with the expected ones. Prints the results on stdout. */
+
+int run_recovery_check();
+
+#endif
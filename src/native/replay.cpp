@@ -0,0 +1,201 @@
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "mock_devices.h"
+#include "replay.h"
+#include "config.h"
+#include "TWAI_handler.h"
+#include "TWAI_rx.h"
+#include "TWAI_tx.h"
+#include "TWAI_schedule.h"
+#include "TWAI_recovery.h"
+#include "Control_handler.h"
+#include "Task_timing.h"
+#include "Trace.h"
+#include "Log.h"
+#include "Button_handler.h"
+
+static std::vector<TraceRecord> inputs;
+static size_t nextInput = 0;
+static std::vector<TraceRecord> recordedFrames;
+static std::vector<TraceRecord> replayedFrames;
+
+static uint32_t get_be32(const uint8_t *data){
+  return (uint32_t)data[0] << 24 | (uint32_t)data[1] << 16 | (uint32_t)data[2] << 8 | data[3];
+}
+
+static bool earlier(const TraceRecord &a, const TraceRecord &b){
+  return a.time < b.time;
+}
+
+static uint64_t apply_inputs(uint64_t time){
+  /* Applies the recorded inputs that are due at the given simulated time. Installed as the time listener, so each input is applied at its
+  recorded time, also in the middle of a control period.
+    Arguments:
+      - uint64_t time: The simulated time
+    Returns:
+      - uint64_t: Time of the next input
+  */
+  while(nextInput < inputs.size() && inputs[nextInput].time <= time){
+    const TraceRecord *record = &inputs[nextInput++];
+    if(record->type == 'A'){
+      mock_set_analog(JOYSTICKX, record->values[0]);
+      mock_set_analog(JOYSTICKY, record->values[1]);
+    }
+    else if(record->type == 'B'){
+      mock_set_digital(BTN1, record->values[0] & 1);
+      mock_set_digital(BTN2, record->values[0] >> 1 & 1);
+      mock_set_digital(BTN3, record->values[0] >> 2 & 1);
+      mock_set_digital(BTN4, record->values[0] >> 3 & 1);
+    }
+    else if(!mock_twai_deliver(&record->frame)) fprintf(stderr, "Replay: received frame at %llu lost\n", (unsigned long long)record->time);
+  }
+  return nextInput < inputs.size() ? inputs[nextInput].time : UINT64_MAX;
+}
+
+static void print_frame(const twai_message_t *message, void *context){
+  (void)context;
+  TraceRecord record = {};
+  record.type = 'T';
+  record.time = mock_time_us();
+  record.frame = *message;
+  char line[TRACE_LINE_LENGTH];
+  if(trace_format(&record, line, sizeof(line)) > 0) printf("%s\n", line);
+  replayedFrames.push_back(record);
+}
+
+static bool check_transmit_policy(uint32_t period){
+  /* Checks the change driven transmission (TWAI_tx.h) and the TX schedule (TWAI_schedule.h) against the trace. Every change of a VESC's
+  setpoint in the recorded frames must be transmitted within a control period plus the VESC's schedule period of its recorded time, unless
+  the next change replaces it in the mailbox before its slot, and no VESC may go longer than TX_KEEPALIVE_MS plus a control period and its
+  schedule period without a frame. Traces recorded before the change driven transmission have every setpoint of every period, the saved
+  frames are counted against them.
+    Arguments:
+      - uint32_t period: The control period in us
+    Returns:
+      - bool: false if the replayed frames break the policy
+  */
+  uint32_t changes = 0, superseded = 0, late = 0;
+  bool gapOk = true;
+  uint64_t maxGap = 0;
+  for(int node = VESC_FIRST_NODE; node < VESC_FIRST_NODE + VESC_NODE_COUNT; node++){
+    uint32_t slotPeriod = tx_schedule_period_us(node - VESC_FIRST_NODE);
+    const TraceRecord *previous = NULL;
+    const TraceRecord *pending = NULL;     // Last change without a replayed frame, fine if the next one replaced it
+    size_t next = 0;
+    for(size_t i = 0; i < recordedFrames.size(); i++){
+      const TraceRecord *recorded = &recordedFrames[i];
+      if(!recorded->frame.extd || (recorded->frame.identifier & 0xFF) != (uint32_t)node) continue;
+      bool changed = previous == NULL || recorded->frame.data_length_code != previous->frame.data_length_code ||
+                     memcmp(recorded->frame.data, previous->frame.data, recorded->frame.data_length_code) != 0;
+      previous = recorded;
+      if(!changed) continue;
+      changes++;
+      if(pending != NULL && recorded->time <= pending->time + slotPeriod) superseded++;
+      else if(pending != NULL){
+        fprintf(stderr, "Replay: setpoint %08x of VESC %d at %llu not transmitted\n", get_be32(pending->frame.data), node,
+                (unsigned long long)pending->time);
+        late++;
+      }
+      pending = NULL;
+      //A replayed frame with this setpoint, within a control period and the VESC's slot period of the recorded one
+      while(next < replayedFrames.size() && replayedFrames[next].time + period < recorded->time) next++;
+      bool found = false;
+      for(size_t j = next; j < replayedFrames.size() && replayedFrames[j].time <= recorded->time + period + slotPeriod && !found; j++){
+        found = replayedFrames[j].frame.identifier == recorded->frame.identifier &&
+                memcmp(replayedFrames[j].frame.data, recorded->frame.data, recorded->frame.data_length_code) == 0;
+      }
+      if(!found) pending = recorded;
+    }
+    if(pending != NULL){
+      fprintf(stderr, "Replay: setpoint %08x of VESC %d at %llu not transmitted\n", get_be32(pending->frame.data), node,
+              (unsigned long long)pending->time);
+      late++;
+    }
+    //Longest time without a frame, from the first input to the end of the replay
+    uint64_t last = inputs.front().time, nodeGap = 0;
+    for(size_t i = 0; i < replayedFrames.size(); i++){
+      if((replayedFrames[i].frame.identifier & 0xFF) != (uint32_t)node) continue;
+      nodeGap = std::max(nodeGap, replayedFrames[i].time - last);
+      last = replayedFrames[i].time;
+    }
+    uint64_t gap = std::max(nodeGap, mock_time_us() - last);
+    if(gap > (uint64_t)TX_KEEPALIVE_MS * 1000 + period + slotPeriod) gapOk = false;
+    maxGap = std::max(maxGap, gap);
+  }
+  int saved = (int)recordedFrames.size() - (int)replayedFrames.size();
+  double seconds = (mock_time_us() - inputs.front().time) / 1e6;
+  fprintf(stderr, "Transmit policy: %u setpoint changes, %u replaced before their slot, %u not transmitted in time, longest gap %.1f ms "
+          "(keepalive %d ms)%s\n", changes, superseded, late, maxGap / 1000.0, TX_KEEPALIVE_MS, gapOk ? "" : ", too long");
+  fprintf(stderr, "Frames transmitted: %u replayed, %u in the trace, %d saved (%.1f%%, %.1f frames/s)\n", (unsigned int)replayedFrames.size(),
+          (unsigned int)recordedFrames.size(), saved, recordedFrames.empty() ? 0 : saved * 100.0 / recordedFrames.size(), saved / seconds);
+  return late == 0 && gapOk;
+}
+
+int run_replay(const char *path){
+  /* Replays a trace through main_loop(), see replay.h
+    Arguments:
+      - const char *path: Path of the trace, e.g. a serial log of the WheelchairControls_trace firmware
+    Returns:
+      - int: Exit code of the program, 0 on success
+  */
+  FILE *file = fopen(path, "r");
+  if(file == NULL){
+    fprintf(stderr, "Replay: cannot open %s\n", path);
+    return 1;
+  }
+  char line[256];
+  while(fgets(line, sizeof(line), file) != NULL){
+    TraceRecord record;
+    if(!trace_parse(line, &record)) continue;
+    if(record.type == 'T') recordedFrames.push_back(record);
+    else inputs.push_back(record);
+  }
+  fclose(file);
+  if(inputs.empty()){
+    fprintf(stderr, "Replay: no inputs in %s\n", path);
+    return 1;
+  }
+  //The RX task and the control task log concurrently, so the lines are only roughly in time order
+  std::stable_sort(inputs.begin(), inputs.end(), earlier);
+  std::stable_sort(recordedFrames.begin(), recordedFrames.end(), earlier);
+
+  mock_set_time_us(inputs.front().time);
+  mock_twai_set_tx_handler(print_frame, NULL);
+  rx_begin();
+  twai_recovery_begin();
+  g_config.rx_queue_len = TWAI_RX_QUEUE_LEN;
+  g_config.tx_queue_len = TWAI_TX_QUEUE_LEN;
+  twai_driver_install(&g_config, &t_config, &f_config);
+  twai_start();
+  button_begin();
+  driveMode = true;
+
+  MockClock clock;
+  PeriodicTimer controlTimer(&clock, 1000000 / CONTROL_LOOP_HZ);
+  //Run the control period in which the last input was recorded, whatever the phase of the periods is
+  uint64_t end = inputs.back().time + controlTimer.get_period();
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  apply_inputs(mock_time_us());
+  mock_set_time_listener(apply_inputs);
+  controlTimer.begin();
+  tx_schedule_start();
+  while(mock_time_us() < end){
+    while(receive_frame(0) == ESP_OK);
+    twai_recovery_run(0);
+    main_loop();
+    log_drain();
+    controlTimer.wait_for_next_period();
+  }
+  mock_set_time_listener(NULL);
+
+  fflush(stdout);
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  double simulated = (mock_time_us() - inputs.front().time) / 1e6;
+  fprintf(stderr, "Replayed %u inputs over %.3f s of simulated time in %.3f s (%.0fx real time)\n", (unsigned int)inputs.size(), simulated,
+          seconds, simulated / seconds);
+  return check_transmit_policy(controlTimer.get_period()) ? 0 : 1;
+}
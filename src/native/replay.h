@@ -0,0 +1,13 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+/* Replay of a trace recorded by the WheelchairControls_trace firmware (see Trace.h). The recorded joystick samples, button levels and
+received frames are fed to the mock devices at their recorded times while main_loop() runs on the simulated time, and every frame the
+controller transmits is printed on stdout as a "@T" trace line. The replay is deterministic: the same trace always gives the same output.
+The transmitted frames are then checked against the recorded ones: every setpoint change must be sent within a control period plus the
+VESC's schedule period (TWAI_schedule.h), unless a newer one replaced it in the mailbox, and every VESC must get a frame at least every
+TX_KEEPALIVE_MS (see TWAI_tx.h). */
+
+int run_replay(const char *path);
+
+#endif
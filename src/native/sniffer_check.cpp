@@ -0,0 +1,397 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "mock_devices.h"
+#include "virtual_bus.h"
+#include "sniffer_check.h"
+#include "TWAI_handler.h"
+#include "TWAI_sniffer.h"
+#include "TWAI_stats.h"
+
+#define SLICE_US 1000               // The sniffer task empties the driver's RX queue and the UART takes the output after each slice of bus time
+#define SATURATED_MS 2000
+#define SLOW_BAUD 115200
+
+static uint32_t failures = 0;
+
+static void check(bool ok, const char *what){
+  if(ok) return;
+  failures++;
+  printf("FAILED: %s\n", what);
+}
+
+//Records the frames of the other nodes with the time of their end
+class CaptureNode : public VirtualNode{
+  public:
+  CaptureNode() : VirtualNode("Capture"){}
+  uint64_t update(uint64_t now){ return UINT64_MAX; }
+  void receive(const twai_message_t *message, uint64_t time){
+    frames.push_back(*message);
+    times.push_back(time);
+  }
+  std::vector<twai_message_t> frames;
+  std::vector<uint64_t> times;
+};
+
+static twai_message_t frame(uint32_t identifier, bool extd, bool rtr, uint8_t length, const uint8_t *data){
+  twai_message_t message = {};
+  message.identifier = identifier;
+  message.extd = extd;
+  message.rtr = rtr;
+  message.data_length_code = length;
+  for(uint8_t i = 0; i < length && data != NULL; i++) message.data[i] = data[i];
+  return message;
+}
+
+static bool same_frame(const twai_message_t &a, const twai_message_t &b){
+  if(a.identifier != b.identifier || a.extd != b.extd || a.rtr != b.rtr || a.data_length_code != b.data_length_code) return false;
+  return a.rtr || memcmp(a.data, b.data, a.data_length_code) == 0;
+}
+
+static std::string drain(){
+  //All the output the sniffer has, as if the UART was infinitely fast
+  std::string stream;
+  uint8_t buffer[256];
+  size_t length;
+  while((length = sniffer_pump(buffer, sizeof(buffer))) > 0) stream.append((const char *)buffer, length);
+  return stream;
+}
+
+static std::string run_commands(const char *commands){
+  //Types the commands, separated by carriage returns, and returns the output
+  for(const char *c = commands; *c != 0; c++) sniffer_input(*c);
+  return drain();
+}
+
+static std::vector<std::string> split(const std::string &stream, char delimiter){
+  //Complete records without their delimiter
+  std::vector<std::string> records;
+  size_t start = 0, end;
+  while((end = stream.find(delimiter, start)) != std::string::npos){
+    records.push_back(stream.substr(start, end - start));
+    start = end + 1;
+  }
+  return records;
+}
+
+static bool cobs_decode(const std::string &record, std::vector<uint8_t> *data){
+  data->clear();
+  size_t i = 0;
+  while(i < record.size()){
+    uint8_t code = record[i];
+    if(code == 0 || i + code > record.size()) return false;
+    for(uint8_t k = 1; k < code; k++) data->push_back(record[i + k]);
+    i += code;
+    if(code < 0xFF && i < record.size()) data->push_back(0);
+  }
+  return true;
+}
+
+static bool parse_hex(const std::string &text, size_t start, size_t digits, uint32_t *value){
+  if(start + digits > text.size()) return false;
+  *value = 0;
+  for(size_t i = start; i < start + digits; i++){
+    char c = text[i];
+    if(c >= '0' && c <= '9') *value = *value << 4 | (c - '0');
+    else if(c >= 'A' && c <= 'F') *value = *value << 4 | (c - 'A' + 10);
+    else return false;
+  }
+  return true;
+}
+
+static bool parse_slcan(const std::string &line, bool timestamp, twai_message_t *message, uint32_t *ms){
+  /* Parses an SLCAN frame line, like slcand does
+    Arguments:
+      - const std::string &line: The line without its carriage return
+      - bool timestamp: The line ends with a timestamp
+      - twai_message_t *message: The frame
+      - uint32_t *ms: The timestamp
+    Returns:
+      - bool: false if the line is not a well formed frame
+  */
+  if(line.empty() || std::string("tTrR").find(line[0]) == std::string::npos) return false;
+  *message = twai_message_t();
+  message->extd = line[0] == 'T' || line[0] == 'R';
+  message->rtr = line[0] == 'r' || line[0] == 'R';
+  size_t position = 1, digits = message->extd ? 8 : 3;
+  uint32_t value;
+  if(!parse_hex(line, position, digits, &message->identifier) || !parse_hex(line, position + digits, 1, &value) || value > 8) return false;
+  message->data_length_code = value;
+  position += digits + 1;
+  for(uint8_t i = 0; i < message->data_length_code && !message->rtr; i++, position += 2){
+    if(!parse_hex(line, position, 2, &value)) return false;
+    message->data[i] = value;
+  }
+  *ms = 0;
+  if(timestamp && !parse_hex(line, position, 4, ms)) return false;
+  return position + (timestamp ? 4 : 0) == line.size();
+}
+
+static void check_formats(){
+  const uint8_t data[] = {0x11, 0x22, 0x00, 0x0B, 0xB8, 0x33, 0x44, 0x55};
+  const uint8_t setpoint[] = {0x00, 0x00, 0x0B, 0xB8};
+  struct{
+    twai_message_t message;
+    uint32_t time;
+    bool timestamp;
+    const char *line;
+  } lines[] = {
+    {frame(0x123, false, false, 2, data), 0, false, "t12321122\r"},
+    {frame(0x307, true, false, 4, setpoint), 0, false, "T00000307400000BB8\r"},
+    {frame(0x7FF, false, true, 0, NULL), 0, false, "r7FF0\r"},
+    {frame(TWAI_EXTD_ID_MASK, true, true, 8, NULL), 0, false, "R1FFFFFFF8\r"},
+    {frame(0x010, false, false, 0, NULL), 61234567, true, "t010004D2\r"},
+    {frame(0x5A5, false, false, 8, data), 999000, true, "t5A581122000BB833445503E7\r"},
+  };
+  for(size_t i = 0; i < sizeof(lines) / sizeof(lines[0]); i++){
+    SnifferFrame sniffed = {lines[i].time, lines[i].message};
+    char line[32];
+    size_t length = slcan_format(&sniffed, lines[i].timestamp, line);
+    if(std::string(line, length) != lines[i].line) printf("  SLCAN line %u: expected %s\n", (unsigned int)i, lines[i].line);
+    check(std::string(line, length) == lines[i].line, "SLCAN lines");
+  }
+
+  //Examples of the COBS paper and its Wikipedia article
+  std::vector<uint8_t> run(255), encodedRun(257);
+  for(int i = 0; i < 255; i++) run[i] = i + 1;
+  encodedRun[0] = 0xFF;
+  for(int i = 0; i < 254; i++) encodedRun[i + 1] = i + 1;
+  encodedRun[255] = 0x02;
+  encodedRun[256] = 0xFF;
+  struct{
+    std::vector<uint8_t> data;
+    std::vector<uint8_t> encoded;
+  } vectors[] = {
+    {{0x00}, {0x01, 0x01}},
+    {{0x00, 0x00}, {0x01, 0x01, 0x01}},
+    {{0x11, 0x22, 0x00, 0x33}, {0x03, 0x11, 0x22, 0x02, 0x33}},
+    {{0x11, 0x00, 0x00, 0x00}, {0x02, 0x11, 0x01, 0x01, 0x01}},
+    {std::vector<uint8_t>(run.begin(), run.begin() + 254), std::vector<uint8_t>(encodedRun.begin(), encodedRun.begin() + 255)},
+    {run, encodedRun},
+  };
+  for(size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++){
+    std::vector<uint8_t> encoded(vectors[i].data.size() + vectors[i].data.size() / 254 + 1);
+    encoded.resize(cobs_encode(vectors[i].data.data(), vectors[i].data.size(), encoded.data()));
+    std::vector<uint8_t> decoded;
+    check(encoded == vectors[i].encoded, "COBS encoding");
+    check(cobs_decode(std::string(encoded.begin(), encoded.end()), &decoded) && decoded == vectors[i].data, "COBS round trip");
+  }
+
+  //Standard frame 0x123 at 0x00010203 us: flags, identifier, time and data, the 0 of the time splits the COBS blocks
+  SnifferFrame sniffed = {0x00010203, frame(0x123, false, false, 2, data)};
+  const uint8_t expected[] = {0x07, 0x02, 0x23, 0x01, 0x03, 0x02, 0x01, 0x03, 0x11, 0x22, 0x00};
+  uint8_t record[SNIFFER_OUTPUT_LENGTH];
+  size_t length = sniffer_binary_frame(&sniffed, record);
+  check(length == sizeof(expected) && memcmp(record, expected, length) == 0, "binary frame record");
+}
+
+static void check_commands(){
+  struct{
+    const char *command;
+    std::string response;
+  } commands[] = {
+    {"V\r", "V0101\r"},
+    {"N\r", "N0001\r"},
+    {"S6\r", "\r"},
+    {"S4\r", "\a"},
+    {"C\r", "\a"},
+    {"O\r", "\r"},
+    {"O\r", "\a"},
+    {"S6\r", "\a"},
+    {"t1230\r", "\a"},
+    {"T000003074000007D0\r", "\a"},
+    {"Z2\r", "\a"},
+    {"Z1\r", "\r"},
+    {"\nF\r", "F00\r"},
+    {"C\r", "\r"},
+    {"L\r", "\r"},
+    {"C\r", "\r"},
+    {"Z0\r", "\r"},
+    //Response record of the binary framing: COBS of 0x10 and the carriage return, then the delimiter
+    {"B1\r", std::string("\x03\x10\r\0", 4)},
+    {"B0\r", "\r"},
+    {"S6S6S6S6S6S6S6S6S6S6S6S6S6S6S6S6\r", "\a"},
+  };
+  for(size_t i = 0; i < sizeof(commands) / sizeof(commands[0]); i++){
+    std::string response = run_commands(commands[i].command);
+    if(response != commands[i].response) printf("  Command %u: unexpected response\n", (unsigned int)i);
+    check(response == commands[i].response, "SLCAN command responses");
+  }
+}
+
+static void add_load(VirtualBus *bus){
+  //More traffic than the bus can carry, most of the bus time goes to the shortest frames, the worst case for the serial output
+  bus->add_node(new LoadNode("Shortest frames", 0x010, false, 0, 9000, true, 11));
+  bus->add_node(new LoadNode("Extended 8 bytes", 0x18FEF100, true, 8, 2000, true, 12));
+  bus->add_node(new LoadNode("Standard 8 bytes", 0x300, false, 8, 3000, true, 13));
+  bus->add_node(new LoadNode("Extended 4 bytes", 0x0CF00400, true, 4, 3000, true, 14));
+}
+
+static std::string capture(VirtualBus *bus, const char *commands, uint32_t baud){
+  /* Runs the sniffer on the bus for SATURATED_MS with its output limited to what the UART sends at a baud rate, then reads the status
+  flags and closes the channel
+    Arguments:
+      - VirtualBus *bus: The bus
+      - const char *commands: Commands that set the framing and open the channel
+      - uint32_t baud: Serial baud rate, 10 bits per byte
+    Returns:
+      - std::string: The output
+  */
+  std::string stream = run_commands(commands);
+  std::vector<uint8_t> chunk(baud / 10 / (1000000 / SLICE_US));
+  for(uint32_t slice = 0; slice < SATURATED_MS * 1000 / SLICE_US; slice++){
+    uint64_t now = mock_time_us();
+    //The last frame of a slice can end after it, it is received at its end
+    bus->run_until(now + SLICE_US);
+    mock_advance_time_us(std::max(bus->now(), now + SLICE_US) - mock_time_us());
+    while(sniffer_poll(0));
+    stream.append((const char *)chunk.data(), sniffer_pump(chunk.data(), chunk.size()));
+  }
+  //The frames left in the ring come out before the channel is closed
+  stream += run_commands("F\r");
+  stream += run_commands("C\r");
+  return stream;
+}
+
+static bool decode_binary(const std::string &record, twai_message_t *message, uint32_t *time, int *flags, uint32_t *statusRecords){
+  /* Decodes a record of the binary framing
+    Arguments:
+      - const std::string &record: The record without its delimiter
+      - twai_message_t *message: The frame of a frame record
+      - uint32_t *time: Its receive time
+      - int *flags: Set by the response to F
+      - uint32_t *statusRecords: Counts the status records
+    Returns:
+      - bool: true if the record is a frame
+  */
+  std::vector<uint8_t> data;
+  if(!cobs_decode(record, &data) || data.empty()) return false;
+  if(data[0] == SNIFFER_RECORD_STATUS){
+    (*statusRecords)++;
+    return false;
+  }
+  if(data[0] == SNIFFER_RECORD_RESPONSE){
+    uint32_t value;
+    if(data.size() == 5 && data[1] == 'F' && parse_hex(std::string(data.begin() + 2, data.end()), 0, 2, &value)) *flags = value;
+    return false;
+  }
+  *message = twai_message_t();
+  message->extd = (data[0] & SNIFFER_RECORD_EXTD) != 0;
+  message->rtr = (data[0] & SNIFFER_RECORD_RTR) != 0;
+  message->data_length_code = data[0] & 0x0F;
+  size_t id = message->extd ? 4 : 2;
+  if(message->data_length_code > 8 || data.size() != 1 + id + 4 + (message->rtr ? 0 : message->data_length_code)) return false;
+  for(size_t k = 0; k < id; k++) message->identifier |= (uint32_t)data[1 + k] << (8 * k);
+  *time = data[1 + id] | data[2 + id] << 8 | data[3 + id] << 16 | (uint32_t)data[4 + id] << 24;
+  for(size_t k = 0; k < message->data_length_code && !message->rtr; k++) message->data[k] = data[5 + id + k];
+  return true;
+}
+
+static void check_capture(const char *name, bool binary, bool timestamp, uint32_t baud){
+  /* Captures the saturated bus and compares the decoded output with the frames on the bus
+    Arguments:
+      - const char *name: Name of the run
+      - bool binary: Binary framing, SLCAN otherwise
+      - bool timestamp: SLCAN timestamps
+      - uint32_t baud: Serial baud rate
+    Returns:
+      - void
+  */
+  VirtualBus bus;
+  CaptureNode *recorder = new CaptureNode();
+  bus.add_node(recorder);
+  add_load(&bus);
+  char commands[16];
+  snprintf(commands, sizeof(commands), "Z%d\rB%d\rO\r", timestamp, binary);
+  SnifferStats before = get_sniffer_stats();
+  std::string stream = capture(&bus, commands, baud);
+  SnifferStats after = get_sniffer_stats();
+  VirtualBusStats busStats = bus.get_stats();
+
+  //Besides the frames: the responses, the status records and the flags reported by F
+  uint32_t matched = 0, statusRecords = 0, late = 0;
+  int flags = -1;
+  bool ordered = true;
+  std::vector<std::string> records = split(stream, binary ? '\0' : '\r');
+  for(size_t i = 0; i < records.size(); i++){
+    twai_message_t message;
+    uint32_t time = 0, ms = 0;
+    bool isFrame;
+    if(binary) isFrame = decode_binary(records[i], &message, &time, &flags, &statusRecords);
+    else if(records[i].size() == 3 && records[i][0] == 'F'){
+      uint32_t value;
+      if(parse_hex(records[i], 1, 2, &value)) flags = value;
+      continue;
+    }
+    else isFrame = parse_slcan(records[i], timestamp, &message, &ms);
+    if(!isFrame) continue;
+
+    //In the order of the bus, stamped at the end of the slice the frame ended in, at most a slice and a frame later
+    ordered = ordered && matched < recorder->frames.size() && same_frame(message, recorder->frames[matched]);
+    if(!ordered) continue;
+    uint64_t end = recorder->times[matched];
+    if(binary) late += time - (uint32_t)end > 2 * SLICE_US;
+    else if(timestamp) late += (ms + 60000 - end / 1000 % 60000) % 60000 > 2 * SLICE_US / 1000;
+    matched++;
+  }
+
+  uint32_t frames = after.frames - before.frames, dropped = after.dropped - before.dropped;
+  uint32_t missed = after.driver_missed - before.driver_missed;
+  uint32_t bytes = after.bytes - before.bytes;
+  printf("%s at %u baud: %u frames at %.1f%% bus load, %u decoded, %u status records, %u bytes, %u lost in the ring, %u in the driver, "
+         "most queued %u, flags %02X\n", name, baud, busStats.frames, 100.0 * busStats.busy_us / busStats.elapsed_us, matched,
+         statusRecords, bytes, dropped, missed, after.max_queued, flags);
+  check(busStats.busy_us * 100 >= busStats.elapsed_us * 99, "saturated bus");
+  check(missed == 0, "no frames lost in the driver's RX queue");
+  if(baud < SNIFFER_BAUD){
+    check(dropped > 0 && flags >= 0 && (flags & SLCAN_FLAG_DATA_OVERRUN), "frames lost and the overrun flag at a low baud rate");
+    return;
+  }
+  check(ordered && frames == busStats.frames && matched == frames && dropped == 0, "every frame of the saturated bus in the output");
+  check(late == 0, "timestamps within a slice of the frame's end");
+  check(flags == 0, "no status flags");
+  check(!binary || statusRecords >= SATURATED_MS / SNIFFER_STATUS_MS - 1, "a status record every SNIFFER_STATUS_MS");
+}
+
+static void check_throughput(){
+  //The most serial bits per bus bit of each framing, with the shortest (unstuffed) frames and the longest records, must fit SNIFFER_BAUD
+  uint8_t data[8] = {};
+  double worst[2] = {0, 0};
+  for(int extd = 0; extd < 2; extd++){
+    for(uint8_t length = 0; length <= 8; length++){
+      SnifferFrame sniffed = {0xFFFFFFFF, frame(extd ? TWAI_EXTD_ID_MASK : TWAI_STD_ID_MASK, extd, false, length, data)};
+      char line[32];
+      uint8_t record[SNIFFER_OUTPUT_LENGTH];
+      double bits = (extd ? 54 : 34) + 8 * length + 13;
+      worst[0] = std::max(worst[0], slcan_format(&sniffed, true, line) * 10 / bits);
+      worst[1] = std::max(worst[1], sniffer_binary_frame(&sniffed, record) * 10 / bits);
+    }
+  }
+  uint32_t bitrate = twai_bitrate(&t_config);
+  printf("Serial output of a saturated bus at %u bit/s: SLCAN with timestamps %.0f baud, binary %.0f baud, SNIFFER_BAUD %u\n", bitrate,
+         worst[0] * bitrate, worst[1] * bitrate, SNIFFER_BAUD);
+  check(worst[0] * bitrate <= SNIFFER_BAUD && worst[1] * bitrate <= SNIFFER_BAUD, "both framings keep up with a saturated bus");
+}
+
+int run_sniffer_check(){
+  /* Runs the checks
+    Arguments:
+      - void
+    Returns:
+      - int: Exit code, 1 if a check failed
+  */
+  check(sniffer_begin() == ESP_OK, "driver installed in listen-only mode");
+  mock_twai_attach_bus(true);
+  check_formats();
+  check_commands();
+  check_throughput();
+  check_capture("SLCAN", false, false, SNIFFER_BAUD);
+  check_capture("SLCAN with timestamps", false, true, SNIFFER_BAUD);
+  check_capture("Binary", true, false, SNIFFER_BAUD);
+  check_capture("SLCAN with timestamps", false, true, SLOW_BAUD);
+  mock_twai_attach_bus(false);
+  printf("Sniffer: %u checks failed\n", failures);
+  return failures == 0 ? 0 : 1;
+}
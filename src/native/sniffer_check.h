@@ -0,0 +1,11 @@
+#ifndef SNIFFER_CHECK_H
+#define SNIFFER_CHECK_H
+
+/* Checks of the CAN sniffer (TWAI_sniffer.h). The SLCAN lines and the COBS encoder are compared with golden vectors and the SLCAN commands
+with their expected responses. Then the sniffer listens to a saturated virtual bus (virtual_bus.h) in both framings while its output is
+limited to the bytes SNIFFER_BAUD sends per ms: the decoded stream must hold every frame of the bus, in order and with its timestamp, with
+nothing lost in the ring or the driver. The same bus at 115200 baud must lose frames and report the overrun. Prints the results on stdout. */
+
+int run_sniffer_check();
+
+#endif
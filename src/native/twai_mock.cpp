@@ -0,0 +1,320 @@
+#include <algorithm>
+#include <deque>
+#include "driver/twai.h"
+#include "mock_devices.h"
+
+// Mock TWAI controller. Transmissions complete immediately unless the bus is blocked or a virtual bus (virtual_bus.h) is attached, then they
+// wait in a TX queue of tx_queue_len frames.
+// Received frames pass the acceptance filter and wait in an RX queue of rx_queue_len frames like in the real driver.
+// A bus-off recovery takes 128 x 11 recessive bits of simulated time and, like on the ESP32, never completes if the receive error counter is
+// not 0.
+static bool installed = false;
+static twai_general_config_t generalConfig;
+static twai_filter_config_t filterConfig;
+static twai_timing_config_t timingConfig;
+static twai_status_info_t status = {};
+static std::deque<twai_message_t> rxQueue;
+static std::deque<twai_message_t> txQueue;
+static bool txBlocked = false;
+static bool busAttached = false;
+static uint32_t pendingAlerts = 0;
+static uint32_t transmitted = 0;
+static uint64_t recoveryEnd = 0;            // Simulated time at which the recovery completes
+static MockTwaiTxHandler txHandler = NULL;
+static void *txHandlerContext = NULL;
+
+void mock_twai_set_tx_handler(MockTwaiTxHandler handler, void *context){
+  txHandler = handler;
+  txHandlerContext = context;
+}
+
+static bool matches(uint32_t bits, uint32_t code, uint32_t compared){
+  return ((bits ^ code) & compared) == 0;
+}
+
+static bool filter_accepts(const twai_message_t *message){
+  /* Applies the acceptance filter like the controller does, the frame format is not compared
+    Arguments:
+      - const twai_message_t *message: The received frame
+    Returns:
+      - bool: true if the frame passes
+  */
+  uint32_t code = filterConfig.acceptance_code;
+  uint32_t compared = ~filterConfig.acceptance_mask;
+  uint32_t rtr = message->rtr;
+  uint32_t data0 = message->data_length_code > 0 ? message->data[0] : 0;
+  uint32_t data1 = message->data_length_code > 1 ? message->data[1] : 0;
+  if(filterConfig.single_filter){
+    //Standard frames: identifier, RTR, 4 unused bits and two data bytes. Extended frames: identifier, RTR and 2 unused bits.
+    if(message->extd) return matches((message->identifier & TWAI_EXTD_ID_MASK) << 3 | rtr << 2, code, compared & 0xFFFFFFFC);
+    return matches((message->identifier & TWAI_STD_ID_MASK) << 21 | rtr << 20 | data0 << 8 | data1, code, compared & 0xFFF0FFFF);
+  }
+  if(message->extd){
+    //Identifier bits 28 to 13 in both filters
+    uint32_t bits = (message->identifier & TWAI_EXTD_ID_MASK) >> 13;
+    return matches(bits << 16, code, compared & 0xFFFF0000) || matches(bits, code, compared & 0xFFFF);
+  }
+  //Filter 1: identifier, RTR and the first data byte, split over bits 19 to 16 and 3 to 0. Filter 2: identifier and RTR.
+  uint32_t header = (message->identifier & TWAI_STD_ID_MASK) << 5 | rtr << 4;
+  return matches(header << 16 | (data0 >> 4) << 16 | (data0 & 0xF), code, compared & 0xFFFF000F) ||
+         matches(header, code, compared & 0xFFF0);
+}
+
+bool mock_twai_deliver(const twai_message_t *message){
+  /* Puts a frame in the driver's RX queue, as if it was received from the bus
+    Arguments:
+      - const twai_message_t *message: The received frame
+    Returns:
+      - bool: false if the frame was lost because the driver is not running or its RX queue is full, or was rejected by the filter
+  */
+  if(!installed || status.state != TWAI_STATE_RUNNING) return false;
+  if(!filter_accepts(message)) return false;
+  if(rxQueue.size() >= generalConfig.rx_queue_len){
+    status.rx_missed_count++;
+    pendingAlerts |= TWAI_ALERT_RX_QUEUE_FULL;
+    return false;
+  }
+  rxQueue.push_back(*message);
+  pendingAlerts |= TWAI_ALERT_RX_DATA;
+  return true;
+}
+
+void mock_twai_set_state(twai_state_t state){
+  status.state = state;
+  if(state == TWAI_STATE_BUS_OFF) pendingAlerts |= TWAI_ALERT_BUS_OFF;
+}
+
+void mock_twai_raise_alerts(uint32_t alerts){
+  pendingAlerts |= alerts;
+}
+
+void mock_twai_set_error_counters(uint32_t tx_errors, uint32_t rx_errors){
+  //Raise the alerts of the error state and warning limit the counters cross
+  uint32_t before = std::max(status.tx_error_counter, status.rx_error_counter);
+  uint32_t after = std::max(tx_errors, rx_errors);
+  if(before < 96 && after >= 96) pendingAlerts |= TWAI_ALERT_ABOVE_ERR_WARN;
+  if(before >= 96 && after < 96) pendingAlerts |= TWAI_ALERT_BELOW_ERR_WARN;
+  if(before < 128 && after >= 128) pendingAlerts |= TWAI_ALERT_ERR_PASS;
+  if(before >= 128 && after < 128) pendingAlerts |= TWAI_ALERT_ERR_ACTIVE;
+  status.tx_error_counter = tx_errors;
+  status.rx_error_counter = rx_errors;
+}
+
+void mock_twai_add_bus_errors(uint32_t errors){
+  status.bus_error_count += errors;
+}
+
+static void complete_transmission(const twai_message_t *message){
+  transmitted++;
+  pendingAlerts |= TWAI_ALERT_TX_SUCCESS;
+  if(txHandler != NULL) txHandler(message, txHandlerContext);
+}
+
+void mock_twai_set_tx_blocked(bool blocked){
+  /* Blocks the bus, e.g. as if a higher priority node kept it busy: transmitted frames wait in the TX queue. Unblocking sends them.
+    Arguments:
+      - bool blocked: true to block the bus
+    Returns:
+      - void
+  */
+  txBlocked = blocked;
+  if(blocked) return;
+  while(!txQueue.empty()){
+    twai_message_t message = txQueue.front();
+    txQueue.pop_front();
+    complete_transmission(&message);
+  }
+  pendingAlerts |= TWAI_ALERT_TX_IDLE;
+}
+
+uint32_t mock_twai_transmitted(){
+  return transmitted;
+}
+
+void mock_twai_attach_bus(bool attached){
+  busAttached = attached;
+}
+
+bool mock_twai_tx_next(twai_message_t *message){
+  /* Gives the frame the controller tries to send next on the virtual bus
+    Arguments:
+      - twai_message_t *message: Receives the frame
+    Returns:
+      - bool: false if the controller has nothing to send or is not running
+  */
+  if(!installed || status.state != TWAI_STATE_RUNNING || txQueue.empty()) return false;
+  *message = txQueue.front();
+  return true;
+}
+
+void mock_twai_tx_done(){
+  //The frame from mock_twai_tx_next() was sent
+  twai_message_t message = txQueue.front();
+  txQueue.pop_front();
+  if(status.tx_error_counter > 0) status.tx_error_counter--;
+  complete_transmission(&message);
+  if(txQueue.empty()) pendingAlerts |= TWAI_ALERT_TX_IDLE;
+}
+
+void mock_twai_rx_done(){
+  //A frame of another node was received without error, whether the filter accepted it or not
+  if(installed && status.state == TWAI_STATE_RUNNING && status.rx_error_counter > 0) status.rx_error_counter--;
+}
+
+void mock_twai_arbitration_lost(){
+  status.arb_lost_count++;
+  pendingAlerts |= TWAI_ALERT_ARB_LOST;
+}
+
+void mock_twai_bus_error(bool transmitter){
+  /* Counts a bus error like the controller does: 8 on the transmit error counter of the transmitter, 1 on the receive error counter of the
+  receivers. Above 255 the controller goes bus-off and the driver drops its TX queue.
+    Arguments:
+      - bool transmitter: true if the controller was transmitting the frame
+    Returns:
+      - void
+  */
+  if(!installed || status.state != TWAI_STATE_RUNNING) return;
+  status.bus_error_count++;
+  pendingAlerts |= TWAI_ALERT_BUS_ERROR;
+  if(!transmitter){
+    //The receive error counter stops counting once the controller is error passive
+    if(status.rx_error_counter < 128) mock_twai_set_error_counters(status.tx_error_counter, status.rx_error_counter + 1);
+    return;
+  }
+  mock_twai_set_error_counters(status.tx_error_counter + 8, status.rx_error_counter);
+  if(status.tx_error_counter <= 255) return;
+  status.tx_error_counter = 255;
+  status.tx_failed_count += txQueue.size();
+  txQueue.clear();
+  mock_twai_set_state(TWAI_STATE_BUS_OFF);
+}
+
+esp_err_t twai_driver_install(const twai_general_config_t *g_config, const twai_timing_config_t *t_config, const twai_filter_config_t *f_config){
+  if(installed) return ESP_ERR_INVALID_STATE;
+  installed = true;
+  generalConfig = *g_config;
+  timingConfig = *t_config;
+  filterConfig = *f_config;
+  status = twai_status_info_t();
+  status.state = TWAI_STATE_STOPPED;
+  rxQueue.clear();
+  txQueue.clear();
+  pendingAlerts = 0;
+  return ESP_OK;
+}
+
+esp_err_t twai_driver_uninstall(){
+  if(!installed || status.state == TWAI_STATE_RUNNING || status.state == TWAI_STATE_RECOVERING) return ESP_ERR_INVALID_STATE;
+  installed = false;
+  return ESP_OK;
+}
+
+esp_err_t twai_start(){
+  if(!installed || status.state != TWAI_STATE_STOPPED) return ESP_ERR_INVALID_STATE;
+  status.state = TWAI_STATE_RUNNING;
+  return ESP_OK;
+}
+
+esp_err_t twai_stop(){
+  if(!installed || status.state != TWAI_STATE_RUNNING) return ESP_ERR_INVALID_STATE;
+  status.state = TWAI_STATE_STOPPED;
+  rxQueue.clear();
+  txQueue.clear();
+  return ESP_OK;
+}
+
+esp_err_t twai_transmit(const twai_message_t *message, TickType_t ticks_to_wait){
+  if(message == NULL || message->data_length_code > TWAI_FRAME_MAX_DLC) return ESP_ERR_INVALID_ARG;
+  if(!installed || status.state != TWAI_STATE_RUNNING) return ESP_ERR_INVALID_STATE;
+  if(generalConfig.mode == TWAI_MODE_LISTEN_ONLY) return ESP_ERR_NOT_SUPPORTED;
+  if(txBlocked || busAttached){
+    //The real driver waits up to ticks_to_wait for space in the queue, nothing frees it on the host while waiting
+    if(txQueue.size() >= generalConfig.tx_queue_len){
+      if(ticks_to_wait != 0 && ticks_to_wait != portMAX_DELAY) vTaskDelay(ticks_to_wait);
+      return ESP_ERR_TIMEOUT;
+    }
+    txQueue.push_back(*message);
+    return ESP_OK;
+  }
+  complete_transmission(message);
+  pendingAlerts |= TWAI_ALERT_TX_IDLE;
+  return ESP_OK;
+}
+
+esp_err_t twai_receive(twai_message_t *message, TickType_t ticks_to_wait){
+  if(!installed) return ESP_ERR_INVALID_STATE;
+  if(rxQueue.empty()){
+    //Nothing arrives while waiting on the host, but the wait still takes simulated time
+    if(ticks_to_wait != portMAX_DELAY) vTaskDelay(ticks_to_wait);
+    return ESP_ERR_TIMEOUT;
+  }
+  *message = rxQueue.front();
+  rxQueue.pop_front();
+  return ESP_OK;
+}
+
+static bool recovery_completes(){
+  return status.state == TWAI_STATE_RECOVERING && status.rx_error_counter == 0;
+}
+
+static void update_recovery(){
+  if(!recovery_completes() || mock_time_us() < recoveryEnd) return;
+  status.state = TWAI_STATE_STOPPED;
+  status.tx_error_counter = 0;
+  status.rx_error_counter = 0;
+  pendingAlerts |= TWAI_ALERT_BUS_RECOVERED | TWAI_ALERT_ERR_ACTIVE;
+}
+
+esp_err_t twai_read_alerts(uint32_t *alerts, TickType_t ticks_to_wait){
+  if(!installed) return ESP_ERR_INVALID_STATE;
+  update_recovery();
+  if((pendingAlerts & generalConfig.alerts_enabled) == 0 && ticks_to_wait != portMAX_DELAY){
+    //Only a recovery raises an alert while waiting on the host
+    uint64_t wakeUp = mock_time_us() + (uint64_t)ticks_to_wait * portTICK_PERIOD_MS * 1000;
+    if(recovery_completes() && recoveryEnd < wakeUp) wakeUp = recoveryEnd;
+    if(wakeUp > mock_time_us()) mock_advance_time_us(wakeUp - mock_time_us());
+    update_recovery();
+  }
+  *alerts = pendingAlerts & generalConfig.alerts_enabled;
+  pendingAlerts = 0;
+  return *alerts == 0 ? ESP_ERR_TIMEOUT : ESP_OK;
+}
+
+esp_err_t twai_reconfigure_alerts(uint32_t alerts_enabled, uint32_t *current_alerts){
+  if(!installed) return ESP_ERR_INVALID_STATE;
+  if(current_alerts != NULL) *current_alerts = pendingAlerts & generalConfig.alerts_enabled;
+  generalConfig.alerts_enabled = alerts_enabled;
+  pendingAlerts = 0;
+  return ESP_OK;
+}
+
+esp_err_t twai_initiate_recovery(){
+  if(!installed || status.state != TWAI_STATE_BUS_OFF) return ESP_ERR_INVALID_STATE;
+  //The controller needs 128 occurrences of 11 recessive bits to recover
+  uint32_t bitrate = 80000000UL / timingConfig.brp / (1 + timingConfig.tseg_1 + timingConfig.tseg_2);
+  status.state = TWAI_STATE_RECOVERING;
+  recoveryEnd = mock_time_us() + (128 * 11 * 1000000ULL + bitrate - 1) / bitrate;
+  return ESP_OK;
+}
+
+esp_err_t twai_get_status_info(twai_status_info_t *status_info){
+  if(!installed) return ESP_ERR_INVALID_STATE;
+  update_recovery();
+  status.msgs_to_tx = txQueue.size();
+  status.msgs_to_rx = rxQueue.size();
+  *status_info = status;
+  return ESP_OK;
+}
+
+esp_err_t twai_clear_transmit_queue(){
+  if(!installed) return ESP_ERR_INVALID_STATE;
+  txQueue.clear();
+  return ESP_OK;
+}
+
+esp_err_t twai_clear_receive_queue(){
+  if(!installed) return ESP_ERR_INVALID_STATE;
+  rxQueue.clear();
+  return ESP_OK;
+}
@@ -0,0 +1,308 @@
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "mock_devices.h"
+#include "virtual_bus.h"
+#include "vbus_bench.h"
+#include "config.h"
+#include "TWAI_handler.h"
+#include "TWAI_rx.h"
+#include "TWAI_tx.h"
+#include "TWAI_schedule.h"
+#include "TWAI_dispatch.h"
+#include "TWAI_recovery.h"
+#include "TWAI_stats.h"
+#include "Control_handler.h"
+#include "Button_handler.h"
+#include "Log.h"
+
+#define SLICE_US 1000                 // The RX path and the recovery run after each slice of bus time, like tasks woken by the driver
+#define STEP_PERIOD_US 100000         // Joystick steps
+
+struct Scenario{
+  const char *name;
+  uint32_t status_period_us;          // VESC status frames
+  float load_rate;                    // Frames per second of other traffic, 0 for none
+  uint32_t load_identifier;
+  bool load_extd;
+  float error_rate;                   // Share of the frames destroyed by an error
+};
+
+static uint32_t failures = 0;
+
+static void check(bool ok, const char *what){
+  if(ok) return;
+  failures++;
+  printf("FAILED: %s\n", what);
+}
+
+//Releases one frame when the bus is first updated
+class BurstNode : public VirtualNode{
+  public:
+  BurstNode(const twai_message_t &message) : VirtualNode("Burst"), message(message), done(false){}
+  uint64_t update(uint64_t now){
+    if(!done) release(&message, now);
+    done = true;
+    return UINT64_MAX;
+  }
+
+  private:
+  twai_message_t message;
+  bool done;
+};
+
+//Records the frames of the other nodes in the order they were sent
+class RecorderNode : public VirtualNode{
+  public:
+  RecorderNode() : VirtualNode("Recorder"){}
+  uint64_t update(uint64_t now){ return UINT64_MAX; }
+  void receive(const twai_message_t *message, uint64_t time){
+    frames.push_back(*message);
+    times.push_back(time);
+  }
+  std::vector<twai_message_t> frames;
+  std::vector<uint64_t> times;              // End of each frame
+};
+
+static twai_message_t frame(uint32_t identifier, bool extd, bool rtr){
+  twai_message_t message = {};
+  message.identifier = identifier;
+  message.extd = extd;
+  message.rtr = rtr;
+  message.data_length_code = rtr ? 0 : 8;
+  return message;
+}
+
+static void check_arbitration(){
+  //Released at the same time in a scrambled order, sent in the order of their arbitration fields
+  twai_message_t expected[] = {frame(0x000, false, false), {}, frame(0x0FF, false, true), frame(0x0FF << 18 | 3, true, false),
+                               frame(0x100, false, false), frame(TWAI_EXTD_ID_MASK, true, false)};
+  encode_vesc_fixed<RIGHT_DRIVE_VESC, CAN_PACKET_SET_RPM>(&expected[1], 1500);
+  const int order[] = {5, 3, 0, 4, 2};
+  VirtualBus bus;
+  RecorderNode *recorder = new RecorderNode();
+  bus.add_node(recorder);
+  uint32_t bits = 0;
+  uint8_t stuffBits;
+  for(int i = 0; i < 5; i++) bus.add_node(new BurstNode(expected[order[i]]));
+  for(int i = 0; i < 6; i++) bits += twai_frame_bits(&expected[i], &stuffBits);
+  twai_transmit(&expected[1], 0);
+  uint64_t start = bus.now();
+  bus.run_until(start + 10000);
+
+  bool ordered = recorder->frames.size() == 6;
+  for(size_t i = 0; i < recorder->frames.size() && ordered; i++){
+    ordered = recorder->frames[i].identifier == expected[i].identifier && recorder->frames[i].extd == expected[i].extd;
+  }
+  VirtualBusStats stats = bus.get_stats();
+  printf("Arbitration: %u frames in %llu us, %u bits\n", stats.frames, (unsigned long long)stats.busy_us, bits);
+  check(ordered, "frames sent in the order of their arbitration fields");
+  check(stats.busy_us == bits * 1000000ULL / twai_bitrate(&t_config), "frames sent back to back for their length");
+}
+
+static void check_bus_off(){
+  //Every transmission fails: the transmit error counter rises by 8 each time and the controller goes bus-off after 32 attempts
+  VirtualBus bus;
+  bus.set_error_rate(1, 1);
+  twai_message_t message = {};
+  encode_vesc_fixed<LEFT_DRIVE_VESC, CAN_PACKET_SET_RPM>(&message, -1500);
+  twai_transmit(&message, 0);
+  bus.run_until(bus.now() + 100000);
+  twai_status_info_t status;
+  twai_get_status_info(&status);
+  VirtualBusStats stats = bus.get_stats();
+  printf("Errors: bus-off after %u error frames, TEC %u, %u bus errors\n", stats.error_frames, status.tx_error_counter,
+         status.bus_error_count);
+  check(stats.error_frames == 32 && status.state == TWAI_STATE_BUS_OFF && stats.controller_sent == 0, "bus-off after 32 errors");
+
+  //Bring the controller back for the load tests
+  twai_driver_uninstall();
+  twai_driver_install(&g_config, &t_config, &f_config);
+  twai_start();
+}
+
+static bool recorded_order(const RecorderNode *recorder, size_t first, const uint32_t *identifiers, size_t count){
+  bool ordered = recorder->frames.size() == first + count;
+  for(size_t i = 0; i < count && ordered; i++) ordered = recorder->frames[first + i].identifier == identifiers[i];
+  return ordered;
+}
+
+static void check_tx_priorities(){
+  //New setpoints for all VESCs and an actuator command: the drive motors go first and back to back, whatever the identifiers
+  VirtualBus bus;
+  RecorderNode *recorder = new RecorderNode();
+  bus.add_node(recorder);
+  uint32_t sample = micros();
+  for(uint8_t node = VESC_FIRST_NODE; node < VESC_FIRST_NODE + VESC_NODE_COUNT; node++){
+    twai_message_t message = createVESCMessage(node, CAN_PACKET_SET_RPM, 1000 + node);
+    tx_submit(&message, sample);
+  }
+  twai_message_t actuators = createActuatorsMessage(ACTUATORS_MESSAGE_ID, true, ACTUATOR_EXTEND);
+  tx_submit(&actuators, sample);
+  //The actuator command does not fit in the driver's queue behind the VESC frames, it goes with the next flush
+  uint8_t sent = tx_flush();
+  bus.run_until(bus.now() + 5000);
+  sent += tx_flush();
+  bus.run_until(bus.now() + 5000);
+  const uint32_t moving[] = {vesc_frame_id(RIGHT_DRIVE_VESC, CAN_PACKET_SET_RPM), vesc_frame_id(LEFT_DRIVE_VESC, CAN_PACKET_SET_RPM),
+                             vesc_frame_id(7, CAN_PACKET_SET_RPM), vesc_frame_id(8, CAN_PACKET_SET_RPM),
+                             vesc_frame_id(10, CAN_PACKET_SET_RPM), ACTUATORS_MESSAGE_ID};
+  bool ordered = sent == 6 && recorded_order(recorder, 0, moving, 6);
+  uint8_t stuffBits;
+  twai_message_t left = recorder->frames.size() >= 2 ? recorder->frames[1] : actuators;
+  uint64_t skew = recorder->times.size() >= 2 ? recorder->times[1] - recorder->times[0] : 0;
+  uint64_t frameTime = twai_frame_bits(&left, &stuffBits) * 1000000ULL / twai_bitrate(&t_config);
+  printf("TX priorities: %u frames, drive motors %llu us apart (one frame is %llu us)\n", sent, (unsigned long long)skew,
+         (unsigned long long)frameTime);
+  check(ordered, "drive motors, assemblies and actuators sent in the order of their classes");
+  check(skew == frameTime, "drive motor frames back to back");
+
+  //An assembly that stops goes before the drive motors' new setpoints, the actuator stop before both
+  sample++;
+  twai_message_t stop = createVESCMessage(8, CAN_PACKET_SET_RPM, 0);
+  tx_submit(&stop, sample);
+  twai_message_t drive = createVESCMessage(RIGHT_DRIVE_VESC, CAN_PACKET_SET_RPM, 2000);
+  tx_submit(&drive, sample);
+  actuators = createActuatorsMessage(ACTUATORS_MESSAGE_ID, true, ACTUATOR_STOP);
+  tx_submit(&actuators, sample);
+  tx_flush();
+  bus.run_until(bus.now() + 5000);
+  const uint32_t stopping[] = {vesc_frame_id(8, CAN_PACKET_SET_RPM), ACTUATORS_MESSAGE_ID,
+                               vesc_frame_id(RIGHT_DRIVE_VESC, CAN_PACKET_SET_RPM)};
+  check(recorded_order(recorder, 6, stopping, 3), "stops sent before the drive motors");
+  TxStats stats = get_tx_stats();
+  check(stats.classes[TX_CLASS_STOP].sent == 2 && stats.skew_count == 1, "class and skew statistics");
+}
+
+static uint32_t percentile(std::vector<uint32_t> &values, uint32_t percent){
+  if(values.empty()) return 0;
+  std::sort(values.begin(), values.end());
+  return values[std::min(values.size() - 1, values.size() * percent / 100)];
+}
+
+static void run_scenario(const Scenario &scenario, uint32_t seconds){
+  /* Runs the control loop on the virtual bus with the scenario's nodes and prints the results
+    Arguments:
+      - const Scenario &scenario: Traffic and errors
+      - uint32_t seconds: Simulated time
+    Returns:
+      - void
+  */
+  twai_clear_transmit_queue();
+  VirtualBus bus;
+  VescNode *drive[2] = {NULL, NULL};
+  for(uint8_t node = VESC_FIRST_NODE; node < VESC_FIRST_NODE + VESC_NODE_COUNT; node++){
+    VescNode *vesc = new VescNode(node, scenario.status_period_us, 100000);
+    if(node == RIGHT_DRIVE_VESC) drive[0] = vesc;
+    if(node == LEFT_DRIVE_VESC) drive[1] = vesc;
+    bus.add_node(vesc);
+  }
+  bus.add_node(new ActuatorsNode(100000));
+  if(scenario.load_rate > 0){
+    bus.add_node(new LoadNode("Other traffic", scenario.load_identifier, scenario.load_extd, 8, scenario.load_rate, true, 7));
+  }
+  bus.set_error_rate(scenario.error_rate, 3);
+
+  const int positions[] = {yMax, yMin, (yMax + yUpperThresh) / 2, (yMin + yLowerThresh) / 2};
+  std::vector<uint32_t> latencies, skews;
+  uint32_t notApplied = 0, steps = 0;
+  uint64_t stepAt = 0, nextStep = mock_time_us() + STEP_PERIOD_US / 2;
+  uint32_t receivedBefore = get_rx_stats().total_count;
+  twai_status_info_t status;
+  twai_get_status_info(&status);
+  uint32_t missedBefore = status.rx_missed_count;
+  std::chrono::steady_clock::duration rxTime = std::chrono::steady_clock::duration::zero();
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  tx_schedule_start();
+  for(uint32_t slice = 0; slice < seconds * (1000000 / SLICE_US); slice++){
+    uint64_t now = mock_time_us();
+    if(now >= nextStep){
+      for(int i = 0; i < 2 && steps > 0; i++){
+        if(drive[i]->changed_at >= stepAt) latencies.push_back(drive[i]->changed_at - stepAt);
+        else notApplied++;
+      }
+      if(steps > 0 && drive[0]->changed_at >= stepAt && drive[1]->changed_at >= stepAt){
+        skews.push_back(drive[0]->changed_at > drive[1]->changed_at ? drive[0]->changed_at - drive[1]->changed_at
+                                                                    : drive[1]->changed_at - drive[0]->changed_at);
+      }
+      //The joystick moves at any time, not only at the start of a control period
+      mock_set_analog(JOYSTICKY, positions[steps % 4]);
+      stepAt = now;
+      steps++;
+      nextStep = now + STEP_PERIOD_US + (steps * 3 % 10) * SLICE_US;
+    }
+    if(slice % (1000000 / CONTROL_LOOP_HZ / SLICE_US) == 0){
+      main_loop();
+      log_drain();
+    }
+    bus.run_until(now + SLICE_US);
+    mock_advance_time_us(now + SLICE_US - mock_time_us());
+    std::chrono::steady_clock::time_point rxStart = std::chrono::steady_clock::now();
+    while(receive_frame(0) == ESP_OK);
+    rxTime += std::chrono::steady_clock::now() - rxStart;
+    twai_recovery_run(0);
+  }
+  double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  VirtualBusStats stats = bus.get_stats();
+  uint32_t received = get_rx_stats().total_count - receivedBefore;
+  twai_get_status_info(&status);
+  uint32_t samples = latencies.size();
+  printf("%s\n", scenario.name);
+  printf("  Utilization %.1f%%, %.0f frames/s received by the controller, %u lost in a full RX queue, %.0f ns per received frame\n",
+         100.0 * stats.busy_us / stats.elapsed_us, received / (double)seconds, status.rx_missed_count - missedBefore,
+         received > 0 ? std::chrono::duration<double, std::nano>(rxTime).count() / received : 0.0);
+  printf("  Setpoint latency p50 %u us, p99 %u us, max %u us over %u changes, %u not applied within %u ms\n", percentile(latencies, 50),
+         percentile(latencies, 99), percentile(latencies, 100), samples, notApplied, STEP_PERIOD_US / 1000);
+  printf("  Left/right skew on the bus p50 %u us, max %u us over %u changes\n", percentile(skews, 50), percentile(skews, 100),
+         (uint32_t)skews.size());
+  printf("  %u s simulated in %.3f s (%.0fx real time)\n", seconds, wallSeconds, seconds / wallSeconds);
+  bus.print_stats();
+
+  if(scenario.error_rate == 0 && scenario.load_rate == 0 && scenario.status_period_us >= 10000){
+    //One control period for the joystick to be read, the drive motors' slot after the release, then a few frames on a lightly loaded bus
+    check(notApplied == 0 && percentile(latencies, 100) <= 1000000 / CONTROL_LOOP_HZ + 2 * SLICE_US, "setpoint latency on the realistic bus");
+    //The second drive motor's frame directly follows the first one, which is at most 160 bits long
+    check(percentile(skews, 100) <= 160 * 1000000ULL / twai_bitrate(&t_config), "left/right skew on the realistic bus");
+  }
+}
+
+int run_vbus_benchmark(uint32_t seconds){
+  /* Runs the checks and the scenarios
+    Arguments:
+      - uint32_t seconds: Simulated time per scenario
+    Returns:
+      - int: Exit code, 1 if a check failed
+  */
+  rx_begin();
+  twai_recovery_begin();
+  g_config.rx_queue_len = TWAI_RX_QUEUE_LEN;
+  g_config.tx_queue_len = TWAI_TX_QUEUE_LEN;
+  twai_driver_install(&g_config, &t_config, &f_config);
+  twai_start();
+  button_begin();
+  mock_twai_attach_bus(true);
+  mock_set_analog(JOYSTICKX, xMidLevel);
+  mock_set_analog(JOYSTICKY, yMidLevel);
+  driveMode = true;
+
+  check_arbitration();
+  check_bus_off();
+  check_tx_priorities();
+
+  const Scenario scenarios[] = {
+    {"Realistic: VESC status at 50 Hz, actuators controller at 10 Hz", 20000, 0, 0, false, 0},
+    {"Realistic with 1500 frames/s of lower priority traffic", 20000, 1500, 0x200, false, 0},
+    {"Realistic with errors on 1% of the frames", 20000, 0, 0, false, 0.01f},
+    {"RX flood: VESC status at 1 kHz", 1000, 0, 0, false, 0},
+    {"Saturated by higher priority traffic (extended ID 0x105 at 4000 frames/s)", 20000, 4000, 0x105, true, 0},
+  };
+  for(size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) run_scenario(scenarios[i], seconds);
+
+  mock_twai_attach_bus(false);
+  printf("Virtual bus: %u checks failed\n", failures);
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,12 @@
+#ifndef VBUS_BENCH_H
+#define VBUS_BENCH_H
+
+/* Load test of the controller's CAN paths on the virtual bus (virtual_bus.h). Checks the arbitration order and the bus-off of the error
+counters first, then runs the control loop and the RX path against simulated VESCs, the actuators controller and other traffic at
+realistic and extreme bus loads and with injected errors. The joystick steps every 100 ms, the time until the drive VESCs receive the new
+setpoint is the command latency. Prints the bus utilization, the received frames per second, the latency percentiles and the time per
+received frame on stdout. */
+
+int run_vbus_benchmark(uint32_t seconds);
+
+#endif
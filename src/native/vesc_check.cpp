@@ -0,0 +1,148 @@
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "mock_devices.h"
+#include "vesc_check.h"
+#include "config.h"
+#include "TWAI_handler.h"
+#include "TWAI_dispatch.h"
+#include "VESC_status.h"
+
+#define NODE (VESC_FIRST_NODE + 1)
+#define RECEIVED_AT_US 123456
+
+//A status packet as the VESC sends it and the values it holds, in the order of the fields below
+struct GoldenFrame{
+  uint8_t status;
+  uint8_t command;              // COMMAND_ID documented for the packet
+  uint8_t data[8];
+  float values[4];
+};
+
+//Fields of VescTelemetry each packet writes, integers are compared as floats
+static const size_t fields[VESC_STATUS_COUNT][4] = {
+  {offsetof(VescTelemetry, erpm), offsetof(VescTelemetry, current), offsetof(VescTelemetry, duty)},
+  {offsetof(VescTelemetry, amp_hours), offsetof(VescTelemetry, amp_hours_charged)},
+  {offsetof(VescTelemetry, watt_hours), offsetof(VescTelemetry, watt_hours_charged)},
+  {offsetof(VescTelemetry, temp_fet), offsetof(VescTelemetry, temp_motor), offsetof(VescTelemetry, current_in),
+   offsetof(VescTelemetry, pid_pos)},
+  {offsetof(VescTelemetry, tachometer), offsetof(VescTelemetry, v_in)},
+  {offsetof(VescTelemetry, adc), offsetof(VescTelemetry, adc) + sizeof(float), offsetof(VescTelemetry, adc) + 2 * sizeof(float),
+   offsetof(VescTelemetry, ppm)}
+};
+static const uint8_t fieldCount[VESC_STATUS_COUNT] = {3, 2, 2, 4, 2, 4};
+static const bool integerField[VESC_STATUS_COUNT] = {true, false, false, false, true, false};   // The first field is an int32_t
+
+static const GoldenFrame goldenFrames[] = {
+  //ERPM int32, current int16 / 10, duty int16 / 1000
+  {VESC_STATUS_1, 9,  {0xFF, 0xFF, 0xCF, 0xC7, 0x00, 0xEA, 0xFE, 0x0C}, {-12345, 23.4f, -0.5f}},
+  //Amp hours and amp hours charged, int32 / 10000
+  {VESC_STATUS_2, 14, {0x00, 0x00, 0x30, 0x39, 0x00, 0x00, 0x00, 0x64}, {1.2345f, 0.01f}},
+  //Watt hours and watt hours charged, int32 / 10000
+  {VESC_STATUS_3, 15, {0x00, 0x04, 0xA7, 0x68, 0x00, 0x00, 0x61, 0xA8}, {30.5f, 2.5f}},
+  //FET and motor temperature int16 / 10, input current int16 / 10, PID position int16 / 50
+  {VESC_STATUS_4, 16, {0x01, 0xC8, 0xFF, 0xCE, 0x00, 0x7B, 0x23, 0x28}, {45.6f, -5.0f, 12.3f, 180.0f}},
+  //Tachometer int32, input voltage int16 / 10, 2 reserved bytes
+  {VESC_STATUS_5, 27, {0x00, 0x0F, 0x42, 0x40, 0x01, 0x69, 0x00, 0x00}, {1000000, 36.1f}},
+  //ADC 1 to 3 int16 / 1000, PPM int16 / 1000
+  {VESC_STATUS_6, 58, {0x0C, 0xE4, 0x06, 0x72, 0x00, 0x00, 0xFC, 0x18}, {3.3f, 1.65f, 0.0f, -1.0f}}
+};
+
+static uint32_t failures = 0;
+
+static void check(bool ok, const char *what){
+  if(ok) return;
+  failures++;
+  printf("FAILED: %s\n", what);
+}
+
+static float field(const VescTelemetry *telemetry, uint8_t status, uint8_t i){
+  //Value of a packet's field
+  const uint8_t *base = (const uint8_t *)telemetry + fields[status][i];
+  if(i == 0 && integerField[status]) return *(const int32_t *)base;
+  return *(const float *)base;
+}
+
+static bool same_fields(const VescTelemetry *a, const VescTelemetry *b, uint8_t status){
+  for(uint8_t i = 0; i < fieldCount[status]; i++) if(field(a, status, i) != field(b, status, i)) return false;
+  return true;
+}
+
+static bool same_telemetry(const VescTelemetry *a, const VescTelemetry *b){
+  //Compares the values and their flags and timestamps, not the padding
+  if(a->received != b->received) return false;
+  for(uint8_t status = 0; status < VESC_STATUS_COUNT; status++){
+    if(a->received_at[status] != b->received_at[status] || !same_fields(a, b, status)) return false;
+  }
+  return true;
+}
+
+static void deliver(uint8_t node, const GoldenFrame *golden, uint8_t length){
+  //Decodes a frame with the decoder of its packet
+  twai_message_t message = {};
+  message.identifier = vesc_frame_id(node, golden->command);
+  message.extd = 1;
+  message.data_length_code = length;
+  memcpy(message.data, golden->data, length);
+  vescStatusPackets[golden->status].decoder(&message, NULL);
+}
+
+int run_vesc_check(){
+  /* Runs the checks
+    Arguments:
+      - void
+    Returns:
+      - int: Exit code, 1 if a check failed
+  */
+  for(uint8_t status = 0; status < VESC_STATUS_COUNT; status++){
+    check(vescStatusPackets[status].command == goldenFrames[status].command, "the packets have their documented command identifiers");
+  }
+
+  mock_set_time_us(RECEIVED_AT_US);
+  VescTelemetry before = vescTelemetry[NODE - VESC_FIRST_NODE].read();
+  for(size_t i = 0; i < sizeof(goldenFrames) / sizeof(goldenFrames[0]); i++){
+    const GoldenFrame *golden = &goldenFrames[i];
+    deliver(NODE, golden, 8);
+    VescTelemetry after = vescTelemetry[NODE - VESC_FIRST_NODE].read();
+
+    printf("%s:", vescStatusPackets[golden->status].name);
+    bool decoded = true;
+    for(uint8_t j = 0; j < fieldCount[golden->status]; j++){
+      float value = field(&after, golden->status, j);
+      printf(" %g", value);
+      decoded = decoded && fabsf(value - golden->values[j]) <= 1e-5f * (1 + fabsf(golden->values[j]));
+    }
+    printf("\n");
+    check(decoded, vescStatusPackets[golden->status].name);
+
+    //The other packets' fields keep their values
+    bool othersKept = true;
+    for(uint8_t status = 0; status < VESC_STATUS_COUNT; status++){
+      if(status != golden->status) othersKept = othersKept && same_fields(&before, &after, status);
+    }
+    check(othersKept, "a packet only updates its own fields");
+    check(after.received == (before.received | 1 << golden->status) && after.received_at[golden->status] == RECEIVED_AT_US,
+          "a packet is flagged and timestamped");
+    check(vesc_status_fresh(&after, golden->status, RECEIVED_AT_US), "a packet is fresh when received");
+    before = after;
+  }
+
+  //A short frame and frames of nodes without telemetry change nothing
+  VescTelemetry published[VESC_NODE_COUNT];
+  for(uint8_t i = 0; i < VESC_NODE_COUNT; i++) published[i] = vescTelemetry[i].read();
+  mock_advance_time_us(1000);
+  deliver(NODE, &goldenFrames[VESC_STATUS_1], 7);
+  deliver(VESC_FIRST_NODE - 1, &goldenFrames[VESC_STATUS_1], 8);
+  deliver(VESC_FIRST_NODE + VESC_NODE_COUNT, &goldenFrames[VESC_STATUS_1], 8);
+  bool unchanged = true;
+  for(uint8_t i = 0; i < VESC_NODE_COUNT; i++){
+    VescTelemetry telemetry = vescTelemetry[i].read();
+    unchanged = unchanged && same_telemetry(&telemetry, &published[i]);
+  }
+  check(unchanged, "short frames and frames of other nodes are ignored");
+
+  printf("VESC status: %u checks failed\n", failures);
+  return failures == 0 ? 0 : 1;
+}
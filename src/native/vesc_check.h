@@ -0,0 +1,10 @@
+#ifndef VESC_CHECK_H
+#define VESC_CHECK_H
+
+/* Checks of the VESC status packet decoders (VESC_status.h) on golden frames: payloads of the status packets 1 to 6, encoded by hand from
+the VESC CAN documentation, must decode to the known values, update only their own fields, timestamp and flag their packet and publish the
+telemetry. Frames that are too short or come from other nodes must be ignored. Prints the decoded values on stdout. */
+
+int run_vesc_check();
+
+#endif
@@ -0,0 +1,68 @@
+#include <math.h>
+#include <algorithm>
+#include "vesc_model.h"
+
+//120 kg on two 10" wheels: 60 kg * 0.127^2 m^2 at the direct drive hub motor
+const VescMotorConfig VESC_DRIVE_MOTOR = {15, 0.95f, 0.2f, 0.97f, 0.05f, 0.0f, 50.0f, 10000.0f, 0.1f, 24.0f};
+//Assembly behind a 100:1 gear, its weight 0.02 Nm at the motor
+const VescMotorConfig VESC_ASSEMBLY_MOTOR = {7, 0.05f, 0.1f, 0.0002f, 0.00001f, 0.02f, 20.0f, 10000.0f, 0.05f, 24.0f};
+
+static float erpm_to_omega(float erpm, uint8_t pole_pairs){
+  return erpm / pole_pairs * 2 * (float)M_PI / 60;
+}
+
+VescMotorModel::VescMotorModel(const VescMotorConfig &config)
+  : config(config), targetOmega(0), released(true), omega(0), angle(0), motorCurrent(0){}
+
+void VescMotorModel::set_erpm(float erpm){
+  //The VESC limits the commanded speed
+  erpm = std::max(-config.erpm_max, std::min(config.erpm_max, erpm));
+  targetOmega = erpm_to_omega(erpm, config.pole_pairs);
+  released = false;
+}
+
+void VescMotorModel::release(){
+  released = true;
+}
+
+void VescMotorModel::advance(float seconds){
+  /* Integrates the motor's motion over a time, in steps of at most VESC_MODEL_STEP_S
+    Arguments:
+      - float seconds: Time to advance
+    Returns:
+      - void
+  */
+  while(seconds > 0){
+    float dt = std::min(seconds, VESC_MODEL_STEP_S);
+    seconds -= dt;
+    motorCurrent = 0;
+    if(!released){
+      //Current for the acceleration the speed loop wants, plus the loads at the current speed
+      float torque = config.inertia * (targetOmega - omega) / config.time_constant + config.friction * omega + config.load_torque;
+      motorCurrent = std::max(-config.current_max, std::min(config.current_max, torque / config.kt));
+    }
+    float acceleration = (config.kt * motorCurrent - config.friction * omega - config.load_torque) / config.inertia;
+    //Semi-implicit Euler: the position moves with the new speed
+    omega += acceleration * dt;
+    angle += omega * dt;
+  }
+}
+
+float VescMotorModel::erpm() const{
+  return omega * 60 / (2 * (float)M_PI) * config.pole_pairs;
+}
+
+float VescMotorModel::duty() const{
+  float duty = (config.kt * omega + config.resistance * motorCurrent) / config.v_in;
+  return std::max(-1.0f, std::min(1.0f, duty));
+}
+
+float VescMotorModel::current_in() const{
+  //Power balance of the motor controller, without its losses
+  return duty() * motorCurrent;
+}
+
+int32_t VescMotorModel::tachometer() const{
+  //6 commutation steps per electrical revolution
+  return (int32_t)floorf(angle / (2 * (float)M_PI) * config.pole_pairs * 6);
+}
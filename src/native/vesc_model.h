@@ -0,0 +1,58 @@
+#ifndef VESC_MODEL_H
+#define VESC_MODEL_H
+
+/* Motor model of the simulated VESCs (virtual_bus.h). The VESC's speed loop is modelled as first order: it asks for the current that
+brings the motor to the target speed with the loop's time constant, within the current limit, and the motor follows
+
+  inertia * d(omega)/dt = kt * current - friction * omega - load_torque
+
+with omega the mechanical speed of the motor shaft. The inertia and the loads are the ones seen by the motor shaft, through the gear and the
+wheel or assembly. The electrical speed is omega times the pole pairs, the duty cycle is the back EMF and the resistive drop over the input
+voltage. A released motor (VESC timeout) gets no current and coasts under its loads. */
+
+#include <Arduino.h>
+
+#define VESC_MODEL_STEP_S 0.0001f     // Longest integration step
+
+struct VescMotorConfig{
+  uint8_t pole_pairs;
+  float kt;                 // Torque constant, Nm/A, also the back EMF constant in V s/rad
+  float resistance;         // Phase resistance, ohm
+  float inertia;            // kg m^2 at the motor shaft
+  float friction;           // Viscous friction, Nm per rad/s
+  float load_torque;        // Constant torque against positive rotation, e.g. gravity on an assembly, Nm
+  float current_max;        // Motor current limit, A
+  float erpm_max;           // Speed limit, ERPM
+  float time_constant;      // Time constant of the VESC's speed loop, s
+  float v_in;               // Battery voltage, V
+};
+
+//Hub motor of a drive wheel, with half of the chair's and user's mass on the wheel
+extern const VescMotorConfig VESC_DRIVE_MOTOR;
+//Geared motor of a stair climbing assembly, holding the assembly against gravity
+extern const VescMotorConfig VESC_ASSEMBLY_MOTOR;
+
+class VescMotorModel{
+  public:
+  VescMotorModel(const VescMotorConfig &config);
+  void set_erpm(float erpm);
+  void release();
+  void advance(float seconds);
+  float erpm() const;
+  float current() const { return motorCurrent; }
+  float duty() const;
+  float current_in() const;
+  float position() const { return angle; }   // Motor shaft, rad
+  int32_t tachometer() const;
+  const VescMotorConfig &get_config() const { return config; }
+
+  private:
+  VescMotorConfig config;
+  float targetOmega;
+  bool released;
+  float omega;              // rad/s
+  float angle;
+  float motorCurrent;
+};
+
+#endif
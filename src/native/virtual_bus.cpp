@@ -0,0 +1,297 @@
+#include <math.h>
+#include <algorithm>
+#include "virtual_bus.h"
+#include "mock_devices.h"
+#include "TWAI_handler.h"
+#include "TWAI_dispatch.h"
+#include "TWAI_stats.h"
+#include "config.h"
+
+static uint32_t next_random(uint32_t *state){
+  *state = *state * 1664525 + 1013904223;
+  return *state >> 8;
+}
+
+twai_message_t vesc_status_frame(uint8_t node, uint8_t command, int32_t value, int16_t a, int16_t b){
+  //Status packet with a 32 bit value followed by two 16 bit values, or four 16 bit values if a and b are the last two
+  twai_message_t message = {};
+  message.identifier = vesc_frame_id(node, command);
+  message.extd = 1;
+  message.data_length_code = 8;
+  message.data[0] = value >> 24;
+  message.data[1] = value >> 16;
+  message.data[2] = value >> 8;
+  message.data[3] = value;
+  message.data[4] = a >> 8;
+  message.data[5] = a;
+  message.data[6] = b >> 8;
+  message.data[7] = b;
+  return message;
+}
+
+twai_message_t actuators_controller_frame(uint32_t identifier, int32_t value){
+  twai_message_t message = {};
+  message.identifier = identifier;
+  message.data_length_code = 4;
+  message.data[0] = value >> 24;
+  message.data[1] = value >> 16;
+  message.data[2] = value >> 8;
+  message.data[3] = value;
+  return message;
+}
+
+uint32_t arbitration_field(const twai_message_t *message){
+  /* Orders frames like the arbitration on the bus: the bits from the base identifier to the RTR bit, first bit most significant
+    Arguments:
+      - const twai_message_t *message: The frame
+    Returns:
+      - uint32_t: The frame with the lower value wins
+  */
+  if(message->extd){
+    //Base identifier, SRR and IDE (both recessive), identifier extension, RTR
+    uint32_t identifier = message->identifier & TWAI_EXTD_ID_MASK;
+    return (identifier >> 18) << 21 | 1 << 20 | 1 << 19 | (identifier & 0x3FFFF) << 1 | message->rtr;
+  }
+  //Identifier, RTR and IDE (dominant)
+  return (message->identifier & TWAI_STD_ID_MASK) << 21 | (uint32_t)message->rtr << 20;
+}
+
+VirtualNode::VirtualNode(const char *name) : name(name), stats(){}
+
+void VirtualNode::release(const twai_message_t *message, uint64_t time){
+  Queued frame = {*message, time};
+  queue.push_back(frame);
+  stats.released++;
+  if(queue.size() > stats.max_queued) stats.max_queued = queue.size();
+}
+
+VescNode::VescNode(uint8_t node, uint32_t status_period_us, uint32_t slow_period_us, const VescMotorConfig &motor)
+  : VirtualNode(label), node(node), rpm(0), commands(0), changed_at(0), motor(motor), statusPeriod(status_period_us),
+    slowPeriod(slow_period_us), modelTime(mock_time_us()), commandAt(0){
+  snprintf(label, sizeof(label), "VESC %u", node);
+  //The nodes start 1 ms apart, so their status frames do not always collide
+  nextStatus = mock_time_us() + node * 1000;
+  nextSlow = nextStatus + 500;
+}
+
+void VescNode::advance_to(uint64_t time){
+  //Moves the motor to the time, releasing it once the last command is older than the VESC's timeout
+  if(time <= modelTime) return;
+  if(commands > 0 && time - commandAt > VESC_CAN_TIMEOUT_MS * 1000ULL){
+    uint64_t timeout = std::max<uint64_t>(modelTime, commandAt + VESC_CAN_TIMEOUT_MS * 1000ULL);
+    motor.advance((timeout - modelTime) / 1e6f);
+    motor.release();
+    modelTime = timeout;
+  }
+  motor.advance((time - modelTime) / 1e6f);
+  modelTime = time;
+}
+
+uint64_t VescNode::update(uint64_t now){
+  while(std::min(nextStatus, nextSlow) <= now){
+    if(nextStatus <= nextSlow){
+      advance_to(nextStatus);
+      twai_message_t message = vesc_status_frame(node, CAN_PACKET_STATUS, lroundf(motor.erpm()), lroundf(motor.current() * 10),
+                                                 lroundf(motor.duty() * 1000));
+      release(&message, nextStatus);
+      nextStatus += statusPeriod;
+      continue;
+    }
+    advance_to(nextSlow);
+    twai_message_t message = vesc_status_frame(node, CAN_PACKET_STATUS_4, 300 << 16 | 350, lroundf(motor.current_in() * 10), 0);
+    release(&message, nextSlow);
+    message = vesc_status_frame(node, CAN_PACKET_STATUS_5, motor.tachometer(), lroundf(motor.get_config().v_in * 10), 0);
+    release(&message, nextSlow);
+    nextSlow += slowPeriod;
+  }
+  return std::min(nextStatus, nextSlow);
+}
+
+void VescNode::receive(const twai_message_t *message, uint64_t time){
+  if(!message->extd || message->identifier != vesc_frame_id(node, CAN_PACKET_SET_RPM)) return;
+  int32_t value = (int32_t)((uint32_t)message->data[0] << 24 | message->data[1] << 16 | message->data[2] << 8 | message->data[3]);
+  advance_to(time);
+  motor.set_erpm(value);
+  commands++;
+  commandAt = time;
+  if(value == rpm) return;
+  rpm = value;
+  changed_at = time;
+}
+
+ActuatorsNode::ActuatorsNode(uint32_t period_us)
+  : VirtualNode("Actuators"), period(period_us), count(0), left(NULL), right(NULL), gearRatio(1){
+  next = mock_time_us() + 500;
+}
+
+void ActuatorsNode::set_assemblies(VescNode *left, VescNode *right, float gear_ratio){
+  this->left = left;
+  this->right = right;
+  gearRatio = gear_ratio;
+}
+
+float ActuatorsNode::angle(const VescNode *assembly) const{
+  //Degrees, 0 where the motor started
+  return assembly->motor.position() * 180 / (float)M_PI / gearRatio;
+}
+
+uint64_t ActuatorsNode::update(uint64_t now){
+  for(; next <= now; next += period, count++){
+    twai_message_t message = {};
+    message.identifier = 42;
+    message.data_length_code = 8;
+    float angles[2] = {12.5f + count % 10, -3.0f};
+    if(left != NULL && right != NULL){
+      left->advance_to(next);
+      right->advance_to(next);
+      angles[0] = angle(left);
+      angles[1] = angle(right);
+    }
+    memcpy(message.data, angles, sizeof(angles));
+    release(&message, next);
+    message = actuators_controller_frame(100, 24);
+    release(&message, next);
+    message = actuators_controller_frame(101, 23);
+    release(&message, next);
+    message = actuators_controller_frame(102, 31);
+    release(&message, next);
+  }
+  return next;
+}
+
+LoadNode::LoadNode(const char *name, uint32_t identifier, bool extd, uint8_t length, float frames_per_second, bool random, uint32_t seed)
+  : VirtualNode(name), message(), meanGap(1e6f / frames_per_second), random(random), seed(seed){
+  message.identifier = identifier;
+  message.extd = extd;
+  message.data_length_code = length;
+  for(int i = 0; i < length; i++) message.data[i] = next_random(&this->seed);
+  next = mock_time_us() + (uint64_t)meanGap;
+}
+
+uint64_t LoadNode::update(uint64_t now){
+  while(next <= now){
+    release(&message, next);
+    if(!random){
+      next += (uint64_t)meanGap;
+      continue;
+    }
+    //Exponentially distributed gap, at least 1 us so the time moves on
+    double uniform = (next_random(&seed) + 0.5) / 16777216.0;
+    next += std::max<uint64_t>(1, (uint64_t)(-log(uniform) * meanGap));
+  }
+  return next;
+}
+
+VirtualBus::VirtualBus() : bitrate(twai_bitrate(&t_config)), busTime(mock_time_us()), errorRate(0), seed(1), stats(){}
+
+VirtualBus::~VirtualBus(){
+  for(size_t i = 0; i < nodes.size(); i++) delete nodes[i];
+}
+
+void VirtualBus::add_node(VirtualNode *node){
+  //The bus owns the node
+  nodes.push_back(node);
+}
+
+void VirtualBus::set_error_rate(float errors_per_frame, uint32_t seed){
+  errorRate = errors_per_frame;
+  this->seed = seed;
+}
+
+void VirtualBus::reset_stats(){
+  stats = VirtualBusStats();
+  for(size_t i = 0; i < nodes.size(); i++) nodes[i]->stats = VirtualNodeStats();
+}
+
+bool VirtualBus::error_injected(){
+  return errorRate > 0 && next_random(&seed) / 16777216.0 < errorRate;
+}
+
+void VirtualBus::run_until(uint64_t time){
+  /* Sends the frames of the nodes and the controller until the bus time reaches time. A frame started before time is sent completely, the
+  bus time can end up to one frame after time.
+    Arguments:
+      - uint64_t time: End of the run, in simulated us
+    Returns:
+      - void
+  */
+  uint64_t start = busTime;
+  while(busTime < time){
+    uint64_t nextRelease = UINT64_MAX;
+    for(size_t i = 0; i < nodes.size(); i++) nextRelease = std::min(nextRelease, nodes[i]->update(busTime));
+
+    //Arbitration among the first frame of each node and the controller's next frame
+    twai_message_t controllerFrame;
+    bool controllerReady = mock_twai_tx_next(&controllerFrame);
+    VirtualNode *winner = NULL;
+    uint32_t lowest = controllerReady ? arbitration_field(&controllerFrame) : 0;
+    bool found = controllerReady;
+    for(size_t i = 0; i < nodes.size(); i++){
+      if(nodes[i]->queue.empty()) continue;
+      uint32_t field = arbitration_field(&nodes[i]->queue.front().message);
+      if(found && field >= lowest) continue;
+      winner = nodes[i];
+      lowest = field;
+      found = true;
+    }
+    if(!found){
+      //Idle until the next frame is released
+      busTime = std::min(nextRelease, time);
+      continue;
+    }
+    if(winner != NULL && controllerReady) mock_twai_arbitration_lost();
+    for(size_t i = 0; i < nodes.size(); i++) if(nodes[i] != winner && !nodes[i]->queue.empty()) nodes[i]->stats.arbitration_lost++;
+
+    twai_message_t message = winner != NULL ? winner->queue.front().message : controllerFrame;
+    uint8_t stuffBits;
+    uint32_t bits = twai_frame_bits(&message, &stuffBits);
+    if(error_injected()){
+      //Destroyed somewhere before the CRC delimiter, the transmitter tries again after the error frame
+      bits = 1 + next_random(&seed) % (bits - 14) + VIRTUAL_BUS_ERROR_FRAME_BITS;
+      uint64_t duration = ((uint64_t)bits * 1000000 + bitrate / 2) / bitrate;
+      busTime += duration;
+      stats.busy_us += duration;
+      stats.error_frames++;
+      if(winner != NULL) winner->stats.errors++;
+      mock_twai_bus_error(winner == NULL);
+      continue;
+    }
+    uint64_t duration = ((uint64_t)bits * 1000000 + bitrate / 2) / bitrate;
+    busTime += duration;
+    stats.busy_us += duration;
+    stats.frames++;
+
+    if(winner != NULL){
+      uint64_t latency = busTime - winner->queue.front().released;
+      winner->queue.pop_front();
+      winner->stats.sent++;
+      winner->stats.latency_sum_us += latency;
+      if(latency > winner->stats.max_latency_us) winner->stats.max_latency_us = latency;
+      stats.controller_received++;
+      mock_twai_rx_done();
+      if(!mock_twai_deliver(&message)) stats.controller_dropped++;
+    }
+    else{
+      mock_twai_tx_done();
+      stats.controller_sent++;
+    }
+    for(size_t i = 0; i < nodes.size(); i++){
+      if(nodes[i] == winner) continue;
+      nodes[i]->stats.received++;
+      nodes[i]->receive(&message, busTime);
+    }
+  }
+  stats.elapsed_us += busTime - start;
+}
+
+void VirtualBus::print_stats() const{
+  printf("  Bus: %u frames, %u error frames, utilization %.1f%%, controller sent %u, received %u (%u filtered or lost)\n", stats.frames,
+         stats.error_frames, stats.elapsed_us > 0 ? 100.0 * stats.busy_us / stats.elapsed_us : 0.0, stats.controller_sent,
+         stats.controller_received, stats.controller_dropped);
+  for(size_t i = 0; i < nodes.size(); i++){
+    const VirtualNodeStats &node = nodes[i]->stats;
+    printf("  %s: %u/%u sent, latency mean %.0f us, max %u us, %u arbitrations lost, %u errors, at most %u queued\n", nodes[i]->name,
+           node.sent, node.released, node.sent > 0 ? (double)node.latency_sum_us / node.sent : 0.0, node.max_latency_us,
+           node.arbitration_lost, node.errors, node.max_queued);
+  }
+}
@@ -0,0 +1,154 @@
+#ifndef VIRTUAL_BUS_H
+#define VIRTUAL_BUS_H
+
+/* Virtual CAN bus of the native environment. It connects the mock TWAI driver, the controller's node, to simulated nodes and sends their
+frames one after the other in simulated time: among the frames that are ready when the bus becomes idle, the one with the lowest
+arbitration field wins (identifier bits first, a standard frame before an extended frame with the same base identifier), and the bus is
+busy for the frame's exact length (twai_frame_bits()) at the bit rate of t_config. The other nodes receive each frame at its end, the
+controller through its acceptance filter and RX queue.
+
+Errors are injected at a rate per frame: the frame is destroyed at a random bit, an error frame follows, the error counters of the
+transmitter and the receivers are updated like the controllers do and the transmitter sends the frame again after the error frame.
+
+The simulated nodes queue their frames in order and send them one at a time, like a controller with a single TX buffer. The host program
+runs the bus up to a time with run_until() and advances the simulated time itself, the frames the controller hands to the driver meanwhile
+compete from the next run on. */
+
+#include <deque>
+#include <vector>
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "vesc_model.h"
+
+#define VIRTUAL_BUS_ERROR_FRAME_BITS 20     // Error flag, its superposition by the other nodes, delimiter and interframe space
+
+twai_message_t vesc_status_frame(uint8_t node, uint8_t command, int32_t value, int16_t a, int16_t b);
+twai_message_t actuators_controller_frame(uint32_t identifier, int32_t value);
+uint32_t arbitration_field(const twai_message_t *message);
+
+struct VirtualNodeStats{
+  uint32_t released;        // Frames the node wanted to send
+  uint32_t sent;
+  uint32_t received;
+  uint32_t arbitration_lost;      // Times the node had a frame ready and another node won the bus
+  uint32_t errors;          // Frames of the node destroyed by an injected error
+  uint64_t latency_sum_us;  // Time from the release of a frame to its end on the bus
+  uint32_t max_latency_us;
+  uint32_t max_queued;
+};
+
+class VirtualNode{
+  public:
+  VirtualNode(const char *name);
+  virtual ~VirtualNode(){}
+  const char *get_name() const { return name; }
+  VirtualNodeStats get_stats() const { return stats; }
+  //Queues the frames released up to now and returns the time of the next release, UINT64_MAX if there is none
+  virtual uint64_t update(uint64_t now) = 0;
+  //Called at the end of every frame of the other nodes
+  virtual void receive(const twai_message_t *message, uint64_t time){}
+
+  protected:
+  void release(const twai_message_t *message, uint64_t time);
+
+  private:
+  friend class VirtualBus;
+  struct Queued{
+    twai_message_t message;
+    uint64_t released;
+  };
+  const char *name;
+  std::deque<Queued> queue;
+  VirtualNodeStats stats;
+};
+
+//VESC in RPM mode: drives its motor model (vesc_model.h) to the last SET_RPM and reports the motor's ERPM, current and duty cycle in
+//CAN_PACKET_STATUS, the temperatures and input current in CAN_PACKET_STATUS_4 and the tachometer and input voltage in CAN_PACKET_STATUS_5.
+//Without a command for VESC_CAN_TIMEOUT_MS it releases the motor.
+class VescNode : public VirtualNode{
+  public:
+  VescNode(uint8_t node, uint32_t status_period_us, uint32_t slow_period_us, const VescMotorConfig &motor = VESC_DRIVE_MOTOR);
+  uint64_t update(uint64_t now);
+  void receive(const twai_message_t *message, uint64_t time);
+  void advance_to(uint64_t time);
+  uint8_t node;
+  int32_t rpm;              // Last RPM setpoint received
+  uint32_t commands;        // SET_RPM frames received
+  uint64_t changed_at;      // Time the setpoint last changed
+  VescMotorModel motor;
+
+  private:
+  char label[12];
+  uint32_t statusPeriod;
+  uint32_t slowPeriod;
+  uint64_t nextStatus;
+  uint64_t nextSlow;
+  uint64_t modelTime;       // Time the motor model was advanced to
+  uint64_t commandAt;
+};
+
+//Actuators controller: assembly angles (ID 42), voltages and temperature (IDs 100 to 102). The angles are fixed, or the ones of the
+//assemblies driven by two simulated VESCs.
+class ActuatorsNode : public VirtualNode{
+  public:
+  ActuatorsNode(uint32_t period_us);
+  uint64_t update(uint64_t now);
+  void set_assemblies(VescNode *left, VescNode *right, float gear_ratio);
+  float angle(const VescNode *assembly) const;
+
+  private:
+  uint32_t period;
+  uint64_t next;
+  uint32_t count;
+  VescNode *left;
+  VescNode *right;
+  float gearRatio;          // Motor revolutions per assembly revolution
+};
+
+//Other traffic: frames of one identifier at a fixed rate, or with exponentially distributed gaps at the same mean rate
+class LoadNode : public VirtualNode{
+  public:
+  LoadNode(const char *name, uint32_t identifier, bool extd, uint8_t length, float frames_per_second, bool random, uint32_t seed);
+  uint64_t update(uint64_t now);
+
+  private:
+  twai_message_t message;
+  float meanGap;            // us
+  bool random;
+  uint32_t seed;
+  uint64_t next;
+};
+
+struct VirtualBusStats{
+  uint32_t frames;
+  uint32_t error_frames;
+  uint32_t controller_sent;
+  uint32_t controller_received;   // Frames of the other nodes, whether the controller's filter accepted them or not
+  uint32_t controller_dropped;    // Frames the controller could not receive, filtered or with its RX queue full
+  uint64_t busy_us;
+  uint64_t elapsed_us;
+};
+
+class VirtualBus{
+  public:
+  VirtualBus();
+  ~VirtualBus();
+  void add_node(VirtualNode *node);
+  void set_error_rate(float errors_per_frame, uint32_t seed);
+  void run_until(uint64_t time);
+  uint64_t now() const { return busTime; }
+  VirtualBusStats get_stats() const { return stats; }
+  void reset_stats();
+  void print_stats() const;
+
+  private:
+  bool error_injected();
+  std::vector<VirtualNode *> nodes;
+  uint32_t bitrate;
+  uint64_t busTime;
+  float errorRate;
+  uint32_t seed;
+  VirtualBusStats stats;
+};
+
+#endif
@@ -1,537 +1,537 @@
-#ifndef SELECTOR_DRIVE_H
-#define SELECTOR_DRIVE_H
- 
-const uint16_t selector_drive[] PROGMEM = {0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfcf8,0xfcf8,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xf4f7,0xfd18,0xfd18,0xfd18,0xfcf8,0xf518,0xed38,0xed38,
-0xf518,0xfd18,0xfd18,0xfd18,0xf518,0xf517,0xf517,0xf517,0xf518,0xf538,0xfd38,0xfd18,0xfd18,0xfd18,0xfd18,0xf517,
-0xf538,0xed58,0xf538,0xf518,0xfd18,0xfd18,0xfcf8,0xfcf8,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xf517,0xf537,
-0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf00c,0xe82c,0xe82c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xf518,0xf518,0xf518,0xf518,
-0xfd18,0xfd18,0xfd38,0xfd18,0xfcf7,0xfcf8,0xfd18,0xf518,0xf538,0xf538,0xfd38,0xfd18,0xf517,0xf518,0xfd38,0xfd38,
-0xfd38,0xfd18,0xf518,0xfd18,0xf518,0xf4f7,0xf4f7,0xf518,0xfd18,0xfd18,0xecf7,0xf518,0xf538,0xf518,0xfcf8,0xfcf8,
-0xfcf8,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,
-0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf538,0xf538,0xf518,0xfd18,0xfd18,0xfcf8,0xf4f7,0xf518,
-0xf538,0xf518,0xfcf8,0xfcf8,0xf4f7,0xf518,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf7,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd59,0xfcf7,0xf4d7,0xfcf8,0xfd38,0xfd18,0xf4f8,0xfcf8,0xfcf8,0xfd18,0xf518,0xf518,
-0xf518,0xf518,0xfd18,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xf518,0xf538,0xf538,0xf518,0xfd18,0xfcd7,0xfcf8,0xfd18,0xf538,0xf518,0xf518,0xfcf8,0xfcf8,0xf518,0xf538,
-0xf538,0xf538,0xf538,0xf558,0xed58,0xed58,0xf579,0xf578,0xed58,0xed37,0xed37,0xed37,0xed38,0xf538,0xecf7,0xfd38,
-0xfd38,0xfcf8,0xfcd7,0xfd18,0xfd38,0xf518,0xfcf8,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfcf8,0xfcf8,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,
-0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf538,0xf518,0xf518,
-0xfcf8,0xfd18,0xfd18,0xf518,0xf517,0xfd18,0xfd18,0xfd18,0xfd58,0xf538,0xed37,0xe578,0xedf9,0xf69c,0xff1d,0xff3e,
-0xff7e,0xffbf,0xffbf,0xff9f,0xff5e,0xfefd,0xee7b,0xe5f9,0xe577,0xed37,0xf4f7,0xfd18,0xfd18,0xfcf7,0xf518,0xfd58,
-0xf518,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,
-0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf538,
-0xf518,0xecf7,0xe517,0xedb9,0xfe9c,0xff3e,0xff9f,0xffbf,0xffdf,0xffdf,0xf7ff,0xf7ff,0xf7df,0xf7df,0xffdf,0xffdf,
-0xffbf,0xff9f,0xff1d,0xf61a,0xed57,0xf538,0xfd38,0xf517,0xed17,0xf538,0xf538,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfd18,
-0xfd18,0xfd18,0xf518,0xf518,0xf538,0xf518,0xfd18,0xfd38,0xf538,0xf538,0xed58,0xedb9,0xfedc,0xff7e,0xffbf,0xffbf,
-0xffbf,0xff9e,0xffbf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffbf,0xffbf,0xff3d,0xf61a,
-0xed58,0xed58,0xf558,0xed37,0xf538,0xf538,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,
-0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,
-0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfcf8,0xfcf8,0xfd18,0xf518,0xf538,0xed18,
-0xf538,0xf538,0xed17,0xe537,0xf63a,0xff3e,0xffbf,0xffdf,0xffbf,0xffbf,0xffbf,0xff9f,0xff7e,0xff1d,0xf6bb,0xf6bc,
-0xf6dc,0xfefc,0xff3d,0xff7e,0xff9f,0xffbf,0xffdf,0xffbe,0xffbf,0xff9f,0xfebc,0xed98,0xe537,0xf558,0xed38,0xf538,
-0xfd18,0xfcf8,0xfcf8,0xfcf8,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xe04c,0xe06c,0xd86c,0xd86c,0xe06c,0xe06c,0xd86c,0xd86c,0xd86c,0xd86c,
-0xd86c,0xd88c,0xd86c,0xe04c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfd18,0xfd18,0xf538,0xf538,0xf538,0xed38,0xed58,0xfe5b,0xff9f,0xffbf,
-0xffdf,0xffdf,0xffbf,0xff5e,0xf69b,0xedb9,0xe558,0xed58,0xf538,0xf538,0xed38,0xed37,0xed58,0xed99,0xf63a,0xfe9c,
-0xff9f,0xffbf,0xffdf,0xf7be,0xffbf,0xff3e,0xedb9,0xed58,0xed17,0xfd58,0xf4f7,0xfd18,0xfcf8,0xfd18,0xfd38,0xf518,
-0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe82c,
-0xd94e,0xe291,0xd24f,0xd291,0xd24f,0xd270,0xd290,0xd270,0xd270,0xd270,0xd290,0xd290,0xca50,0xe251,0xf14f,0xe02c,
-0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xf518,0xf538,0xed58,0xe558,0xf67b,0xff9f,0xffbf,0xffdf,0xffbf,0xff5e,0xf69b,0xe5d9,0xe578,0xed58,
-0xf538,0xfcf7,0xfcf7,0xfcf8,0xfd18,0xfd18,0xf538,0xf538,0xf558,0xed78,0xedd9,0xfefc,0xff9e,0xffdf,0xffdf,0xffbf,
-0xff1e,0xedb9,0xf538,0xf4f7,0xfd18,0xfd18,0xfcf8,0xf518,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,
-0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe06c,0xfc98,0xfe9e,0xfeff,0xff1f,0xff1f,0xff1f,
-0xff1f,0xff1f,0xff1f,0xff1f,0xfeff,0xff1f,0xfeff,0xfebf,0xfbd7,0xd86b,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xf538,0xe558,0xf69b,
-0xff9f,0xffbf,0xffbf,0xff9f,0xfedd,0xf5d9,0xe537,0xed58,0xf558,0xecf7,0xf4f7,0xfd58,0xfd18,0xfd18,0xfd18,0xfd18,
-0xf518,0xf518,0xf517,0xecf7,0xf558,0xed57,0xee1a,0xff9f,0xffdf,0xff9e,0xffbf,0xff3e,0xfdd9,0xecf7,0xfd18,0xfcf7,
-0xfd18,0xf518,0xf518,0xf538,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xd88c,0xfc77,0xff3f,0xff7f,0xff9f,0xff9e,0xff9f,0xff9f,0xff9f,0xff9f,0xff9f,0xffbf,0xff9f,
-0xff7f,0xff1f,0xfc16,0xc86b,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,
-0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xed37,0xedfa,0xff9f,0xffbf,0xff9e,0xff9f,0xfebc,0xed78,0xf538,
-0xf517,0xf518,0xf538,0xfd38,0xfd18,0xf518,0xfd38,0xfd18,0xf517,0xf4f7,0xf518,0xfd18,0xfd38,0xfd18,0xfd38,0xecf7,
-0xed58,0xf5fa,0xff3d,0xffbf,0xffdf,0xffbf,0xfebc,0xf578,0xfd18,0xfcf8,0xfd18,0xfd18,0xf518,0xf538,0xf518,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,
-0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xd08c,0xfcd7,0xff9f,
-0xffbf,0xf7de,0xf7de,0xffff,0xf7de,0xffff,0xffde,0xffdf,0xf7df,0xffff,0xffbf,0xff3f,0xfc57,0xd8ec,0xe82c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,
-0xf538,0xed78,0xff3e,0xffbf,0xffbe,0xffbf,0xfe9b,0xed78,0xed17,0xfd18,0xfd38,0xf518,0xf4f8,0xfd18,0xfd18,0xf4f7,
-0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,0xfd18,0xecf7,0xf61a,0xff7e,0xffdf,0xffbe,
-0xff9f,0xfe7b,0xf537,0xfd18,0xfcf8,0xfd18,0xfd38,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,
-0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xd08c,0xf4b7,0xff9f,0xffdf,0xffdf,0xffdf,0xfffe,0xf7de,0xf7fe,
-0xf7fe,0xf7ff,0xf7ff,0xf7ff,0xffbf,0xff3f,0xfbf6,0xd08b,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfcf8,0xfcf8,0xf518,0xf518,0xf518,0xf518,0xfd18,0xf518,0xed37,0xfe9c,0xffbf,0xffdf,0xffbe,0xff1d,
-0xed98,0xed17,0xfd38,0xfd18,0xfcf8,0xfd18,0xfd18,0xfcf8,0xf4f8,0xfd18,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,
-0xfcf8,0xfcf8,0xfd18,0xfd18,0xfcf7,0xfd38,0xed58,0xedf9,0xff9e,0xffdf,0xffdf,0xff3d,0xed99,0xf538,0xfcf7,0xfd18,
-0xfd38,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xd08c,0xecb6,0xff7f,0xffbf,0xffdf,0xffde,0xf7de,0xefbd,0xf7fe,0xf7de,0xf7ff,0xf7ff,0xf7ff,0xffbf,0xff3f,
-0xfc36,0xd0ac,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfd18,0xf538,0xf538,
-0xf518,0xfd18,0xfd18,0xf538,0xed99,0xff9f,0xffbf,0xffdf,0xff5e,0xdd98,0xed57,0xfd17,0xf4f7,0xfd38,0xfd38,0xf4f8,
-0xf4f8,0xfd39,0xfd39,0xf4f8,0xfd18,0xfd18,0xf518,0xf4f8,0xf4f8,0xf518,0xfd18,0xfd38,0xed38,0xf538,0xfd18,0xfd18,
-0xf4d6,0xed57,0xfedc,0xffbf,0xffff,0xffdf,0xf69b,0xed78,0xf517,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,
-0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xd08c,0xf4f7,0xff9f,0xffbf,0xffdf,
-0xffbe,0xffde,0xf7fe,0xf7fe,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xffdf,0xff5f,0xfc57,0xc86b,0xe82c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xed38,0xf67b,0xffbf,
-0xffdf,0xffbe,0xf69b,0xe557,0xfd58,0xfcf7,0xfd18,0xf4f8,0xf4f8,0xfd38,0xfd18,0xf4f7,0xf4f8,0xfd38,0xfcf8,0xfcf8,
-0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf538,0xed18,0xf518,0xfcf7,0xfd38,0xf537,0xe5b8,0xff5e,0xf7de,0xffdf,
-0xff7e,0xe5b8,0xf538,0xfd18,0xf4f7,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe82c,0xe06c,0xd08c,0xd08c,0xd08c,0xd08c,0xd0ac,0xd0ac,0xd0ac,
-0xd08c,0xd08c,0xd08c,0xd08c,0xd08c,0xb10b,0xe517,0xffbf,0xffdf,0xffdf,0xffbe,0xffde,0xf7fe,0xeffe,0xf7fe,0xf7ff,
-0xf7fe,0xf7ff,0xffdf,0xff3f,0xfc36,0xd0ac,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,
-0xf4f8,0xfd38,0xfd18,0xfd18,0xfd18,0xfd38,0xecf7,0xed78,0xff9e,0xffdf,0xffdf,0xff7e,0xe598,0xed38,0xf538,0xf518,
-0xf518,0xfd39,0xf4d7,0xfcf8,0xfd38,0xf518,0xfd38,0xf518,0xfd18,0xfd18,0xfd18,0xf4f8,0xf518,0xfd18,0xfcf8,0xfd18,
-0xfd18,0xf517,0xf538,0xf538,0xf517,0xf517,0xed98,0xee3a,0xffbf,0xffbf,0xff9f,0xf65a,0xe537,0xed17,0xf538,0xfd38,
-0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xd84b,0xfc57,0xfd7b,0xfdbb,0xfddb,0xfdda,0xfe1b,0xfdfa,0xfdfa,0xfdfa,0xfdda,0xfddb,0xfddb,0xfddb,0xfe1b,
-0xff5e,0xffbe,0xffdf,0xffdf,0xffdf,0xffdf,0xf7ff,0xf7ff,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,
-0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd38,0xfcf8,0xfcf8,0xfd18,0xf538,
-0xed17,0xedd9,0xffbf,0xf7df,0xffdf,0xff9f,0xf61a,0xed78,0xe558,0xed58,0xed38,0xf538,0xfd18,0xf518,0xf4f8,0xf518,
-0xfd58,0xf517,0xf518,0xf4f7,0xf518,0xfd58,0xfd59,0xf538,0xf4f8,0xfd18,0xfd18,0xf538,0xe558,0xe558,0xe557,0xed78,
-0xf63a,0xfefc,0xff9e,0xffbe,0xffbf,0xff1d,0xed78,0xf538,0xf518,0xf4f7,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,
-0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf02c,0xf00c,0xf80b,0xf80c,0xf80c,0xf80c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00b,0xd8cc,0xfd9b,0xff7f,0xff9f,0xff9f,
-0xffbe,0xffbe,0xffde,0xffde,0xffbf,0xffbf,0xff9f,0xffbf,0xffbf,0xffbf,0xf7be,0xffff,0xffff,0xffff,0xf7df,0xf7df,
-0xffff,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfcf8,0xfd18,0xfd18,0xf538,0xf558,0xfe5b,0xffbf,0xf7ff,0xffdf,0xffbf,
-0xff9f,0xff9f,0xff5e,0xee9b,0xee1a,0xe558,0xe538,0xf558,0xf518,0xf4f7,0xf517,0xf538,0xed38,0xf558,0xf558,0xed37,
-0xe4f7,0xecf7,0xf518,0xf518,0xed38,0xe578,0xe5d9,0xee7b,0xff1d,0xff7e,0xffbf,0xffdf,0xf7ff,0xf7ff,0xffdf,0xff9f,
-0xed58,0xfd18,0xfcf8,0xfcd7,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,
-0xe82c,0xe82c,0xf00c,0xf00c,0xf00b,0xd0ac,0xfdba,0xff7f,0xff9f,0xffbf,0xffbf,0xffdf,0xffde,0xffde,0xffbe,0xffbe,
-0xffbf,0xffbf,0xffbf,0xffdf,0xffdf,0xffff,0xffff,0xffff,0xf7df,0xffff,0xffff,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,
-0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,
-0xfcf8,0xfd18,0xf518,0xf538,0xed58,0xfedd,0xffdf,0xf7ff,0xffbf,0xff9f,0xff9f,0xff9f,0xffbf,0xffbf,0xff9f,0xff1e,
-0xfedc,0xedf9,0xe578,0xed78,0xed58,0xed98,0xfefd,0xff3e,0xff1e,0xfe5b,0xe578,0xed58,0xf5b9,0xf5b9,0xfe9c,0xff1e,
-0xff9f,0xffbf,0xffbf,0xffbf,0xffbf,0xffdf,0xefbe,0xf7ff,0xffdf,0xff9f,0xed78,0xfd18,0xfcf8,0xfcf8,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,
-0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf00c,0xf80d,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xe82c,0xe82c,0xe80c,0xf00c,0xf02c,0xd0ab,
-0xfdba,0xffbf,0xffdf,0xffdf,0xffdf,0xffbe,0xffde,0xfffe,0xffdf,0xffdf,0xffbf,0xffbf,0xffdf,0xffff,0xffff,0xffff,
-0xffff,0xf7df,0xffff,0xffff,0xffff,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xf518,0xfd18,0xf538,0xed37,0xed78,0xff3e,
-0xffdf,0xffdf,0xf71d,0xddf9,0xfe9c,0xff3e,0xff9f,0xff9f,0xffbf,0xffbf,0xffbf,0xffbf,0xff7e,0xf6dc,0xee9b,0xff9e,
-0xffbe,0xffde,0xffdf,0xffbf,0xff1d,0xf6dc,0xff5e,0xff9f,0xff9f,0xff9f,0xffbf,0xff9f,0xff9f,0xff3e,0xfe9b,0xee19,
-0xde7a,0xffbe,0xffdf,0xffbf,0xf5fa,0xf558,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,
-0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xe80b,0xf00c,0xf80c,0xf80d,0xf00c,0xe80c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00b,0xc8cb,0xfdda,0xffbf,0xffbf,0xffdf,0xffbf,0xffbe,
-0xffde,0xffde,0xffde,0xffde,0xffbf,0xffbf,0xffdf,0xf7df,0xffff,0xf7de,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,0xf538,0xf538,0xed37,0xe558,0xff5f,0xffbf,0xffbf,0xfebc,0xe578,0xe558,0xdd37,
-0xddb8,0xee7b,0xff1d,0xff9f,0xffbe,0xff7e,0xffbf,0xffbf,0xffbe,0xffde,0xf7fe,0xf7fe,0xf7ff,0xffff,0xffbe,0xff9e,
-0xffbf,0xffbf,0xff9f,0xff7f,0xfefd,0xf65b,0xe5b8,0xe557,0xed37,0xed78,0xddb8,0xffbf,0xffdf,0xffbe,0xfe5b,0xed58,
-0xf538,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf82d,0xf02d,0xf02c,0xf02c,0xe80c,0xe02c,0xe84c,0xe82c,0xe80c,0xe80c,0xe80c,0xe80c,0xf00c,
-0xf00c,0xf00c,0xe80b,0xc8cb,0xfdda,0xffbf,0xffbf,0xffdf,0xffdf,0xffdf,0xfffe,0xf7fe,0xf7ff,0xffdf,0xffdf,0xffdf,
-0xffff,0xf7ff,0xf7ff,0xf7de,0xf7df,0xffff,0xffff,0xffff,0xf7de,0xf7de,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,
-0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd38,0xf518,
-0xf518,0xed38,0xe558,0xff7f,0xff9e,0xffbf,0xfe7c,0xed17,0xf518,0xfd58,0xf558,0xed58,0xe537,0xed78,0xf5fa,0xfedd,
-0xff7e,0xff9e,0xffbe,0xffbe,0xf7fe,0xf7fe,0xf7ff,0xffde,0xffbf,0xff9f,0xff5e,0xfefd,0xf61a,0xf5b9,0xed58,0xed38,
-0xed37,0xf538,0xf517,0xed37,0xddd8,0xffbf,0xf7ff,0xffbe,0xfe5b,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,
-0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00b,0xf80c,0xf00c,0xe00b,
-0xe88d,0xd84b,0xd06b,0xd88c,0xe06c,0xe04c,0xe04c,0xe04c,0xe04c,0xe04c,0xe04c,0xe06c,0xe04b,0xc90c,0xfdba,0xff7f,
-0xffbf,0xffdf,0xf7de,0xf7fe,0xeffe,0xeffe,0xeffe,0xf7fe,0xffdf,0xffdf,0xf7df,0xf7ff,0xf7ff,0xffff,0xffff,0xffff,
-0xffff,0xf7df,0xf7de,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xf538,0xf518,0xf518,0xf538,0xe558,0xff7f,0xffbf,0xff9f,
-0xfe7c,0xf538,0xfcf7,0xfcf8,0xfcf7,0xf518,0xfd38,0xf537,0xed37,0xed58,0xdd57,0xee19,0xff9e,0xffde,0xffdf,0xf7de,
-0xf7de,0xffdf,0xffbf,0xf6bb,0xe598,0xe557,0xed38,0xf517,0xf4f7,0xf518,0xf538,0xfd38,0xfd17,0xf537,0xddb8,0xffbf,
-0xf7de,0xffdf,0xfe5b,0xf538,0xfd18,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xe86c,0xfa92,0xf2f3,0xeaf3,0xeaf2,0xf2d2,0xfad2,
-0xfad2,0xfad2,0xf2d2,0xf2d2,0xf2d2,0xf2d2,0xfaf2,0xdaf1,0xfe7c,0xff9f,0xffdf,0xffdf,0xf7fe,0xf7ff,0xf7ff,0xf7ff,
-0xf7ff,0xf7ff,0xffff,0xffdf,0xf7ff,0xf7ff,0xf7ff,0xf7de,0xffff,0xffff,0xffff,0xf7df,0xf7de,0xffff,0xf7fe,0xf7fe,
-0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xf518,0xf518,0xf538,0xf518,0xf517,0xed58,0xff3e,0xffbf,0xffbf,0xfe9c,0xed38,0xfd58,0xf4d7,0xfd38,0xf517,
-0xfd18,0xfd18,0xfd18,0xfd18,0xf538,0xed58,0xf65b,0xff9f,0xffdf,0xf7df,0xffdf,0xffbf,0xff3d,0xe598,0xed78,0xf538,
-0xf518,0xfd18,0xf517,0xf4f7,0xf538,0xf538,0xf517,0xf538,0xe5d9,0xffbf,0xffdf,0xffbf,0xfdfa,0xf538,0xf518,0xf518,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
-0xf82d,0xf80d,0xf00c,0xf00c,0xf00c,0xf82d,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,
-0xf80b,0xf80c,0xf00c,0xd8ac,0xfe3e,0xff3f,0xff3f,0xff5f,0xff5f,0xff3f,0xff5f,0xff5f,0xff5f,0xff5f,0xff5f,0xff5f,
-0xff3f,0xff7f,0xffdf,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffff,0xf7ff,0xf7ff,
-0xf7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,
-0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf538,0xfd18,0xf518,
-0xed58,0xfefd,0xffbf,0xffdf,0xff1e,0xe557,0xf558,0xf517,0xf518,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,0xf517,
-0xf599,0xfe7b,0xffbf,0xffdf,0xffdf,0xf73d,0xf63a,0xe537,0xf518,0xfcf8,0xfd18,0xfd18,0xfcf7,0xfd38,0xf538,0xecf7,
-0xf517,0xed58,0xee3a,0xff9f,0xffbf,0xff9f,0xf5da,0xf538,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,
-0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf82d,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf82c,0xf00b,0xf00b,0xc8ab,0xfede,0xffbf,
-0xffdf,0xf7be,0xffdf,0xffdf,0xffdf,0xffdf,0xffff,0xffff,0xffff,0xffdf,0xffdf,0xffdf,0xf7ff,0xf7ff,0xf7ff,0xf7ff,
-0xf7ff,0xf7ff,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffff,0xf7ff,0xf7ff,0xf7ff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xed58,0xfe9c,0xffbe,0xffdf,0xff9f,0xdd98,
-0xed58,0xf538,0xf4f7,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xf4f7,0xf517,0xed78,0xff3d,0xffbf,0xff9f,0xee3a,
-0xed58,0xed17,0xf518,0xfd18,0xfd18,0xfd18,0xfcf8,0xfd38,0xfd18,0xf517,0xf538,0xed57,0xfebc,0xffbf,0xff9e,0xff9f,
-0xf599,0xf518,0xf538,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf00b,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf00b,0xf82c,0xf82c,0xd0ab,0xfefe,0xffdf,0xf7be,0xffdf,0xffdf,0xffdf,0xffdf,0xffff,
-0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xffff,0xffdf,0xffff,0xf7ff,0xefff,0xf7ff,0xffff,0xf7ff,0xf7ff,
-0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,
-0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,
-0xfd18,0xf4f8,0xfd18,0xf538,0xf538,0xf61a,0xffbf,0xffff,0xffbf,0xe63a,0xe558,0xfd58,0xfcf7,0xfcf8,0xfd18,0xf518,
-0xed38,0xed38,0xfd18,0xfd18,0xf517,0xed38,0xfebc,0xff9f,0xff9f,0xe5d9,0xed17,0xfd18,0xf4f8,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfcd7,0xfd18,0xfd38,0xf537,0xe558,0xff3d,0xffbf,0xffbf,0xff3e,0xed58,0xf518,0xfd38,0xf518,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,
-0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00b,0xf00b,
-0xf00a,0xd0ab,0xfede,0xffff,0xf7be,0xffdf,0xffde,0xffde,0xfffe,0xf7fe,0xf7fe,0xf7fe,0xf7ff,0xf7ff,0xf7ff,0xf7ff,
-0xffdf,0xffdf,0xffdf,0xffdf,0xf7ff,0xefff,0xf7ff,0xffff,0xf7ff,0xf7ff,0xf7ff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfd18,0xfd18,0xf4f8,0xfd18,0xf518,0xf518,0xed99,
-0xff9f,0xffdf,0xffbf,0xfefd,0xe558,0xf517,0xfcf8,0xfcf8,0xfd18,0xf538,0xed38,0xed37,0xf538,0xfd38,0xfd18,0xed58,
-0xfebc,0xff9f,0xff9f,0xe5b9,0xed38,0xfd38,0xf4f7,0xf518,0xfd18,0xfd18,0xfd18,0xfcb7,0xfcf8,0xfd18,0xecf7,0xf5fa,
-0xff9f,0xffbf,0xffbf,0xf69c,0xed38,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,
-0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00b,0xf82c,0xe80b,0xf82c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf82c,0xf00b,0xf82b,0xd0ec,0xfebd,0xffdf,0xffdf,0xffde,
-0xfffe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7ff,0xf7ff,0xf7ff,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xf7ff,0xf7ff,
-0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfcf8,0xfd18,0xfd18,0xf4f8,0xf538,0xf518,0xfd18,0xed58,0xff1d,0xffbf,0xffbf,0xff9f,0xf5d9,0xecf7,
-0xfd18,0xfd18,0xfd18,0xf538,0xed38,0xed38,0xfd18,0xfd18,0xf518,0xed58,0xfedc,0xff9f,0xff9f,0xe5d9,0xed38,0xfd38,
-0xf4f7,0xfd18,0xfd18,0xfcf8,0xfd38,0xfcf8,0xfd18,0xf4f7,0xe537,0xfefd,0xffbf,0xffbf,0xff9f,0xedf9,0xf538,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf02c,0xf06d,0xe00b,0xe02b,0xe04c,0xe04c,0xe04c,0xe04c,0xe04c,0xe04c,
-0xe04c,0xe04c,0xd84b,0xe04b,0xe06c,0xb8aa,0xff1e,0xffbf,0xffbe,0xffdf,0xfffe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xfffe,
-0xffff,0xffff,0xffff,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xf7ff,0xf7ff,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,
-0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,
-0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xf518,
-0xfd38,0xf4f7,0xfcf8,0xf517,0xee3a,0xff7e,0xffbf,0xff9f,0xfedd,0xed78,0xed37,0xf538,0xf518,0xfd18,0xfd18,0xfd18,
-0xfcf8,0xfcf7,0xf4f7,0xed57,0xfebc,0xff9f,0xff9f,0xe5f9,0xed58,0xfd38,0xfcf8,0xfcf8,0xfcf8,0xf518,0xf518,0xfd38,
-0xf538,0xed37,0xf63a,0xff9f,0xffdf,0xffdf,0xfefd,0xe578,0xfd38,0xfcf8,0xfd18,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,
-0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf02c,
-0xe02b,0xd00a,0xd8ed,0xc8ab,0xc0cb,0xc0eb,0xb8eb,0xb8eb,0xb8eb,0xb8eb,0xb8eb,0xb8eb,0xb8cb,0xc0ec,0xc0ec,0xa96c,
-0xff1e,0xffdf,0xffdf,0xffdf,0xffde,0xfffe,0xf7fe,0xf7fe,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xfffe,0xf7ff,0xf7ff,
-0xf7ff,0xffff,0xf7ff,0xffff,0xffdf,0xffdf,0xffff,0xf7ff,0xffdf,0xffdf,0xf7ff,0xf7ff,0xf7ff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd38,0xf4f7,0xfcf8,0xfcf7,0xe598,0xff1d,
-0xffbf,0xff9e,0xff9f,0xee3a,0xe557,0xed38,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf7,0xf517,0xed78,0xfebc,0xffbf,
-0xff9f,0xe619,0xe537,0xf518,0xfcf8,0xfcf8,0xfcf8,0xfd38,0xecf7,0xf558,0xed37,0xed98,0xff3e,0xffbf,0xffbf,0xffbf,
-0xee3a,0xed37,0xfd38,0xfcf8,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe80b,0xe86c,0xe98f,0xfd7d,0xfe3e,0xfe1e,0xfe3d,
-0xfe3d,0xfe5d,0xfe5d,0xfe3d,0xfe3d,0xfe3d,0xfe5e,0xfe1d,0xfe5e,0xfe5d,0xff9f,0xf7df,0xffff,0xf7be,0xffdf,0xfffe,
-0xf7fe,0xf7fe,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xf7fe,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xffff,0xffdf,0xffdf,
-0xf7ff,0xf7ff,0xffdf,0xffff,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xffff,0xffff,0xffff,0xf7ff,0xf7ff,0xf7fe,0xfffe,0xf7de,
-0xf7fe,0xf7ff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfcf8,0xf518,0xed78,0xe619,0xffbf,0xffdf,0xff9e,0xff9e,0xedf9,0xed78,
-0xf518,0xfd18,0xf538,0xf538,0xfcf7,0xf4f7,0xf518,0xed78,0xfedc,0xff9f,0xff7f,0xe5d9,0xf558,0xf518,0xfd18,0xfd18,
-0xf517,0xf517,0xf538,0xf537,0xed98,0xfe9c,0xff9f,0xffbf,0xffbf,0xf6bc,0xed78,0xf518,0xfcf8,0xfcf8,0xf518,0xf538,
-0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf00b,0xf02c,0xe86c,0xe1cf,0xfeff,0xff7f,0xff7f,0xff7f,0xff9f,0xff9f,0xff7f,0xff7f,0xff7f,0xff7f,
-0xff7f,0xff7f,0xff7f,0xff9f,0xffdf,0xf7df,0xf7de,0xf7de,0xffde,0xf7de,0xf7fe,0xf7fe,0xffde,0xffde,0xffde,0xffde,
-0xf7de,0xf7de,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7de,0xf7de,0xffde,0xffde,0xf7de,0xf7de,0xf7de,0xf7de,0xf7fe,0xf7fe,
-0xf7ff,0xf7ff,0xf7de,0xf7de,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xffde,0xffde,0xffff,0xf7ff,0xf7df,0xff7f,0xfc37,0xd06b,
-0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,
-0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xfcf8,
-0xfcf8,0xf518,0xed37,0xdd78,0xeebb,0xffbf,0xffbf,0xffbf,0xff5e,0xedb9,0xed38,0xf538,0xf538,0xed17,0xfd18,0xfd59,
-0xfd38,0xe517,0xf69c,0xff9f,0xff9f,0xe5d9,0xed58,0xf4f7,0xfcf7,0xfd18,0xfd17,0xfd58,0xed17,0xe537,0xfe9b,0xff9f,
-0xffbf,0xff9f,0xff1d,0xf61a,0xed38,0xf4f8,0xfcf8,0xfcf8,0xf518,0xf538,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,
-0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80d,0xf80c,0xf00c,0xe00b,0xd9ce,
-0xff1e,0xf7df,0xffff,0xffff,0xf7fe,0xf7fe,0xfffe,0xfffe,0xffde,0xffde,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7ff,0xf7ff,0xffff,0xffff,0xf7fe,0xf7fe,
-0xf7fe,0xf7fe,0xffde,0xffbe,0xf7de,0xf7ff,0xf7ff,0xff7f,0xfc37,0xd06b,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xf4f7,0xf579,0xe558,0xfefd,
-0xff7e,0xff7e,0xffbf,0xff5e,0xf5d9,0xed78,0xed38,0xf518,0xfd18,0xfcf8,0xfcf7,0xed38,0xfedc,0xffbf,0xff9f,0xddd8,
-0xed58,0xf518,0xfcf8,0xfd18,0xfd17,0xed17,0xedd9,0xf6fc,0xffbe,0xffdf,0xffbf,0xff7f,0xf5fa,0xf558,0xf517,0xfcf8,
-0xfd18,0xfd18,0xfd18,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xf518,0xf518,0xf518,0xf518,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf00b,0xf80c,0xf80c,0xf00c,0xe02b,0xe20f,0xff3f,0xffdf,0xffde,0xf7de,0xf7de,0xf7fe,
-0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7de,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,
-0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,
-0xffde,0xffde,0xffde,0xffde,0xffdf,0xffdf,0xffde,0xffde,0xf7de,0xf7de,0xf7fe,0xffde,0xffde,0xffde,0xf7ff,0xf7ff,
-0xf7ff,0xff5f,0xfc16,0xd86b,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
-0xf518,0xf518,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd38,0xf4f7,0xf517,0xf599,0xff3e,0xff7e,0xffbf,0xffbf,0xff9f,0xfe7b,
-0xe578,0xe537,0xf518,0xfcf8,0xfcf8,0xf558,0xf67b,0xff9f,0xff9f,0xddf9,0xed98,0xf558,0xf4f7,0xf4f7,0xf537,0xf61a,
-0xff3d,0xffdf,0xf7ff,0xf7ff,0xff7e,0xf67b,0xed58,0xf517,0xf518,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfd18,0xf518,
-0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf00b,0xe02b,0xd9ee,0xff1f,0xffbe,0xffdf,0xffff,0xffdf,0xfffe,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xffff,
-0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,
-0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffdf,0xffdf,0xffdf,
-0xffdf,0xffff,0xffff,0xfffe,0xffde,0xffde,0xffbe,0xffde,0xf7df,0xf7ff,0xf7ff,0xff7f,0xfc37,0xd8ac,0xe82c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf538,0xf538,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfcf7,0xfcf7,0xfd58,0xed78,0xff3e,0xffbf,0xffdf,0xffbf,0xffbf,0xff7e,0xf69b,0xedb9,0xed38,0xed38,0xed58,
-0xfedd,0xff9f,0xff9f,0xe5f9,0xdd57,0xe537,0xe558,0xedb9,0xfebc,0xff7e,0xffdf,0xf7df,0xffdf,0xff9e,0xee5b,0xe578,
-0xf538,0xf517,0xfd18,0xf538,0xf518,0xf518,0xfd18,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,
-0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00b,0xd84b,0xd1ee,0xff3f,0xffbf,
-0xffdf,0xf7df,0xffdf,0xffde,0xf7ff,0xf7ff,0xf7ff,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,
-0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,
-0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xffdf,0xffdf,0xf7df,0xf7fe,0xf7fe,0xf7de,0xffde,0xffde,
-0xffdf,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xff7f,0xfc56,0xc88b,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,
-0xf518,0xf518,0xf538,0xf538,0xf518,0xf518,0xfd18,0xf518,0xf518,0xf518,0xfcf8,0xfd18,0xfd18,0xf4d7,0xed17,0xe578,
-0xf6fc,0xffdf,0xffdf,0xffdf,0xffdf,0xff9f,0xff5e,0xfedd,0xfe5b,0xedf9,0xfefd,0xff7f,0xff5e,0xee7b,0xee3a,0xfe9c,
-0xff1e,0xff9f,0xffbf,0xffbf,0xffdf,0xffbf,0xff5e,0xee3a,0xe558,0xed38,0xf518,0xf517,0xfd18,0xf538,0xf518,0xf518,
-0xfd18,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,
-0xf518,0xf518,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,
-0xf80c,0xf80c,0xf00b,0xf00b,0xf80c,0xf02c,0xe06c,0xe1cf,0xfebf,0xff3f,0xff7f,0xff7f,0xff5f,0xff5f,0xff7f,0xff7f,
-0xff5f,0xff5f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,
-0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,
-0xff7f,0xff5f,0xff5f,0xff5f,0xff7f,0xff7f,0xff7f,0xff5f,0xff5f,0xff5f,0xff7f,0xff7f,0xff5f,0xff5f,0xff7f,0xfedf,
-0xfbf6,0xd8ac,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf538,0xf538,0xfd18,0xfcf8,
-0xfd18,0xfd18,0xf518,0xf538,0xf518,0xfd38,0xf4b7,0xfd18,0xfd59,0xed58,0xdd78,0xee7b,0xff7e,0xff7e,0xffbf,0xffdf,
-0xffdf,0xffbf,0xffbf,0xffdf,0xffdf,0xffdf,0xffdf,0xffbf,0xff9f,0xffbf,0xffbf,0xffdf,0xffdf,0xff9f,0xff7f,0xfedd,
-0xf599,0xf538,0xf538,0xf4f7,0xfd18,0xf518,0xf518,0xf538,0xf518,0xf518,0xf538,0xf518,0xf518,0xfd18,0xfd18,0xfd18,
-0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,
-0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80b,
-0xf00c,0xe8ed,0xfb55,0xfbd5,0xfbb5,0xfbb4,0xfb95,0xfb95,0xfb95,0xfb95,0xfb95,0xfb95,0xfb95,0xfbb4,0xfbb4,0xfbb4,
-0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,
-0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfb94,0xfb95,0xfb95,0xfbb5,0xfbb4,
-0xfb94,0xfb94,0xfb94,0xfb94,0xfbb4,0xfbb4,0xfb94,0xfbb5,0xfbb5,0xfb75,0xf9d1,0xf02c,0xf00c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xf518,0xf538,0xf538,0xf4f7,
-0xfd38,0xfcf7,0xf4d7,0xf538,0xed58,0xe578,0xed99,0xfe9b,0xff7e,0xff9f,0xffbe,0xffdf,0xffdf,0xf7de,0xf7ff,0xf7de,
-0xffdf,0xffdf,0xffbf,0xffbf,0xffdf,0xffdf,0xffbf,0xff1d,0xf5fa,0xed38,0xfd18,0xfcf8,0xfcf7,0xfd18,0xfd38,0xf518,
-0xf518,0xfd38,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,
-0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80b,0xf80c,0xf02c,0xd84b,0xd06b,0xd08b,0xd88b,
-0xd86c,0xd86c,0xd88c,0xd88c,0xd86c,0xe06c,0xd86b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,
-0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,
-0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd86b,0xd86c,0xd86c,0xd86b,0xd88b,0xd86b,0xd86b,0xd86b,0xd86b,0xd08b,0xd88b,
-0xd86b,0xd88c,0xd04b,0xe06c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd38,0xfd18,0xf518,0xf538,0xfd38,0xf538,0xf538,
-0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfcf8,0xfd18,0xfd18,0xf518,
-0xf517,0xed37,0xed98,0xf63a,0xfefd,0xff7f,0xff9f,0xff9f,0xffbf,0xffbf,0xffbf,0xff9f,0xff9f,0xff5e,0xff1d,0xfebc,
-0xedb9,0xed78,0xf538,0xf518,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,
-0xf518,0xf538,0xf518,0xf518,0xf518,0xf538,0xecf7,0xf538,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf02c,0xe82c,0xe82c,0xe82c,0xe82c,0xe04c,0xe04c,0xe82c,0xf00c,
-0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,
-0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,
-0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82b,0xf00c,0xf00c,0xe82c,0xe80c,0xf00c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,
-0xfd18,0xfd18,0xf4f7,0xfd18,0xf518,0xf4f7,0xf518,0xfd18,0xf518,0xf518,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,
-0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd38,0xf538,0xf538,0xed58,0xed58,0xed98,
-0xedd9,0xee1a,0xf67b,0xee7b,0xf65b,0xf63a,0xf5fa,0xedb9,0xed78,0xe537,0xf558,0xf538,0xf517,0xfcf7,0xfcf8,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,0xf4f7,0xf538,0xf538,0xfd38,0xf518,0xf538,
-0xf4f7,0xf538,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,
-0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80d,0xf80d,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xe82c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf00c,0xf82c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd38,0xfd38,0xfd18,0xf4f8,
-0xf518,0xfd18,0xf518,0xfd18,0xfcf8,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
-0xfd18,0xfd18,0xfcf8,0xfd18,0xf517,0xf538,0xf538,0xf517,0xf4f7,0xf4f7,0xf538,0xfd58,0xed38,0xed58,0xf558,0xf538,
-0xf538,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xf538,0xf538,0xf518,0xf518,0xf518,0xf518,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd38,0xfd38,0xf4f7,0xf518,0xf518,0xfd58,0xfd38,0xfd38,0xf518,0xf518,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf80d,0xf80d,0xf00d,0xf00c,0xf00c,0xf00c,0xf80c,0xf80d,0xf80c,0xf80c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00b,0xf80c,0xf80d,0xf80d,
-0xf80c,0xf00c,0xe80c,0xe80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf518,0xf518,
-0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf4f7,0xf518,0xfd18,0xfd18,0xfd38,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
-0xf518,0xf518,0xf518,0xf518,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfd18,0xf4f8,0xf518,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf7,0xfcf8,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xf518,0xf518,
-0xf518,0xf518,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcd7,0xfcf8,
-0xfd18,0xfd38,0xfd18,0xf4f7,0xf518,0xf4f7,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,
-0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,
-0xf00d,0xf02d,0xf00d,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,
-0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,
-0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf00c,0xf00c,
-0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf82c,0xf80c,0xf80c,0xf00b,0xf00c,0xf02c,0xf02d,0xf02c,0xf00c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,
-0xfd38,0xfd18,0xfcf7,0xfcf7,0xfcf8,0xfcf8,0xfcd8,0xfd18,0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,
-0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf7,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xf538,0xf538,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcd8,0xfcd8,0xfcf8,0xfcf8,0xfcf8,0xfd39,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,
-0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xe80b,0xf00c,0xf00c,0xf00c,0xf82d,0xf00b,
-0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,
-0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,
-0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,0xe82c,0xe82c,0xf80c,0xf80c,0xe82c,0xe82c,0xe82c,0xe82c,
-0xe80b,0xf02c,0xf00c,0xf00c,0xe82c,0xe82c,0xf00c,0xe80b,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfcf8,0xfd18,0xfcf8,0xfcb7,
-0xf476,0xfc76,0xfc76,0xfc76,0xfc76,0xfc96,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xf497,0xfc77,
-0xfc77,0xfc77,0xfc76,0xfc76,0xfc76,0xfc76,0xfc76,0xfc96,0xfc97,0xfcb7,0xf496,0xf476,0xf476,0xf496,0xfc97,0xfc97,
-0xfc97,0xfc97,0xf496,0xf496,0xf496,0xfc76,0xfc76,0xfc76,0xfc76,0xfc76,0xfc76,0xfc96,0xf496,0xf496,0xf496,0xfc96,
-0xfc96,0xfc76,0xfc76,0xfc76,0xfc76,0xfc97,0xfc76,0xf476,0xfcf8,0xfcd7,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,
-0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,
-0xf80c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00b,0xf00b,0xf8ae,0xf08d,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,
-0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,
-0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,
-0xf0ad,0xe8cd,0xe8cd,0xf0ad,0xf88d,0xf88d,0xf0ad,0xe8cd,0xf0ad,0xf0cd,0xe8ad,0xf0ad,0xf0ad,0xe8ad,0xe8cd,0xf0cd,
-0xf86d,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfcf8,0xfd18,0xfd18,0xfd18,
-0xf518,0xf518,0xf518,0xf518,0xf4f7,0xfcf8,0xfd18,0xfcf8,0xfc97,0xdb93,0xc2b0,0xba4e,0xc26f,0xca4f,0xca4f,0xca4f,
-0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xc26f,0xc26f,0xc26f,0xc26f,0xca4f,0xca4f,0xca4f,0xc24f,0xca4f,0xca6f,0xca4f,
-0xca4f,0xca2f,0xc22f,0xc22f,0xca4f,0xca4f,0xca4f,0xc26f,0xc26f,0xca4f,0xca2f,0xca2f,0xca4f,0xca4f,0xca4f,0xca4f,
-0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xc26f,0xc26f,0xc26f,0xca4f,0xca4f,0xca4f,0xca4f,0xca6f,0xca6f,0xc26f,
-0xba4e,0xc2af,0xf476,0xfd39,0xfcf8,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfd18,0xf518,0xfd18,0xfd18,
-0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80b,0xf80c,0xf80b,0xf00c,
-0xf02c,0xf92f,0xfb16,0xfbb7,0xfb97,0xfb97,0xfb97,0xfb96,0xfb76,0xfb76,0xfb96,0xfb96,0xfb97,0xfb97,0xfb77,0xfb97,
-0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,
-0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,0xfb97,0xfb76,0xfb57,0xfb76,
-0xfb97,0xfb96,0xfb97,0xfb76,0xfb97,0xfb76,0xfb76,0xfb97,0xfbb7,0xfb15,0xf990,0xf82c,0xf00c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,
-0xfcf8,0xfd18,0xfd18,0xfcb7,0xfc97,0xfcb7,0xfc97,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc97,
-0xfc97,0xfc97,0xfc77,0xfc77,0xfc77,0xfc77,0xfc98,0xfc97,0xfc77,0xfc77,0xfc77,0xfc78,0xfc78,0xfc77,0xfc77,0xfc77,
-0xfc77,0xfc98,0xfc97,0xfc97,0xfc78,0xfc78,0xfc77,0xfc77,0xfc78,0xfc78,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,
-0xfc97,0xfc97,0xfc97,0xfc77,0xfc77,0xfc77,0xfc97,0xfc77,0xfc97,0xfcb7,0xfcb7,0xfc97,0xfd39,0xfcb7,0xfcf8,0xfd18,
-0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80b,0xf82c,0xe80b,0xe02b,0xe0ed,0xd0ac,0xd0cc,0xd0ec,
-0xd0ec,0xd0cc,0xd8cc,0xd8cc,0xd0cc,0xd0ec,0xd0cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,
-0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,
-0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xe0ac,0xd8ac,0xd8cc,0xd0cc,0xd8cc,0xd8cc,0xd8cc,0xd8ed,
-0xd0ed,0xd0cc,0xd0cc,0xe0ad,0xf06c,0xf00b,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,
-0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
-0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
-0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
-0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,
-0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,
-0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,
-0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,
-0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xf00c,0xf00c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,
-0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c};
- 
+#ifndef SELECTOR_DRIVE_H
+#define SELECTOR_DRIVE_H
+ 
+const uint16_t selector_drive[] PROGMEM = {0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfcf8,0xfcf8,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xf4f7,0xfd18,0xfd18,0xfd18,0xfcf8,0xf518,0xed38,0xed38,
+0xf518,0xfd18,0xfd18,0xfd18,0xf518,0xf517,0xf517,0xf517,0xf518,0xf538,0xfd38,0xfd18,0xfd18,0xfd18,0xfd18,0xf517,
+0xf538,0xed58,0xf538,0xf518,0xfd18,0xfd18,0xfcf8,0xfcf8,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xf517,0xf537,
+0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf00c,0xe82c,0xe82c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xf518,0xf518,0xf518,0xf518,
+0xfd18,0xfd18,0xfd38,0xfd18,0xfcf7,0xfcf8,0xfd18,0xf518,0xf538,0xf538,0xfd38,0xfd18,0xf517,0xf518,0xfd38,0xfd38,
+0xfd38,0xfd18,0xf518,0xfd18,0xf518,0xf4f7,0xf4f7,0xf518,0xfd18,0xfd18,0xecf7,0xf518,0xf538,0xf518,0xfcf8,0xfcf8,
+0xfcf8,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,
+0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf538,0xf538,0xf518,0xfd18,0xfd18,0xfcf8,0xf4f7,0xf518,
+0xf538,0xf518,0xfcf8,0xfcf8,0xf4f7,0xf518,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf7,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd59,0xfcf7,0xf4d7,0xfcf8,0xfd38,0xfd18,0xf4f8,0xfcf8,0xfcf8,0xfd18,0xf518,0xf518,
+0xf518,0xf518,0xfd18,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xf518,0xf538,0xf538,0xf518,0xfd18,0xfcd7,0xfcf8,0xfd18,0xf538,0xf518,0xf518,0xfcf8,0xfcf8,0xf518,0xf538,
+0xf538,0xf538,0xf538,0xf558,0xed58,0xed58,0xf579,0xf578,0xed58,0xed37,0xed37,0xed37,0xed38,0xf538,0xecf7,0xfd38,
+0xfd38,0xfcf8,0xfcd7,0xfd18,0xfd38,0xf518,0xfcf8,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfcf8,0xfcf8,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,
+0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf538,0xf518,0xf518,
+0xfcf8,0xfd18,0xfd18,0xf518,0xf517,0xfd18,0xfd18,0xfd18,0xfd58,0xf538,0xed37,0xe578,0xedf9,0xf69c,0xff1d,0xff3e,
+0xff7e,0xffbf,0xffbf,0xff9f,0xff5e,0xfefd,0xee7b,0xe5f9,0xe577,0xed37,0xf4f7,0xfd18,0xfd18,0xfcf7,0xf518,0xfd58,
+0xf518,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,
+0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf538,
+0xf518,0xecf7,0xe517,0xedb9,0xfe9c,0xff3e,0xff9f,0xffbf,0xffdf,0xffdf,0xf7ff,0xf7ff,0xf7df,0xf7df,0xffdf,0xffdf,
+0xffbf,0xff9f,0xff1d,0xf61a,0xed57,0xf538,0xfd38,0xf517,0xed17,0xf538,0xf538,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfd18,
+0xfd18,0xfd18,0xf518,0xf518,0xf538,0xf518,0xfd18,0xfd38,0xf538,0xf538,0xed58,0xedb9,0xfedc,0xff7e,0xffbf,0xffbf,
+0xffbf,0xff9e,0xffbf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffbf,0xffbf,0xff3d,0xf61a,
+0xed58,0xed58,0xf558,0xed37,0xf538,0xf538,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,
+0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,
+0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfcf8,0xfcf8,0xfd18,0xf518,0xf538,0xed18,
+0xf538,0xf538,0xed17,0xe537,0xf63a,0xff3e,0xffbf,0xffdf,0xffbf,0xffbf,0xffbf,0xff9f,0xff7e,0xff1d,0xf6bb,0xf6bc,
+0xf6dc,0xfefc,0xff3d,0xff7e,0xff9f,0xffbf,0xffdf,0xffbe,0xffbf,0xff9f,0xfebc,0xed98,0xe537,0xf558,0xed38,0xf538,
+0xfd18,0xfcf8,0xfcf8,0xfcf8,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xe04c,0xe06c,0xd86c,0xd86c,0xe06c,0xe06c,0xd86c,0xd86c,0xd86c,0xd86c,
+0xd86c,0xd88c,0xd86c,0xe04c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfd18,0xfd18,0xf538,0xf538,0xf538,0xed38,0xed58,0xfe5b,0xff9f,0xffbf,
+0xffdf,0xffdf,0xffbf,0xff5e,0xf69b,0xedb9,0xe558,0xed58,0xf538,0xf538,0xed38,0xed37,0xed58,0xed99,0xf63a,0xfe9c,
+0xff9f,0xffbf,0xffdf,0xf7be,0xffbf,0xff3e,0xedb9,0xed58,0xed17,0xfd58,0xf4f7,0xfd18,0xfcf8,0xfd18,0xfd38,0xf518,
+0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe82c,
+0xd94e,0xe291,0xd24f,0xd291,0xd24f,0xd270,0xd290,0xd270,0xd270,0xd270,0xd290,0xd290,0xca50,0xe251,0xf14f,0xe02c,
+0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xf518,0xf538,0xed58,0xe558,0xf67b,0xff9f,0xffbf,0xffdf,0xffbf,0xff5e,0xf69b,0xe5d9,0xe578,0xed58,
+0xf538,0xfcf7,0xfcf7,0xfcf8,0xfd18,0xfd18,0xf538,0xf538,0xf558,0xed78,0xedd9,0xfefc,0xff9e,0xffdf,0xffdf,0xffbf,
+0xff1e,0xedb9,0xf538,0xf4f7,0xfd18,0xfd18,0xfcf8,0xf518,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,
+0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe06c,0xfc98,0xfe9e,0xfeff,0xff1f,0xff1f,0xff1f,
+0xff1f,0xff1f,0xff1f,0xff1f,0xfeff,0xff1f,0xfeff,0xfebf,0xfbd7,0xd86b,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xf538,0xe558,0xf69b,
+0xff9f,0xffbf,0xffbf,0xff9f,0xfedd,0xf5d9,0xe537,0xed58,0xf558,0xecf7,0xf4f7,0xfd58,0xfd18,0xfd18,0xfd18,0xfd18,
+0xf518,0xf518,0xf517,0xecf7,0xf558,0xed57,0xee1a,0xff9f,0xffdf,0xff9e,0xffbf,0xff3e,0xfdd9,0xecf7,0xfd18,0xfcf7,
+0xfd18,0xf518,0xf518,0xf538,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xd88c,0xfc77,0xff3f,0xff7f,0xff9f,0xff9e,0xff9f,0xff9f,0xff9f,0xff9f,0xff9f,0xffbf,0xff9f,
+0xff7f,0xff1f,0xfc16,0xc86b,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,
+0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xed37,0xedfa,0xff9f,0xffbf,0xff9e,0xff9f,0xfebc,0xed78,0xf538,
+0xf517,0xf518,0xf538,0xfd38,0xfd18,0xf518,0xfd38,0xfd18,0xf517,0xf4f7,0xf518,0xfd18,0xfd38,0xfd18,0xfd38,0xecf7,
+0xed58,0xf5fa,0xff3d,0xffbf,0xffdf,0xffbf,0xfebc,0xf578,0xfd18,0xfcf8,0xfd18,0xfd18,0xf518,0xf538,0xf518,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,
+0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xd08c,0xfcd7,0xff9f,
+0xffbf,0xf7de,0xf7de,0xffff,0xf7de,0xffff,0xffde,0xffdf,0xf7df,0xffff,0xffbf,0xff3f,0xfc57,0xd8ec,0xe82c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,
+0xf538,0xed78,0xff3e,0xffbf,0xffbe,0xffbf,0xfe9b,0xed78,0xed17,0xfd18,0xfd38,0xf518,0xf4f8,0xfd18,0xfd18,0xf4f7,
+0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,0xfd18,0xecf7,0xf61a,0xff7e,0xffdf,0xffbe,
+0xff9f,0xfe7b,0xf537,0xfd18,0xfcf8,0xfd18,0xfd38,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,
+0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xd08c,0xf4b7,0xff9f,0xffdf,0xffdf,0xffdf,0xfffe,0xf7de,0xf7fe,
+0xf7fe,0xf7ff,0xf7ff,0xf7ff,0xffbf,0xff3f,0xfbf6,0xd08b,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfcf8,0xfcf8,0xf518,0xf518,0xf518,0xf518,0xfd18,0xf518,0xed37,0xfe9c,0xffbf,0xffdf,0xffbe,0xff1d,
+0xed98,0xed17,0xfd38,0xfd18,0xfcf8,0xfd18,0xfd18,0xfcf8,0xf4f8,0xfd18,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,
+0xfcf8,0xfcf8,0xfd18,0xfd18,0xfcf7,0xfd38,0xed58,0xedf9,0xff9e,0xffdf,0xffdf,0xff3d,0xed99,0xf538,0xfcf7,0xfd18,
+0xfd38,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xd08c,0xecb6,0xff7f,0xffbf,0xffdf,0xffde,0xf7de,0xefbd,0xf7fe,0xf7de,0xf7ff,0xf7ff,0xf7ff,0xffbf,0xff3f,
+0xfc36,0xd0ac,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfd18,0xf538,0xf538,
+0xf518,0xfd18,0xfd18,0xf538,0xed99,0xff9f,0xffbf,0xffdf,0xff5e,0xdd98,0xed57,0xfd17,0xf4f7,0xfd38,0xfd38,0xf4f8,
+0xf4f8,0xfd39,0xfd39,0xf4f8,0xfd18,0xfd18,0xf518,0xf4f8,0xf4f8,0xf518,0xfd18,0xfd38,0xed38,0xf538,0xfd18,0xfd18,
+0xf4d6,0xed57,0xfedc,0xffbf,0xffff,0xffdf,0xf69b,0xed78,0xf517,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,
+0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xd08c,0xf4f7,0xff9f,0xffbf,0xffdf,
+0xffbe,0xffde,0xf7fe,0xf7fe,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xffdf,0xff5f,0xfc57,0xc86b,0xe82c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xed38,0xf67b,0xffbf,
+0xffdf,0xffbe,0xf69b,0xe557,0xfd58,0xfcf7,0xfd18,0xf4f8,0xf4f8,0xfd38,0xfd18,0xf4f7,0xf4f8,0xfd38,0xfcf8,0xfcf8,
+0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf538,0xed18,0xf518,0xfcf7,0xfd38,0xf537,0xe5b8,0xff5e,0xf7de,0xffdf,
+0xff7e,0xe5b8,0xf538,0xfd18,0xf4f7,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe82c,0xe06c,0xd08c,0xd08c,0xd08c,0xd08c,0xd0ac,0xd0ac,0xd0ac,
+0xd08c,0xd08c,0xd08c,0xd08c,0xd08c,0xb10b,0xe517,0xffbf,0xffdf,0xffdf,0xffbe,0xffde,0xf7fe,0xeffe,0xf7fe,0xf7ff,
+0xf7fe,0xf7ff,0xffdf,0xff3f,0xfc36,0xd0ac,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,
+0xf4f8,0xfd38,0xfd18,0xfd18,0xfd18,0xfd38,0xecf7,0xed78,0xff9e,0xffdf,0xffdf,0xff7e,0xe598,0xed38,0xf538,0xf518,
+0xf518,0xfd39,0xf4d7,0xfcf8,0xfd38,0xf518,0xfd38,0xf518,0xfd18,0xfd18,0xfd18,0xf4f8,0xf518,0xfd18,0xfcf8,0xfd18,
+0xfd18,0xf517,0xf538,0xf538,0xf517,0xf517,0xed98,0xee3a,0xffbf,0xffbf,0xff9f,0xf65a,0xe537,0xed17,0xf538,0xfd38,
+0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xd84b,0xfc57,0xfd7b,0xfdbb,0xfddb,0xfdda,0xfe1b,0xfdfa,0xfdfa,0xfdfa,0xfdda,0xfddb,0xfddb,0xfddb,0xfe1b,
+0xff5e,0xffbe,0xffdf,0xffdf,0xffdf,0xffdf,0xf7ff,0xf7ff,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,
+0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd38,0xfcf8,0xfcf8,0xfd18,0xf538,
+0xed17,0xedd9,0xffbf,0xf7df,0xffdf,0xff9f,0xf61a,0xed78,0xe558,0xed58,0xed38,0xf538,0xfd18,0xf518,0xf4f8,0xf518,
+0xfd58,0xf517,0xf518,0xf4f7,0xf518,0xfd58,0xfd59,0xf538,0xf4f8,0xfd18,0xfd18,0xf538,0xe558,0xe558,0xe557,0xed78,
+0xf63a,0xfefc,0xff9e,0xffbe,0xffbf,0xff1d,0xed78,0xf538,0xf518,0xf4f7,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,
+0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf02c,0xf00c,0xf80b,0xf80c,0xf80c,0xf80c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00b,0xd8cc,0xfd9b,0xff7f,0xff9f,0xff9f,
+0xffbe,0xffbe,0xffde,0xffde,0xffbf,0xffbf,0xff9f,0xffbf,0xffbf,0xffbf,0xf7be,0xffff,0xffff,0xffff,0xf7df,0xf7df,
+0xffff,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfcf8,0xfd18,0xfd18,0xf538,0xf558,0xfe5b,0xffbf,0xf7ff,0xffdf,0xffbf,
+0xff9f,0xff9f,0xff5e,0xee9b,0xee1a,0xe558,0xe538,0xf558,0xf518,0xf4f7,0xf517,0xf538,0xed38,0xf558,0xf558,0xed37,
+0xe4f7,0xecf7,0xf518,0xf518,0xed38,0xe578,0xe5d9,0xee7b,0xff1d,0xff7e,0xffbf,0xffdf,0xf7ff,0xf7ff,0xffdf,0xff9f,
+0xed58,0xfd18,0xfcf8,0xfcd7,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,
+0xe82c,0xe82c,0xf00c,0xf00c,0xf00b,0xd0ac,0xfdba,0xff7f,0xff9f,0xffbf,0xffbf,0xffdf,0xffde,0xffde,0xffbe,0xffbe,
+0xffbf,0xffbf,0xffbf,0xffdf,0xffdf,0xffff,0xffff,0xffff,0xf7df,0xffff,0xffff,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,
+0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,
+0xfcf8,0xfd18,0xf518,0xf538,0xed58,0xfedd,0xffdf,0xf7ff,0xffbf,0xff9f,0xff9f,0xff9f,0xffbf,0xffbf,0xff9f,0xff1e,
+0xfedc,0xedf9,0xe578,0xed78,0xed58,0xed98,0xfefd,0xff3e,0xff1e,0xfe5b,0xe578,0xed58,0xf5b9,0xf5b9,0xfe9c,0xff1e,
+0xff9f,0xffbf,0xffbf,0xffbf,0xffbf,0xffdf,0xefbe,0xf7ff,0xffdf,0xff9f,0xed78,0xfd18,0xfcf8,0xfcf8,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,
+0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf00c,0xf80d,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xe82c,0xe82c,0xe80c,0xf00c,0xf02c,0xd0ab,
+0xfdba,0xffbf,0xffdf,0xffdf,0xffdf,0xffbe,0xffde,0xfffe,0xffdf,0xffdf,0xffbf,0xffbf,0xffdf,0xffff,0xffff,0xffff,
+0xffff,0xf7df,0xffff,0xffff,0xffff,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xf518,0xfd18,0xf538,0xed37,0xed78,0xff3e,
+0xffdf,0xffdf,0xf71d,0xddf9,0xfe9c,0xff3e,0xff9f,0xff9f,0xffbf,0xffbf,0xffbf,0xffbf,0xff7e,0xf6dc,0xee9b,0xff9e,
+0xffbe,0xffde,0xffdf,0xffbf,0xff1d,0xf6dc,0xff5e,0xff9f,0xff9f,0xff9f,0xffbf,0xff9f,0xff9f,0xff3e,0xfe9b,0xee19,
+0xde7a,0xffbe,0xffdf,0xffbf,0xf5fa,0xf558,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,
+0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xe80b,0xf00c,0xf80c,0xf80d,0xf00c,0xe80c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00b,0xc8cb,0xfdda,0xffbf,0xffbf,0xffdf,0xffbf,0xffbe,
+0xffde,0xffde,0xffde,0xffde,0xffbf,0xffbf,0xffdf,0xf7df,0xffff,0xf7de,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,0xf538,0xf538,0xed37,0xe558,0xff5f,0xffbf,0xffbf,0xfebc,0xe578,0xe558,0xdd37,
+0xddb8,0xee7b,0xff1d,0xff9f,0xffbe,0xff7e,0xffbf,0xffbf,0xffbe,0xffde,0xf7fe,0xf7fe,0xf7ff,0xffff,0xffbe,0xff9e,
+0xffbf,0xffbf,0xff9f,0xff7f,0xfefd,0xf65b,0xe5b8,0xe557,0xed37,0xed78,0xddb8,0xffbf,0xffdf,0xffbe,0xfe5b,0xed58,
+0xf538,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf82d,0xf02d,0xf02c,0xf02c,0xe80c,0xe02c,0xe84c,0xe82c,0xe80c,0xe80c,0xe80c,0xe80c,0xf00c,
+0xf00c,0xf00c,0xe80b,0xc8cb,0xfdda,0xffbf,0xffbf,0xffdf,0xffdf,0xffdf,0xfffe,0xf7fe,0xf7ff,0xffdf,0xffdf,0xffdf,
+0xffff,0xf7ff,0xf7ff,0xf7de,0xf7df,0xffff,0xffff,0xffff,0xf7de,0xf7de,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,
+0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd38,0xf518,
+0xf518,0xed38,0xe558,0xff7f,0xff9e,0xffbf,0xfe7c,0xed17,0xf518,0xfd58,0xf558,0xed58,0xe537,0xed78,0xf5fa,0xfedd,
+0xff7e,0xff9e,0xffbe,0xffbe,0xf7fe,0xf7fe,0xf7ff,0xffde,0xffbf,0xff9f,0xff5e,0xfefd,0xf61a,0xf5b9,0xed58,0xed38,
+0xed37,0xf538,0xf517,0xed37,0xddd8,0xffbf,0xf7ff,0xffbe,0xfe5b,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,
+0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00b,0xf80c,0xf00c,0xe00b,
+0xe88d,0xd84b,0xd06b,0xd88c,0xe06c,0xe04c,0xe04c,0xe04c,0xe04c,0xe04c,0xe04c,0xe06c,0xe04b,0xc90c,0xfdba,0xff7f,
+0xffbf,0xffdf,0xf7de,0xf7fe,0xeffe,0xeffe,0xeffe,0xf7fe,0xffdf,0xffdf,0xf7df,0xf7ff,0xf7ff,0xffff,0xffff,0xffff,
+0xffff,0xf7df,0xf7de,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xf538,0xf518,0xf518,0xf538,0xe558,0xff7f,0xffbf,0xff9f,
+0xfe7c,0xf538,0xfcf7,0xfcf8,0xfcf7,0xf518,0xfd38,0xf537,0xed37,0xed58,0xdd57,0xee19,0xff9e,0xffde,0xffdf,0xf7de,
+0xf7de,0xffdf,0xffbf,0xf6bb,0xe598,0xe557,0xed38,0xf517,0xf4f7,0xf518,0xf538,0xfd38,0xfd17,0xf537,0xddb8,0xffbf,
+0xf7de,0xffdf,0xfe5b,0xf538,0xfd18,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xe86c,0xfa92,0xf2f3,0xeaf3,0xeaf2,0xf2d2,0xfad2,
+0xfad2,0xfad2,0xf2d2,0xf2d2,0xf2d2,0xf2d2,0xfaf2,0xdaf1,0xfe7c,0xff9f,0xffdf,0xffdf,0xf7fe,0xf7ff,0xf7ff,0xf7ff,
+0xf7ff,0xf7ff,0xffff,0xffdf,0xf7ff,0xf7ff,0xf7ff,0xf7de,0xffff,0xffff,0xffff,0xf7df,0xf7de,0xffff,0xf7fe,0xf7fe,
+0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xf518,0xf518,0xf538,0xf518,0xf517,0xed58,0xff3e,0xffbf,0xffbf,0xfe9c,0xed38,0xfd58,0xf4d7,0xfd38,0xf517,
+0xfd18,0xfd18,0xfd18,0xfd18,0xf538,0xed58,0xf65b,0xff9f,0xffdf,0xf7df,0xffdf,0xffbf,0xff3d,0xe598,0xed78,0xf538,
+0xf518,0xfd18,0xf517,0xf4f7,0xf538,0xf538,0xf517,0xf538,0xe5d9,0xffbf,0xffdf,0xffbf,0xfdfa,0xf538,0xf518,0xf518,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
+0xf82d,0xf80d,0xf00c,0xf00c,0xf00c,0xf82d,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,
+0xf80b,0xf80c,0xf00c,0xd8ac,0xfe3e,0xff3f,0xff3f,0xff5f,0xff5f,0xff3f,0xff5f,0xff5f,0xff5f,0xff5f,0xff5f,0xff5f,
+0xff3f,0xff7f,0xffdf,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffff,0xf7ff,0xf7ff,
+0xf7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,
+0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf538,0xfd18,0xf518,
+0xed58,0xfefd,0xffbf,0xffdf,0xff1e,0xe557,0xf558,0xf517,0xf518,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,0xf517,
+0xf599,0xfe7b,0xffbf,0xffdf,0xffdf,0xf73d,0xf63a,0xe537,0xf518,0xfcf8,0xfd18,0xfd18,0xfcf7,0xfd38,0xf538,0xecf7,
+0xf517,0xed58,0xee3a,0xff9f,0xffbf,0xff9f,0xf5da,0xf538,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,
+0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf82d,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf82c,0xf00b,0xf00b,0xc8ab,0xfede,0xffbf,
+0xffdf,0xf7be,0xffdf,0xffdf,0xffdf,0xffdf,0xffff,0xffff,0xffff,0xffdf,0xffdf,0xffdf,0xf7ff,0xf7ff,0xf7ff,0xf7ff,
+0xf7ff,0xf7ff,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffff,0xf7ff,0xf7ff,0xf7ff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xed58,0xfe9c,0xffbe,0xffdf,0xff9f,0xdd98,
+0xed58,0xf538,0xf4f7,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xf4f7,0xf517,0xed78,0xff3d,0xffbf,0xff9f,0xee3a,
+0xed58,0xed17,0xf518,0xfd18,0xfd18,0xfd18,0xfcf8,0xfd38,0xfd18,0xf517,0xf538,0xed57,0xfebc,0xffbf,0xff9e,0xff9f,
+0xf599,0xf518,0xf538,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf00b,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf00b,0xf82c,0xf82c,0xd0ab,0xfefe,0xffdf,0xf7be,0xffdf,0xffdf,0xffdf,0xffdf,0xffff,
+0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xffff,0xffdf,0xffff,0xf7ff,0xefff,0xf7ff,0xffff,0xf7ff,0xf7ff,
+0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,
+0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,
+0xfd18,0xf4f8,0xfd18,0xf538,0xf538,0xf61a,0xffbf,0xffff,0xffbf,0xe63a,0xe558,0xfd58,0xfcf7,0xfcf8,0xfd18,0xf518,
+0xed38,0xed38,0xfd18,0xfd18,0xf517,0xed38,0xfebc,0xff9f,0xff9f,0xe5d9,0xed17,0xfd18,0xf4f8,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfcd7,0xfd18,0xfd38,0xf537,0xe558,0xff3d,0xffbf,0xffbf,0xff3e,0xed58,0xf518,0xfd38,0xf518,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,
+0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00b,0xf00b,
+0xf00a,0xd0ab,0xfede,0xffff,0xf7be,0xffdf,0xffde,0xffde,0xfffe,0xf7fe,0xf7fe,0xf7fe,0xf7ff,0xf7ff,0xf7ff,0xf7ff,
+0xffdf,0xffdf,0xffdf,0xffdf,0xf7ff,0xefff,0xf7ff,0xffff,0xf7ff,0xf7ff,0xf7ff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfd18,0xfd18,0xf4f8,0xfd18,0xf518,0xf518,0xed99,
+0xff9f,0xffdf,0xffbf,0xfefd,0xe558,0xf517,0xfcf8,0xfcf8,0xfd18,0xf538,0xed38,0xed37,0xf538,0xfd38,0xfd18,0xed58,
+0xfebc,0xff9f,0xff9f,0xe5b9,0xed38,0xfd38,0xf4f7,0xf518,0xfd18,0xfd18,0xfd18,0xfcb7,0xfcf8,0xfd18,0xecf7,0xf5fa,
+0xff9f,0xffbf,0xffbf,0xf69c,0xed38,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,
+0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00b,0xf82c,0xe80b,0xf82c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf82c,0xf00b,0xf82b,0xd0ec,0xfebd,0xffdf,0xffdf,0xffde,
+0xfffe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7ff,0xf7ff,0xf7ff,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xf7ff,0xf7ff,
+0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfcf8,0xfd18,0xfd18,0xf4f8,0xf538,0xf518,0xfd18,0xed58,0xff1d,0xffbf,0xffbf,0xff9f,0xf5d9,0xecf7,
+0xfd18,0xfd18,0xfd18,0xf538,0xed38,0xed38,0xfd18,0xfd18,0xf518,0xed58,0xfedc,0xff9f,0xff9f,0xe5d9,0xed38,0xfd38,
+0xf4f7,0xfd18,0xfd18,0xfcf8,0xfd38,0xfcf8,0xfd18,0xf4f7,0xe537,0xfefd,0xffbf,0xffbf,0xff9f,0xedf9,0xf538,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf02c,0xf06d,0xe00b,0xe02b,0xe04c,0xe04c,0xe04c,0xe04c,0xe04c,0xe04c,
+0xe04c,0xe04c,0xd84b,0xe04b,0xe06c,0xb8aa,0xff1e,0xffbf,0xffbe,0xffdf,0xfffe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xfffe,
+0xffff,0xffff,0xffff,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xf7ff,0xf7ff,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,
+0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,
+0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xf518,
+0xfd38,0xf4f7,0xfcf8,0xf517,0xee3a,0xff7e,0xffbf,0xff9f,0xfedd,0xed78,0xed37,0xf538,0xf518,0xfd18,0xfd18,0xfd18,
+0xfcf8,0xfcf7,0xf4f7,0xed57,0xfebc,0xff9f,0xff9f,0xe5f9,0xed58,0xfd38,0xfcf8,0xfcf8,0xfcf8,0xf518,0xf518,0xfd38,
+0xf538,0xed37,0xf63a,0xff9f,0xffdf,0xffdf,0xfefd,0xe578,0xfd38,0xfcf8,0xfd18,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,
+0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf02c,
+0xe02b,0xd00a,0xd8ed,0xc8ab,0xc0cb,0xc0eb,0xb8eb,0xb8eb,0xb8eb,0xb8eb,0xb8eb,0xb8eb,0xb8cb,0xc0ec,0xc0ec,0xa96c,
+0xff1e,0xffdf,0xffdf,0xffdf,0xffde,0xfffe,0xf7fe,0xf7fe,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xfffe,0xf7ff,0xf7ff,
+0xf7ff,0xffff,0xf7ff,0xffff,0xffdf,0xffdf,0xffff,0xf7ff,0xffdf,0xffdf,0xf7ff,0xf7ff,0xf7ff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd38,0xf4f7,0xfcf8,0xfcf7,0xe598,0xff1d,
+0xffbf,0xff9e,0xff9f,0xee3a,0xe557,0xed38,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf7,0xf517,0xed78,0xfebc,0xffbf,
+0xff9f,0xe619,0xe537,0xf518,0xfcf8,0xfcf8,0xfcf8,0xfd38,0xecf7,0xf558,0xed37,0xed98,0xff3e,0xffbf,0xffbf,0xffbf,
+0xee3a,0xed37,0xfd38,0xfcf8,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe80b,0xe86c,0xe98f,0xfd7d,0xfe3e,0xfe1e,0xfe3d,
+0xfe3d,0xfe5d,0xfe5d,0xfe3d,0xfe3d,0xfe3d,0xfe5e,0xfe1d,0xfe5e,0xfe5d,0xff9f,0xf7df,0xffff,0xf7be,0xffdf,0xfffe,
+0xf7fe,0xf7fe,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xf7fe,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xffff,0xffdf,0xffdf,
+0xf7ff,0xf7ff,0xffdf,0xffff,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xffff,0xffff,0xffff,0xf7ff,0xf7ff,0xf7fe,0xfffe,0xf7de,
+0xf7fe,0xf7ff,0xffdf,0xff5f,0xfc36,0xd08c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfcf8,0xf518,0xed78,0xe619,0xffbf,0xffdf,0xff9e,0xff9e,0xedf9,0xed78,
+0xf518,0xfd18,0xf538,0xf538,0xfcf7,0xf4f7,0xf518,0xed78,0xfedc,0xff9f,0xff7f,0xe5d9,0xf558,0xf518,0xfd18,0xfd18,
+0xf517,0xf517,0xf538,0xf537,0xed98,0xfe9c,0xff9f,0xffbf,0xffbf,0xf6bc,0xed78,0xf518,0xfcf8,0xfcf8,0xf518,0xf538,
+0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf00b,0xf02c,0xe86c,0xe1cf,0xfeff,0xff7f,0xff7f,0xff7f,0xff9f,0xff9f,0xff7f,0xff7f,0xff7f,0xff7f,
+0xff7f,0xff7f,0xff7f,0xff9f,0xffdf,0xf7df,0xf7de,0xf7de,0xffde,0xf7de,0xf7fe,0xf7fe,0xffde,0xffde,0xffde,0xffde,
+0xf7de,0xf7de,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7de,0xf7de,0xffde,0xffde,0xf7de,0xf7de,0xf7de,0xf7de,0xf7fe,0xf7fe,
+0xf7ff,0xf7ff,0xf7de,0xf7de,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xffde,0xffde,0xffff,0xf7ff,0xf7df,0xff7f,0xfc37,0xd06b,
+0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,
+0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xfcf8,
+0xfcf8,0xf518,0xed37,0xdd78,0xeebb,0xffbf,0xffbf,0xffbf,0xff5e,0xedb9,0xed38,0xf538,0xf538,0xed17,0xfd18,0xfd59,
+0xfd38,0xe517,0xf69c,0xff9f,0xff9f,0xe5d9,0xed58,0xf4f7,0xfcf7,0xfd18,0xfd17,0xfd58,0xed17,0xe537,0xfe9b,0xff9f,
+0xffbf,0xff9f,0xff1d,0xf61a,0xed38,0xf4f8,0xfcf8,0xfcf8,0xf518,0xf538,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,
+0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80d,0xf80c,0xf00c,0xe00b,0xd9ce,
+0xff1e,0xf7df,0xffff,0xffff,0xf7fe,0xf7fe,0xfffe,0xfffe,0xffde,0xffde,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7ff,0xf7ff,0xffff,0xffff,0xf7fe,0xf7fe,
+0xf7fe,0xf7fe,0xffde,0xffbe,0xf7de,0xf7ff,0xf7ff,0xff7f,0xfc37,0xd06b,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xf4f7,0xf579,0xe558,0xfefd,
+0xff7e,0xff7e,0xffbf,0xff5e,0xf5d9,0xed78,0xed38,0xf518,0xfd18,0xfcf8,0xfcf7,0xed38,0xfedc,0xffbf,0xff9f,0xddd8,
+0xed58,0xf518,0xfcf8,0xfd18,0xfd17,0xed17,0xedd9,0xf6fc,0xffbe,0xffdf,0xffbf,0xff7f,0xf5fa,0xf558,0xf517,0xfcf8,
+0xfd18,0xfd18,0xfd18,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xf518,0xf518,0xf518,0xf518,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf00b,0xf80c,0xf80c,0xf00c,0xe02b,0xe20f,0xff3f,0xffdf,0xffde,0xf7de,0xf7de,0xf7fe,
+0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7de,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,
+0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,
+0xffde,0xffde,0xffde,0xffde,0xffdf,0xffdf,0xffde,0xffde,0xf7de,0xf7de,0xf7fe,0xffde,0xffde,0xffde,0xf7ff,0xf7ff,
+0xf7ff,0xff5f,0xfc16,0xd86b,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
+0xf518,0xf518,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd38,0xf4f7,0xf517,0xf599,0xff3e,0xff7e,0xffbf,0xffbf,0xff9f,0xfe7b,
+0xe578,0xe537,0xf518,0xfcf8,0xfcf8,0xf558,0xf67b,0xff9f,0xff9f,0xddf9,0xed98,0xf558,0xf4f7,0xf4f7,0xf537,0xf61a,
+0xff3d,0xffdf,0xf7ff,0xf7ff,0xff7e,0xf67b,0xed58,0xf517,0xf518,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfd18,0xf518,
+0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf00b,0xe02b,0xd9ee,0xff1f,0xffbe,0xffdf,0xffff,0xffdf,0xfffe,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xffff,
+0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,
+0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffff,0xffdf,0xffdf,0xffdf,0xffdf,
+0xffdf,0xffff,0xffff,0xfffe,0xffde,0xffde,0xffbe,0xffde,0xf7df,0xf7ff,0xf7ff,0xff7f,0xfc37,0xd8ac,0xe82c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf538,0xf538,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfcf7,0xfcf7,0xfd58,0xed78,0xff3e,0xffbf,0xffdf,0xffbf,0xffbf,0xff7e,0xf69b,0xedb9,0xed38,0xed38,0xed58,
+0xfedd,0xff9f,0xff9f,0xe5f9,0xdd57,0xe537,0xe558,0xedb9,0xfebc,0xff7e,0xffdf,0xf7df,0xffdf,0xff9e,0xee5b,0xe578,
+0xf538,0xf517,0xfd18,0xf538,0xf518,0xf518,0xfd18,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,
+0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00b,0xd84b,0xd1ee,0xff3f,0xffbf,
+0xffdf,0xf7df,0xffdf,0xffde,0xf7ff,0xf7ff,0xf7ff,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,
+0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,
+0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xffdf,0xffdf,0xf7df,0xf7fe,0xf7fe,0xf7de,0xffde,0xffde,
+0xffdf,0xf7ff,0xf7ff,0xf7ff,0xf7ff,0xff7f,0xfc56,0xc88b,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,
+0xf518,0xf518,0xf538,0xf538,0xf518,0xf518,0xfd18,0xf518,0xf518,0xf518,0xfcf8,0xfd18,0xfd18,0xf4d7,0xed17,0xe578,
+0xf6fc,0xffdf,0xffdf,0xffdf,0xffdf,0xff9f,0xff5e,0xfedd,0xfe5b,0xedf9,0xfefd,0xff7f,0xff5e,0xee7b,0xee3a,0xfe9c,
+0xff1e,0xff9f,0xffbf,0xffbf,0xffdf,0xffbf,0xff5e,0xee3a,0xe558,0xed38,0xf518,0xf517,0xfd18,0xf538,0xf518,0xf518,
+0xfd18,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,
+0xf518,0xf518,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,
+0xf80c,0xf80c,0xf00b,0xf00b,0xf80c,0xf02c,0xe06c,0xe1cf,0xfebf,0xff3f,0xff7f,0xff7f,0xff5f,0xff5f,0xff7f,0xff7f,
+0xff5f,0xff5f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,
+0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,0xff7f,
+0xff7f,0xff5f,0xff5f,0xff5f,0xff7f,0xff7f,0xff7f,0xff5f,0xff5f,0xff5f,0xff7f,0xff7f,0xff5f,0xff5f,0xff7f,0xfedf,
+0xfbf6,0xd8ac,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf538,0xf538,0xfd18,0xfcf8,
+0xfd18,0xfd18,0xf518,0xf538,0xf518,0xfd38,0xf4b7,0xfd18,0xfd59,0xed58,0xdd78,0xee7b,0xff7e,0xff7e,0xffbf,0xffdf,
+0xffdf,0xffbf,0xffbf,0xffdf,0xffdf,0xffdf,0xffdf,0xffbf,0xff9f,0xffbf,0xffbf,0xffdf,0xffdf,0xff9f,0xff7f,0xfedd,
+0xf599,0xf538,0xf538,0xf4f7,0xfd18,0xf518,0xf518,0xf538,0xf518,0xf518,0xf538,0xf518,0xf518,0xfd18,0xfd18,0xfd18,
+0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,
+0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80b,
+0xf00c,0xe8ed,0xfb55,0xfbd5,0xfbb5,0xfbb4,0xfb95,0xfb95,0xfb95,0xfb95,0xfb95,0xfb95,0xfb95,0xfbb4,0xfbb4,0xfbb4,
+0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,
+0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfbb4,0xfb94,0xfb95,0xfb95,0xfbb5,0xfbb4,
+0xfb94,0xfb94,0xfb94,0xfb94,0xfbb4,0xfbb4,0xfb94,0xfbb5,0xfbb5,0xfb75,0xf9d1,0xf02c,0xf00c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xf518,0xf538,0xf538,0xf4f7,
+0xfd38,0xfcf7,0xf4d7,0xf538,0xed58,0xe578,0xed99,0xfe9b,0xff7e,0xff9f,0xffbe,0xffdf,0xffdf,0xf7de,0xf7ff,0xf7de,
+0xffdf,0xffdf,0xffbf,0xffbf,0xffdf,0xffdf,0xffbf,0xff1d,0xf5fa,0xed38,0xfd18,0xfcf8,0xfcf7,0xfd18,0xfd38,0xf518,
+0xf518,0xfd38,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,
+0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80b,0xf80c,0xf02c,0xd84b,0xd06b,0xd08b,0xd88b,
+0xd86c,0xd86c,0xd88c,0xd88c,0xd86c,0xe06c,0xd86b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,
+0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,
+0xd88b,0xd88b,0xd88b,0xd88b,0xd88b,0xd86b,0xd86c,0xd86c,0xd86b,0xd88b,0xd86b,0xd86b,0xd86b,0xd86b,0xd08b,0xd88b,
+0xd86b,0xd88c,0xd04b,0xe06c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd38,0xfd18,0xf518,0xf538,0xfd38,0xf538,0xf538,
+0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfcf8,0xfd18,0xfd18,0xf518,
+0xf517,0xed37,0xed98,0xf63a,0xfefd,0xff7f,0xff9f,0xff9f,0xffbf,0xffbf,0xffbf,0xff9f,0xff9f,0xff5e,0xff1d,0xfebc,
+0xedb9,0xed78,0xf538,0xf518,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,
+0xf518,0xf538,0xf518,0xf518,0xf518,0xf538,0xecf7,0xf538,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf02c,0xe82c,0xe82c,0xe82c,0xe82c,0xe04c,0xe04c,0xe82c,0xf00c,
+0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,
+0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,
+0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82b,0xf00c,0xf00c,0xe82c,0xe80c,0xf00c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,
+0xfd18,0xfd18,0xf4f7,0xfd18,0xf518,0xf4f7,0xf518,0xfd18,0xf518,0xf518,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,
+0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd38,0xf538,0xf538,0xed58,0xed58,0xed98,
+0xedd9,0xee1a,0xf67b,0xee7b,0xf65b,0xf63a,0xf5fa,0xedb9,0xed78,0xe537,0xf558,0xf538,0xf517,0xfcf7,0xfcf8,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,0xf4f7,0xf538,0xf538,0xfd38,0xf518,0xf538,
+0xf4f7,0xf538,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,
+0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80d,0xf80d,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xe82c,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf00c,0xf82c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd38,0xfd38,0xfd18,0xf4f8,
+0xf518,0xfd18,0xf518,0xfd18,0xfcf8,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
+0xfd18,0xfd18,0xfcf8,0xfd18,0xf517,0xf538,0xf538,0xf517,0xf4f7,0xf4f7,0xf538,0xfd58,0xed38,0xed58,0xf558,0xf538,
+0xf538,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xf538,0xf538,0xf518,0xf518,0xf518,0xf518,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd38,0xfd38,0xf4f7,0xf518,0xf518,0xfd58,0xfd38,0xfd38,0xf518,0xf518,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf80d,0xf80d,0xf00d,0xf00c,0xf00c,0xf00c,0xf80c,0xf80d,0xf80c,0xf80c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00b,0xf80c,0xf80d,0xf80d,
+0xf80c,0xf00c,0xe80c,0xe80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf518,0xf518,
+0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf4f7,0xf518,0xfd18,0xfd18,0xfd38,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
+0xf518,0xf518,0xf518,0xf518,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfd18,0xf4f8,0xf518,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf7,0xfcf8,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xf518,0xf518,
+0xf518,0xf518,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcd7,0xfcf8,
+0xfd18,0xfd38,0xfd18,0xf4f7,0xf518,0xf4f7,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,
+0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,
+0xf00d,0xf02d,0xf00d,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,
+0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,
+0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,0xf00c,0xf00c,
+0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf82c,0xf80c,0xf80c,0xf00b,0xf00c,0xf02c,0xf02d,0xf02c,0xf00c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,
+0xfd38,0xfd18,0xfcf7,0xfcf7,0xfcf8,0xfcf8,0xfcd8,0xfd18,0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,
+0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf7,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xf538,0xf538,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcd8,0xfcd8,0xfcf8,0xfcf8,0xfcf8,0xfd39,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,
+0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xe80b,0xf00c,0xf00c,0xf00c,0xf82d,0xf00b,
+0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,
+0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,
+0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,0xf00c,0xe82c,0xe82c,0xe82c,0xf80c,0xf80c,0xe82c,0xe82c,0xe82c,0xe82c,
+0xe80b,0xf02c,0xf00c,0xf00c,0xe82c,0xe82c,0xf00c,0xe80b,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfcf8,0xfd18,0xfcf8,0xfcb7,
+0xf476,0xfc76,0xfc76,0xfc76,0xfc76,0xfc96,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xf497,0xfc77,
+0xfc77,0xfc77,0xfc76,0xfc76,0xfc76,0xfc76,0xfc76,0xfc96,0xfc97,0xfcb7,0xf496,0xf476,0xf476,0xf496,0xfc97,0xfc97,
+0xfc97,0xfc97,0xf496,0xf496,0xf496,0xfc76,0xfc76,0xfc76,0xfc76,0xfc76,0xfc76,0xfc96,0xf496,0xf496,0xf496,0xfc96,
+0xfc96,0xfc76,0xfc76,0xfc76,0xfc76,0xfc97,0xfc76,0xf476,0xfcf8,0xfcd7,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,
+0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,
+0xf80c,0xf80c,0xf00c,0xf80c,0xf00c,0xf80c,0xf00b,0xf00b,0xf8ae,0xf08d,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,
+0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,
+0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,
+0xf0ad,0xe8cd,0xe8cd,0xf0ad,0xf88d,0xf88d,0xf0ad,0xe8cd,0xf0ad,0xf0cd,0xe8ad,0xf0ad,0xf0ad,0xe8ad,0xe8cd,0xf0cd,
+0xf86d,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfcf8,0xfd18,0xfd18,0xfd18,
+0xf518,0xf518,0xf518,0xf518,0xf4f7,0xfcf8,0xfd18,0xfcf8,0xfc97,0xdb93,0xc2b0,0xba4e,0xc26f,0xca4f,0xca4f,0xca4f,
+0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xc26f,0xc26f,0xc26f,0xc26f,0xca4f,0xca4f,0xca4f,0xc24f,0xca4f,0xca6f,0xca4f,
+0xca4f,0xca2f,0xc22f,0xc22f,0xca4f,0xca4f,0xca4f,0xc26f,0xc26f,0xca4f,0xca2f,0xca2f,0xca4f,0xca4f,0xca4f,0xca4f,
+0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xc26f,0xc26f,0xc26f,0xca4f,0xca4f,0xca4f,0xca4f,0xca6f,0xca6f,0xc26f,
+0xba4e,0xc2af,0xf476,0xfd39,0xfcf8,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfd18,0xf518,0xfd18,0xfd18,
+0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80b,0xf80c,0xf80b,0xf00c,
+0xf02c,0xf92f,0xfb16,0xfbb7,0xfb97,0xfb97,0xfb97,0xfb96,0xfb76,0xfb76,0xfb96,0xfb96,0xfb97,0xfb97,0xfb77,0xfb97,
+0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,
+0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,0xfb77,0xfb97,0xfb97,0xfb76,0xfb57,0xfb76,
+0xfb97,0xfb96,0xfb97,0xfb76,0xfb97,0xfb76,0xfb76,0xfb97,0xfbb7,0xfb15,0xf990,0xf82c,0xf00c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,
+0xfcf8,0xfd18,0xfd18,0xfcb7,0xfc97,0xfcb7,0xfc97,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc97,
+0xfc97,0xfc97,0xfc77,0xfc77,0xfc77,0xfc77,0xfc98,0xfc97,0xfc77,0xfc77,0xfc77,0xfc78,0xfc78,0xfc77,0xfc77,0xfc77,
+0xfc77,0xfc98,0xfc97,0xfc97,0xfc78,0xfc78,0xfc77,0xfc77,0xfc78,0xfc78,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,
+0xfc97,0xfc97,0xfc97,0xfc77,0xfc77,0xfc77,0xfc97,0xfc77,0xfc97,0xfcb7,0xfcb7,0xfc97,0xfd39,0xfcb7,0xfcf8,0xfd18,
+0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80b,0xf82c,0xe80b,0xe02b,0xe0ed,0xd0ac,0xd0cc,0xd0ec,
+0xd0ec,0xd0cc,0xd8cc,0xd8cc,0xd0cc,0xd0ec,0xd0cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,
+0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,
+0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xd8cc,0xe0ac,0xd8ac,0xd8cc,0xd0cc,0xd8cc,0xd8cc,0xd8cc,0xd8ed,
+0xd0ed,0xd0cc,0xd0cc,0xe0ad,0xf06c,0xf00b,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,
+0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
+0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
+0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
+0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,
+0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,
+0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,
+0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,
+0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xf00c,0xf00c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xf4d8,0xfbf6,
+0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c};
+ 
 #endif
\ No newline at end of file
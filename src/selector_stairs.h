@@ -1,537 +1,537 @@
-#ifndef SELECTOR_STAIRS_H
-#define SELECTOR_STARIS_H
- 
-const uint16_t selector_stairs[] PROGMEM = {0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf00c,0xf00c,0xe82c,0xf00c,0xf00c,0xe82c,0xe82c,0xf80c,0xf80c,0xf00c,0xf00c,0xf02c,0xe80c,0xf00c,0xf80d,
-0xf80c,0xf80d,0xf80d,0xf00c,0xf00c,0xf00c,0xf02d,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf02c,0xf02c,
-0xf00c,0xf00d,0xf80d,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,0xf518,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00b,0xf80c,0xf80c,0xf80c,0xf82d,0xf00c,
-0xe80c,0xe80b,0xe80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf00c,0xf00c,0xe80b,0xf02d,0xf00c,0xf00c,0xf80d,0xf80c,0xf00b,
-0xf00b,0xf80d,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,
-0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
-0xf00c,0xf02c,0xf82d,0xf00c,0xf82d,0xf80c,0xf80c,0xf80c,0xf00b,0xf00b,0xf02c,0xf02c,0xf00c,0xf02c,0xf82c,0xf00b,
-0xf00b,0xf80b,0xf80c,0xf82c,0xf00c,0xf00c,0xf80c,0xf00c,0xf80c,0xf82c,0xf80c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,
-0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00b,0xf00c,0xf82c,0xf00c,0xf00c,0xf00c,0xf00b,0xf00c,0xe80b,
-0xe80b,0xe86c,0xe06c,0xd8ac,0xd0cc,0xc8ab,0xd92d,0xd94e,0xe12d,0xd8ed,0xd8ac,0xd8ac,0xd88b,0xd84b,0xe84c,0xe82c,
-0xf00b,0xf00b,0xe80b,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
-0xf518,0xf518,0xf518,0xf538,0xf538,0xf538,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf00c,0xf02c,0xf00c,0xf80b,0xf80c,0xf80c,0xf00b,0xe86c,0xd0ac,0xc96d,0xe353,0xf4b7,0xfdba,0xfede,
-0xff3f,0xff3f,0xff1f,0xfedf,0xfe3d,0xfd39,0xe3f4,0xdab0,0xc8cb,0xd86b,0xe82b,0xf02c,0xf02c,0xf02c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,
-0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00b,0xe80b,0xf80c,0xf80c,
-0xf00b,0xe00b,0xd08b,0xe20f,0xfcb8,0xfe9f,0xff1f,0xff7f,0xff9f,0xff9f,0xff9f,0xffbf,0xffbf,0xffbf,0xff9f,0xff9f,
-0xff7f,0xfeff,0xfd7b,0xfb33,0xd90c,0xd04a,0xd84b,0xe82c,0xf00c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,
-0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,
-0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf80b,0xf80c,0xf00b,0xf00c,0xf84c,0xe82b,0xd88c,0xd1ce,0xfd39,0xfefe,0xff7f,0xff7f,
-0xffbf,0xffbf,0xff5e,0xff9f,0xff9f,0xff9f,0xff9f,0xffbf,0xffbf,0xffdf,0xffbf,0xff9f,0xff5f,0xff3f,0xfe5c,0xeb93,
-0xc90c,0xd84b,0xe82c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,
-0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
-0xf538,0xf538,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xf00c,0xe04b,0xd0ac,0xeb33,0xfe9f,0xff5f,0xffbf,0xffbf,0xff9f,0xff7f,0xff5f,0xfede,0xfdfb,0xfd59,0xfd18,
-0xf518,0xfdba,0xfe9d,0xff3f,0xff5f,0xff7f,0xff9f,0xff7e,0xff9f,0xff3f,0xfcf9,0xd9ef,0xd02b,0xf02c,0xf80c,0xf80c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf538,0xf538,0xed38,0xed58,0xed58,0xed58,0xed38,0xed38,0xed38,0xed38,
-0xed58,0xed38,0xf538,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00b,0xf80b,0xf80b,0xe84c,0xc8ec,0xfc36,0xff3f,0xffbf,
-0xffbf,0xff9f,0xff5f,0xfe7e,0xfc57,0xe250,0xd92d,0xd08b,0xd88b,0xd88b,0xd08b,0xc8ab,0xc0cb,0xd1ce,0xfb74,0xfd5a,
-0xff1f,0xff1d,0xffbf,0xffbf,0xff7f,0xfe5d,0xe210,0xe04c,0xf80c,0xf80b,0xf82d,0xe80b,0xf02c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf538,
-0xed78,0xf61a,0xedfa,0xee1a,0xee1a,0xee1a,0xedfa,0xedfa,0xf61a,0xedfa,0xee1a,0xee1a,0xedd9,0xf5da,0xfd99,0xf517,
-0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf00b,0xf02c,0xe86c,0xc88b,0xfc98,0xff1f,0xff7f,0xffbf,0xff9f,0xff1f,0xfc77,0xc9ae,0xd8cc,0xe04b,
-0xe00a,0xf82c,0xf80c,0xf80b,0xf80b,0xf80c,0xe82c,0xe02b,0xd84b,0xc8cb,0xca6f,0xfe3c,0xff5f,0xff7e,0xffdf,0xff7f,
-0xfe3e,0xea10,0xd80b,0xf82c,0xf00c,0xf00c,0xe80b,0xf82d,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,
-0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf538,0xfebd,0xff7f,0xff7e,0xff9f,0xff9f,0xff9f,
-0xff7f,0xff7f,0xff9f,0xff7f,0xff9f,0xff9f,0xff9f,0xff5f,0xfe9c,0xf579,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xe04b,0xc8cb,0xfc36,
-0xff3f,0xff9f,0xff9f,0xff5f,0xfd9b,0xda30,0xc0ab,0xe0ac,0xe80b,0xf00b,0xf84c,0xf00b,0xf82c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xf00c,0xf02c,0xe84c,0xe08c,0xc8aa,0xf394,0xff1f,0xff9f,0xffdf,0xff5f,0xfe3d,0xe1f0,0xd84b,0xe82c,0xf00b,
-0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xed38,0xfebc,0xff9f,0xffbe,0xffdf,0xffdf,0xffdf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbe,0xffdf,
-0xffbf,0xff9f,0xfe9c,0xe557,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe80b,0xd0cc,0xe333,0xff1f,0xff5e,0xff7f,0xff5f,0xfcf8,0xc92d,0xe08c,
-0xe04b,0xf02c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00b,0xf00b,0xf00b,0xf80c,0xf80c,0xf00b,0xe02b,
-0xd0cc,0xdad1,0xfebe,0xff7f,0xffbf,0xff7f,0xfd5a,0xd14d,0xd84b,0xf00b,0xf82c,0xf00b,0xf00c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xed58,0xfedc,0xffbf,
-0xffdf,0xf7ff,0xf7ff,0xf7ff,0xffdf,0xffdf,0xffdf,0xf7df,0xf7ff,0xf7de,0xffbe,0xffbf,0xfedc,0xe578,0xf538,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xe82c,
-0xd86b,0xd1ae,0xfedf,0xff5e,0xff9f,0xff5f,0xfcd8,0xd0ec,0xe86c,0xe80b,0xe80b,0xf00c,0xf00b,0xf00b,0xf00c,0xf00c,
-0xf00b,0xf00c,0xf00c,0xf80c,0xf80c,0xf82d,0xf80d,0xf80c,0xf02c,0xe86c,0xd84b,0xd0ec,0xda90,0xfe9e,0xff9f,0xffbf,
-0xff5f,0xec35,0xd08b,0xf04c,0xe80b,0xf82c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,
-0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xed58,0xfedc,0xffbf,0xffdf,0xf7ff,0xf7de,0xf7df,0xf7de,0xffdf,
-0xf7be,0xf7df,0xf7ff,0xf7ff,0xffdf,0xffbf,0xfebc,0xe557,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xe04c,0xc8cb,0xfcd9,0xff3f,0xffbf,0xff7f,0xfdbb,
-0xd12c,0xe02a,0xf00c,0xf80c,0xf82c,0xf82c,0xf00b,0xf00c,0xf80c,0xf80c,0xf82d,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,
-0xf80c,0xf00c,0xe80c,0xe80c,0xe82c,0xe02b,0xd08b,0xf333,0xff5f,0xffbf,0xffbf,0xfede,0xe20f,0xe04b,0xe00b,0xf02c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xed58,0xfedc,0xffbf,0xffdf,0xf7ff,0xf7de,0xf7ff,0xffdf,0xffdf,0xffdf,0xf7df,0xf7ff,0xf7ff,0xffdf,0xffbf,
-0xfebc,0xe557,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,
-0xf80c,0xf80c,0xf80c,0xe06c,0xd250,0xfeff,0xff7f,0xff7f,0xfe9d,0xca0e,0xd06a,0xf04c,0xf80c,0xf00b,0xf00c,0xf80c,
-0xf80c,0xf80b,0xf80c,0xf80c,0xf00b,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80d,0xf80d,0xf80d,0xf80c,0xf00b,
-0xf04c,0xc8ab,0xfcf7,0xff5f,0xff7e,0xff5f,0xfcb8,0xd0cb,0xe84c,0xf00b,0xf80d,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,
-0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xed58,0xfebc,0xffbf,0xf7df,0xf7ff,
-0xf7de,0xf7ff,0xffdf,0xffdf,0xffdf,0xf7de,0xefde,0xefde,0xffdf,0xff9f,0xfe9c,0xed58,0xf538,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xd08b,0xfcb8,0xff5f,
-0xff9f,0xff5f,0xfc76,0xc0cb,0xe04b,0xf00b,0xf00b,0xf82c,0xf80c,0xf00b,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf00c,0xf00c,0xf02c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00b,0xe08c,0xb9cd,0xfefe,0xff9f,0xff5e,
-0xfedf,0xc9ce,0xe06c,0xf00c,0xf00c,0xf80d,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,
-0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xf518,0xed38,0xed58,0xe558,0xed58,0xed58,0xed58,0xed58,0xed58,
-0xed58,0xed58,0xed58,0xed58,0xed58,0xe578,0xf6dc,0xffdf,0xf7df,0xf7ff,0xf7ff,0xf7ff,0xffdf,0xffbe,0xffdf,0xf7df,
-0xf7ff,0xf7ff,0xffdf,0xff9e,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,
-0xf00c,0xf00c,0xf80d,0xf80c,0xf80c,0xf00c,0xe84b,0xd14d,0xfeff,0xff9e,0xffdf,0xff1e,0xb98c,0xd06a,0xf04c,0xf00b,
-0xf00b,0xf00c,0xf00b,0xf80c,0xf80c,0xf82d,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xe80c,0xe80c,0xf82d,0xf80d,
-0xf80c,0xf80c,0xf00c,0xf00b,0xf02c,0xd84a,0xb8eb,0xf496,0xff7f,0xff9f,0xff5f,0xf435,0xd08b,0xf82c,0xf00c,0xf00c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
-0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf538,0xf538,0xf518,0xfd18,0xf518,0xf538,0xf538,0xf518,0xfd18,
-0xfd18,0xed37,0xfedd,0xff5e,0xf75d,0xff5e,0xff3d,0xff3e,0xff3d,0xff5d,0xff3d,0xff3d,0xff3d,0xff3d,0xff5d,0xff5d,
-0xffbe,0xffde,0xf7fe,0xf7fe,0xf7fe,0xf7de,0xffde,0xffde,0xffdf,0xf7de,0xf7ff,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,
-0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00d,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,
-0xe08c,0xeab1,0xff3f,0xffdf,0xf7de,0xfebc,0xebd4,0xd98d,0xd0ab,0xd88b,0xd86b,0xe8ad,0xe82c,0xe80b,0xf00c,0xf00b,
-0xf00b,0xf84d,0xe82c,0xd80a,0xe86c,0xe84c,0xe80c,0xf82d,0xf00c,0xf00c,0xe80b,0xe02b,0xe08c,0xd06b,0xc88b,0xd9ae,
-0xe2f2,0xfd59,0xff7f,0xffbf,0xff9f,0xfdda,0xc8ab,0xe80b,0xe80b,0xf80d,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,
-0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfcf8,0xfcf8,0xf518,0xf518,
-0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xf538,0xf538,0xf518,0xfd18,0xfd18,0xed58,0xff1d,0xffdf,0xf7de,0xf7de,
-0xffbe,0xffbe,0xffdf,0xffdf,0xffdf,0xffdf,0xffbe,0xffde,0xffde,0xfffe,0xffde,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,
-0xf7de,0xf7de,0xffdf,0xf7de,0xf7ff,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf00c,0xf00d,0xf00c,0xf00c,0xf80c,0xf80c,0xe80b,0xd0ac,0xfc77,0xff7f,0xffdf,0xffbf,0xff9f,
-0xff5f,0xff1f,0xfddb,0xf456,0xd22f,0xb8ab,0xd8cc,0xe06c,0xe80b,0xf84d,0xf00b,0xe00b,0xc0cb,0xc14d,0xc8cb,0xd88c,
-0xe82c,0xf80c,0xf00c,0xe84c,0xd8ac,0xc0cc,0xc9ce,0xebb5,0xfd9a,0xfeff,0xff3f,0xff7f,0xffbf,0xffdf,0xffbf,0xff1f,
-0xd98e,0xf04c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,
-0xf518,0xf518,0xf518,0xf518,0xfd39,0xfd38,0xfd18,0xfd18,0xfd18,0xfd38,0xfd18,0xfcf8,0xfd18,0xfd18,0xfcf8,0xfd18,
-0xf538,0xf538,0xfd18,0xfd18,0xfcf7,0xed57,0xff3d,0xffdf,0xf7fe,0xf7ff,0xffdf,0xffdf,0xffde,0xffde,0xffde,0xffde,
-0xffde,0xffde,0xffde,0xf7de,0xffde,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,0xffdf,0xf7de,0xf7ff,0xf7fe,
-0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf80c,0xe82b,0xc0ab,0xfd9b,0xff7f,0xff7e,0xff7f,0xff5f,0xff3f,0xff1f,0xff5f,0xff3f,0xfeff,0xfe3e,
-0xfc37,0xea71,0xd12d,0xc04a,0xd0ac,0xf291,0xfd9b,0xfe9e,0xfe5e,0xfbd5,0xd10d,0xc86a,0xc8cc,0xe231,0xfc16,0xfdfd,
-0xfedf,0xfeff,0xff3f,0xff5f,0xff5f,0xff3e,0xff5e,0xffdf,0xffbf,0xff1f,0xea50,0xe02b,0xf00c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,
-0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,
-0xfd18,0xfcf8,0xf518,0xf518,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xf518,0xf518,0xfcf8,0xfcf8,0xfd18,0xed58,
-0xff3d,0xffdf,0xf7de,0xf7de,0xffbe,0xffdf,0xffde,0xf7de,0xf7de,0xf7de,0xffbe,0xffde,0xf7de,0xf7fe,0xffde,0xffde,
-0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,0xffdf,0xf7de,0xf7ff,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xe84c,0xb8eb,0xfe7d,
-0xff7f,0xff9f,0xfdda,0xba2d,0xf394,0xfd7b,0xfeff,0xff1f,0xff5f,0xff7f,0xff5f,0xff1f,0xfebe,0xfd9a,0xe496,0xff1f,
-0xff9f,0xff9f,0xff9f,0xff5f,0xfdba,0xecf7,0xfeff,0xff3f,0xff5f,0xff7f,0xff3f,0xff1f,0xfeff,0xfdfc,0xfc36,0xd2b0,
-0xcbd2,0xff1d,0xffbf,0xff5f,0xfb95,0xe06c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,
-0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xf518,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xf538,0xf538,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xf538,0xf538,0xfd18,0xfd18,0xfd38,0xed78,0xff3d,0xffdf,0xf7de,0xffff,0xffbe,0xffbe,
-0xffdf,0xffff,0xf7ff,0xffff,0xffde,0xfffe,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,
-0xffdf,0xf7de,0xf7ff,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00b,0xf80c,0xe86c,0xb94c,0xfeff,0xff7f,0xff7f,0xfcf8,0xc10b,0xd0ec,0xc0ab,
-0xc1ce,0xe3d4,0xfd9a,0xff3f,0xff3f,0xff5f,0xff5f,0xff5f,0xff9f,0xffbf,0xf7df,0xf7ff,0xf7de,0xff9e,0xff9f,0xff5e,
-0xff3e,0xff7f,0xff5f,0xfebe,0xfdbb,0xe3d5,0xb9ce,0xb8eb,0xd8ec,0xc0aa,0xc2b0,0xff3f,0xffbf,0xff5f,0xfbb5,0xd06b,
-0xe80b,0xf82d,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
-0xf518,0xf518,0xf538,0xf538,0xfd18,0xfd18,0xed38,0xed37,0xf517,0xf518,0xf518,0xf518,0xfd18,0xf518,0xf518,0xf538,
-0xf518,0xf518,0xed17,0xe557,0xff1d,0xffdf,0xffff,0xffff,0xffde,0xffbe,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,
-0xf7fe,0xf7fe,0xf7de,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,0xffdf,0xf7de,0xf7ff,0xf7fe,0xf7df,0xffbf,
-0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80b,
-0xf80c,0xe06c,0xb9ad,0xff1f,0xff7f,0xff5f,0xfc97,0xd0cb,0xd82a,0xe88c,0xd84b,0xd88c,0xd08b,0xd12d,0xea91,0xfc57,
-0xfe5e,0xfeff,0xff7f,0xffbf,0xf7de,0xf7ff,0xffdf,0xffbe,0xff7e,0xff5f,0xfeff,0xfd19,0xfb34,0xd12d,0xd08c,0xd8ac,
-0xe0ac,0xd82b,0xe84b,0xd08b,0xc26f,0xff3f,0xffbf,0xff7f,0xfc16,0xd8ac,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,
-0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfcf8,0xfcd7,0xfcf8,
-0xed58,0xed58,0xed58,0xed37,0xed58,0xf538,0xf538,0xf538,0xed58,0xed58,0xed58,0xed58,0xed78,0xe598,0xff3d,0xffdf,
-0xf7de,0xf7ff,0xffde,0xffde,0xffff,0xf7ff,0xf7ff,0xf7ff,0xfffe,0xfffe,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7fe,0xf7fe,
-0xf7de,0xffde,0xf7de,0xf7de,0xffdf,0xf7de,0xf7ff,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xd84b,0xb98d,0xfeff,0xff7f,0xff3f,
-0xfcb8,0xd0ab,0xe04b,0xf00c,0xf00c,0xf00c,0xf80c,0xe00a,0xe08c,0xd0ab,0xb8eb,0xcab0,0xfefe,0xff9f,0xffdf,0xffde,
-0xffbe,0xff9f,0xff5f,0xf4f7,0xb14b,0xc8cb,0xd86c,0xe82c,0xf80c,0xf00b,0xf80c,0xf80b,0xf00b,0xe08b,0xd290,0xfefe,
-0xffbf,0xff7f,0xfc16,0xd06b,0xf04c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,
-0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfd59,0xf5fa,0xf63b,0xf65a,0xf63a,0xf63a,0xf63a,
-0xf63a,0xf63a,0xf63a,0xf63a,0xf63a,0xf63a,0xf65a,0xe63a,0xff9e,0xffdf,0xf7de,0xf7ff,0xf7de,0xffde,0xf7de,0xf7fe,
-0xf7fe,0xf7de,0xffde,0xf7de,0xf7fe,0xf7fe,0xffde,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,0xffdf,0xf7de,
-0xf7ff,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,
-0xf00c,0xf00c,0xf80c,0xf00b,0xf80c,0xe84c,0xc12c,0xfebe,0xff9f,0xff7f,0xfd3a,0xc8eb,0xd84b,0xf00b,0xf00c,0xf80c,
-0xf80c,0xf02c,0xe02b,0xe06c,0xd84b,0xd10d,0xf456,0xff5f,0xff9f,0xffbf,0xffbf,0xff3e,0xfe7d,0xc9ad,0xd08b,0xe04c,
-0xe04c,0xf04c,0xf00b,0xf80b,0xf80c,0xf80b,0xf80c,0xe02a,0xdab1,0xff1f,0xff7f,0xff5f,0xfb94,0xd06b,0xf04c,0xf00c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
-0xf538,0xf518,0xf518,0xf538,0xf538,0xf538,0xf538,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xf518,
-0xf538,0xf518,0xf518,0xed58,0xff7f,0xffbf,0xffbf,0xff9e,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xff9f,0xff9f,
-0xff9f,0xff9f,0xffdf,0xf7df,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,0xf7de,0xffde,0xffde,0xffde,0xf7de,0xf7de,
-0xffde,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,0xffde,0xf7de,0xf7fe,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,
-0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xe80b,
-0xc0ec,0xfdfc,0xff7f,0xff9f,0xfe1c,0xb8eb,0xe08c,0xf02c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf84d,0xd80a,
-0xc12c,0xfcf8,0xff7f,0xff9e,0xff7f,0xfede,0xead1,0xd06b,0xe80b,0xf82c,0xe80b,0xe82c,0xf80c,0xf80c,0xf82c,0xf00b,
-0xf80b,0xe88c,0xeb73,0xfefe,0xff9f,0xff3f,0xf2f2,0xe06c,0xf04c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,
-0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd38,0xf518,0xf518,0xf518,0xf517,0xf518,
-0xf518,0xf517,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf538,0xe558,0xff7f,0xffbf,
-0xffdf,0xffdf,0xf7df,0xf7ff,0xf7df,0xf7df,0xf7df,0xffdf,0xffdf,0xffbf,0xffbf,0xffbf,0xffdf,0xf7ff,0xf7fe,0xf7fe,
-0xf7de,0xffde,0xf7de,0xf7de,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,
-0xf7de,0xf7de,0xffde,0xf7de,0xf7fe,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xe80b,0xf00c,0xf80c,0xf80c,0xe80b,0xd0ab,0xfcd9,0xff5f,0xff9f,0xfebe,0xca2f,
-0xd88b,0xf00b,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00b,0xe80b,0xe8ad,0xc10c,0xf5b9,0xff9f,0xff3f,0xcaf1,
-0xd0cc,0xe80b,0xf00c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf02c,0xe80b,0xf00b,0xd08b,0xfcf8,0xff7f,0xffbf,0xff5f,
-0xe1ef,0xe02b,0xe80b,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfcf8,0xfd18,0xfd38,0xfd18,0xfd18,0xfd38,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfcf8,0xfd18,0xed37,0xff9f,0xffbe,0xffbe,0xffbe,0xf7de,0xf7fe,0xf7fe,0xf7fe,
-0xffde,0xffde,0xffdf,0xffdf,0xffdf,0xffdf,0xf7df,0xf7ff,0xf7fe,0xf7fe,0xf7de,0xf7de,0xffde,0xffde,0xffde,0xffde,
-0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,0xffde,0xf7de,0xf7fe,0xf7fe,
-0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00b,
-0xf80c,0xf80c,0xf80c,0xe80b,0xd88c,0xfb74,0xff3f,0xff9f,0xff5f,0xe393,0xd88b,0xf00b,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80d,0xf80c,0xf00b,0xf82c,0xc86a,0xf4f8,0xff5f,0xfeff,0xb9cd,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,
-0xf80c,0xf80c,0xe80b,0xe84c,0xe86c,0xc0cb,0xfe7c,0xffbf,0xff9f,0xfebe,0xd10c,0xe80b,0xf00c,0xf82c,0xf00c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xfcf8,
-0xfcf8,0xfd18,0xfcf8,0xfd18,0xfd18,0xf4f7,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
-0xfd18,0xed37,0xff9f,0xffdf,0xffdf,0xffdf,0xffde,0xf7fe,0xf7fe,0xf7fe,0xffde,0xffde,0xffdf,0xffdf,0xffdf,0xf7df,
-0xf7df,0xf7df,0xf7fe,0xf7fe,0xf7de,0xf7de,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,
-0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,0xffde,0xf7de,0xf7fe,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xe06c,0xda0f,
-0xff1f,0xffbf,0xff9f,0xfd7a,0xd08b,0xf86d,0xf00c,0xf00c,0xf02d,0xf00c,0xf00c,0xf00c,0xf04d,0xf02c,0xe80a,0xe0cc,
-0xfcf8,0xff3f,0xfeff,0xd270,0xe04b,0xf80b,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf04c,0xd86b,0xead2,
-0xff5f,0xffdf,0xff7f,0xf518,0xd0ab,0xf00c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,
-0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd38,0xfd18,
-0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd38,0xed58,0xff7e,0xf79e,0xffbe,0xffde,
-0xffde,0xffde,0xf7fe,0xf7de,0xffde,0xffde,0xffde,0xf7de,0xf7df,0xf7ff,0xf7df,0xf7df,0xf7de,0xf7de,0xf7de,0xf7de,
-0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,
-0xffde,0xf7de,0xf7fe,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xe82c,0xc8ec,0xfddb,0xff9f,0xff7e,0xff3f,0xea71,0xd82b,
-0xe80b,0xf02c,0xf02d,0xe80b,0xf00c,0xf00c,0xe80b,0xf04c,0xf82c,0xd04a,0xfc96,0xff3f,0xfeff,0xc1ce,0xe06c,0xf00b,
-0xf82d,0xf00c,0xf80c,0xf80b,0xf80c,0xf80c,0xf00c,0xe04b,0xc8cc,0xfd9b,0xff9f,0xff9f,0xff3f,0xd2f1,0xd86b,0xf82c,
-0xf80c,0xf00b,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xf518,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,0xf518,0xf518,0xed17,0xf538,0xf538,0xf538,0xf538,0xf538,0xf538,
-0xf538,0xed38,0xf558,0xed38,0xed17,0xe578,0xffbf,0xf7ff,0xffdf,0xffde,0xffde,0xffde,0xf7de,0xf7de,0xffde,0xffde,
-0xf7de,0xf7fe,0xf7ff,0xf7ff,0xf7df,0xffdf,0xffde,0xffde,0xffde,0xf7de,0xffde,0xffde,0xffde,0xffde,0xf7de,0xf7de,
-0xf7de,0xffde,0xffde,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,0xffde,0xf7de,0xf7fe,0xf7fe,0xf7df,0xffbf,
-0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80d,0xf00c,0xf80c,
-0xf00c,0xf00b,0xf80c,0xd84a,0xeb73,0xfefe,0xffbf,0xff9f,0xfddb,0xb90c,0xe86c,0xf00c,0xe80b,0xf82d,0xf80c,0xf82d,
-0xf02c,0xe80a,0xf80c,0xd88b,0xfd19,0xff1f,0xfedf,0xca2f,0xd84b,0xf00c,0xf82d,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,
-0xe82c,0xd0ac,0xe353,0xff1f,0xffbf,0xff7f,0xfdbb,0xd12c,0xe04b,0xf00b,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,
-0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xf518,0xfd38,0xf538,
-0xed17,0xed37,0xed58,0xed58,0xe558,0xe558,0xe558,0xe578,0xe578,0xe578,0xe578,0xe578,0xe578,0xe557,0xe537,0xe5b9,
-0xf77d,0xf7ff,0xf7ff,0xf7be,0xffde,0xffde,0xf7fe,0xf7fe,0xffde,0xffde,0xf7fe,0xf7fe,0xf7ff,0xf7ff,0xffdf,0xffdf,
-0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xf7de,0xf7de,0xf7fe,0xf7fe,0xf7fe,0xf7de,0xffde,0xffde,0xf7fe,0xf7fe,
-0xf7de,0xffde,0xf7de,0xf7de,0xffde,0xf7de,0xf7fe,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80d,0xf02c,0xf00b,0xf80c,0xe82b,0xc10c,0xfe1c,
-0xff9f,0xffbf,0xff3f,0xec15,0xc88b,0xe82b,0xf02c,0xf00c,0xf80c,0xf00b,0xf00c,0xf82c,0xf00b,0xd86b,0xfcd8,0xff3f,
-0xfeff,0xc1ee,0xe08c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf00b,0xf04d,0xd06b,0xc9ae,0xfe7d,0xff5f,0xff9f,0xff1f,
-0xfb33,0xd00a,0xf04c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd38,0xf518,0xf518,0xed18,0xed38,0xfdda,0xfedd,0xff7f,0xff5f,0xff5f,
-0xff5f,0xff5f,0xff5f,0xff5f,0xff5f,0xff7f,0xff5e,0xff5f,0xff5f,0xff5e,0xffff,0xefff,0xf7fe,0xffdf,0xffde,0xffde,
-0xf7fe,0xf7fe,0xffde,0xf7de,0xf7fe,0xf7fe,0xf7ff,0xf7ff,0xffdf,0xffdf,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,
-0xf7de,0xf7de,0xf7fe,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xffde,0xf7de,
-0xf7fe,0xf7fe,0xf7df,0xffbf,0xfebc,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf00c,0xd86b,0xeb13,0xff3f,0xffbf,0xff9f,0xff3e,0xe2f1,0xd0ab,
-0xe84c,0xf00c,0xf80c,0xf80c,0xf00b,0xf00c,0xf80c,0xd86c,0xfcd8,0xff3f,0xfedf,0xca0f,0xe04c,0xf80c,0xf82d,0xf00b,
-0xf80c,0xf00b,0xf80c,0xe04b,0xb90c,0xfd9a,0xff7f,0xff9f,0xff5f,0xfd9a,0xd0cc,0xe82c,0xf82c,0xf80c,0xf80c,0xf80d,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
-0xf518,0xfd38,0xfd18,0xfd38,0xf538,0xf5b9,0xff9f,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbe,0xffbe,0xffbe,0xffbe,
-0xffbf,0xffbf,0xffbf,0xffbe,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,
-0xf7fe,0xf7fe,0xf7de,0xffde,0xffde,0xffde,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,
-0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffff,0xf7de,0xf7de,0xffff,0xffbf,0xfebb,0xed58,
-0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
-0xf80c,0xf80c,0xe82c,0xc8ab,0xfd18,0xff5f,0xff9e,0xff9f,0xfe7c,0xd26f,0xc88b,0xe04c,0xf00b,0xf80c,0xf80c,0xf00b,
-0xf80c,0xd06b,0xf4d8,0xff3f,0xfeff,0xc9ef,0xe86c,0xf80b,0xf00b,0xf82c,0xe80b,0xf86d,0xd80b,0xd12d,0xfcd8,0xff3f,
-0xff9f,0xff9f,0xfebe,0xda50,0xe08c,0xf00b,0xf00b,0xf80c,0xf00c,0xf80d,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,
-0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,
-0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf4f8,0xfd18,0xf4f7,0xf518,0xf518,0xf5d9,
-0xffbf,0xffdf,0xf7df,0xf7ff,0xf7fe,0xf7fe,0xffde,0xffde,0xf7de,0xf7fe,0xf7ff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,
-0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7fe,0xf7fe,
-0xf7fe,0xf7de,0xffde,0xffdf,0xf7ff,0xf7de,0xffdf,0xffbe,0xfe9b,0xe557,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00b,0xe02b,0xc94d,0xfddb,
-0xff7f,0xffbf,0xff9f,0xfede,0xeb74,0xd10d,0xe02b,0xf02c,0xf00b,0xf02c,0xe82b,0xc8ab,0xfd18,0xff1f,0xfedf,0xc9ef,
-0xe04c,0xf80c,0xf02c,0xf00b,0xf04c,0xd84b,0xd1ce,0xfd59,0xff5f,0xffbf,0xffbf,0xff3f,0xfb74,0xd04a,0xe84c,0xf00b,
-0xf80c,0xf00c,0xf02d,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xf518,0xf517,0xf518,0xed17,0xf5d9,0xffbf,0xf7de,0xf7ff,0xf7ff,0xf7fe,0xf7fe,
-0xffde,0xf7de,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,
-0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,
-0xf7fe,0xf7fe,0xf7fe,0xf7de,0xffdf,0xffdf,0xffdf,0xffdf,0xf7ff,0xf7ff,0xf7ff,0xffff,0xffbe,0xffdf,0xffff,0xf7de,
-0xffde,0xff9e,0xfe9b,0xed57,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf00c,0xf00c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf82c,0xd86b,0xd9ef,0xfe5d,0xff3e,0xffbf,0xff9f,0xfeff,0xfc97,
-0xd18e,0xd0ab,0xd88b,0xe04b,0xe86c,0xc0aa,0xf518,0xff3f,0xfedf,0xca0f,0xd04a,0xe82b,0xe06c,0xd08b,0xc08a,0xf333,
-0xfe7d,0xff5f,0xffbf,0xff9f,0xff3f,0xf436,0xd08b,0xf04c,0xf00b,0xf00c,0xf82c,0xf00c,0xf02c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd38,0xf518,
-0xf518,0xf538,0xed37,0xf5d9,0xff9f,0xf7de,0xf7df,0xf7ff,0xf7fe,0xf7fe,0xf7de,0xf7de,0xf7fe,0xeffe,0xf7de,0xf7de,
-0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7fe,0xf7fe,
-0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7de,0xffde,0xffbe,
-0xffbe,0xffbe,0xf7de,0xf7de,0xf7de,0xf7de,0xffbe,0xffdf,0xffde,0xf7be,0xffbe,0xffbf,0xfebc,0xe557,0xf538,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,
-0xf80c,0xf00b,0xf02c,0xd88c,0xc9ce,0xfe5e,0xff5f,0xff9f,0xff9f,0xff3f,0xfede,0xf496,0xc18d,0xc0aa,0xd08b,0xc90b,
-0xecd7,0xff3f,0xfede,0xc26f,0xc90c,0xc88b,0xb92b,0xdb32,0xfdfb,0xff7f,0xffbf,0xffbf,0xffbf,0xff3f,0xfc36,0xd0cb,
-0xe84b,0xf00b,0xf80c,0xf80c,0xf00b,0xf02c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,
-0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf538,0xf517,0xf518,0xf538,0xed37,0xedd9,0xff9f,0xffdf,
-0xffdf,0xf7ff,0xf7ff,0xffff,0xffdf,0xffdf,0xf7ff,0xf7ff,0xf7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,
-0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffbf,0xfebc,0xe557,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xe80b,0xd8ac,0xc9ce,
-0xfd9b,0xff3f,0xff7f,0xffbf,0xff7f,0xff5f,0xfedf,0xfd7a,0xfbd5,0xd2d1,0xf5d9,0xff7f,0xff1e,0xc3b2,0xe373,0xfcb8,
-0xfdfc,0xff3f,0xff7f,0xffbf,0xffbf,0xff9f,0xfefe,0xe393,0xd08b,0xf02c,0xf84c,0xf00b,0xf80c,0xf80c,0xf00c,0xf00c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xf518,0xf518,0xf538,0xf518,0xf518,0xf518,0xf538,0xf5da,0xff3e,0xff9f,0xff9f,0xff9f,0xff9f,0xff9f,0xff9e,0xff9e,
-0xffbe,0xffbe,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,
-0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,
-0xffbf,0xffbf,0xffbf,0xffbf,0xff9f,0xff9f,0xffbf,0xffbf,0xffbf,0xffbf,0xff9e,0xff9f,0xffbf,0xff9f,0xff9f,0xff5e,
-0xfe7b,0xed78,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80d,0xf80c,0xf00b,0xe80b,0xe06c,0xc8ec,0xfbd6,0xfedf,0xff1e,0xff9f,0xffbf,
-0xff9f,0xff9f,0xff5f,0xff7f,0xffbf,0xf7bf,0xffdf,0xffbf,0xff7f,0xff5f,0xff7f,0xff7f,0xff7f,0xff7f,0xff3f,0xfd7a,
-0xda50,0xd0ac,0xe80b,0xf80c,0xe80b,0xf84d,0xf00c,0xf00c,0xf80d,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,
-0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,
-0xfd38,0xfd79,0xfe3b,0xfe7c,0xfe7c,0xfe7c,0xfe7b,0xfe7b,0xfe5b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,
-0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe9b,0xfe9b,0xfe9b,0xfe9b,
-0xfe9b,0xfe9b,0xfe9b,0xfe9b,0xfe9b,0xfe9b,0xfe9b,0xfe9b,0xfe9b,0xfe9b,0xfe9b,0xfe9b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,
-0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe9b,0xfe9b,0xfe7b,0xfe5b,0xfdda,0xf558,0xf518,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf00c,
-0xf80c,0xf80c,0xf80c,0xe80b,0xe86d,0xc86b,0xd1ee,0xfcd8,0xfebe,0xff5f,0xff7f,0xff9f,0xff9f,0xffbf,0xffdf,0xffdf,
-0xffdf,0xffbf,0xff9f,0xff9f,0xff7f,0xff3f,0xff1f,0xfddb,0xeb73,0xb8eb,0xd84b,0xf00c,0xf80c,0xf80c,0xf00c,0xf02c,
-0xe80c,0xf02c,0xf80c,0xf80c,0xf80b,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcd7,0xfd18,0xf517,0xed58,0xed58,0xed58,0xed58,
-0xed37,0xf537,0xf537,0xf537,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,
-0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,
-0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed57,0xed57,0xed57,0xed57,0xed57,0xed57,0xed57,0xed57,0xed58,0xed57,
-0xed57,0xed57,0xed37,0xf558,0xfd38,0xf517,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xe82c,
-0xd86b,0xd0ab,0xe1af,0xfb74,0xfd5b,0xfebf,0xff3f,0xff5f,0xff3f,0xff5f,0xff5f,0xff5f,0xff5f,0xff1f,0xfddc,0xfc98,
-0xea71,0xd0ec,0xd04a,0xe86c,0xf00b,0xf80c,0xf80d,0xf00c,0xf00c,0xe82c,0xe82c,0xe80c,0xf80c,0xf80c,0xf80c,0xf00c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
-0xf518,0xf518,0xfd18,0xfd18,0xf518,0xf518,0xf558,0xed37,0xed38,0xed38,0xf538,0xf518,0xf518,0xf518,0xf538,0xf538,
-0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,
-0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf538,
-0xf538,0xf538,0xf538,0xf538,0xf538,0xf538,0xf538,0xf538,0xf538,0xf538,0xf538,0xf538,0xf518,0xf518,0xf518,0xf517,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,
-0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,
-0xe80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf00c,0xe82c,0xe82c,0xf00c,0xf80c,0xf02c,0xe82b,0xe80b,0xe04b,0xd0cc,0xc98d,
-0xd2b1,0xdb93,0xf416,0xfc36,0xfc36,0xebd5,0xd312,0xca4f,0xc14d,0xc88b,0xe8ad,0xe80b,0xf00b,0xf82c,0xf80c,0xf80c,
-0xf80d,0xf00c,0xf00d,0xe80d,0xe82c,0xe80c,0xf00c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,
-0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfd18,0xf518,0xf4f7,0xf518,
-0xfd38,0xf538,0xf538,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xf518,0xf517,0xf518,0xfd38,0xfd18,0xfcf8,0xfcf7,0xfd18,0xfd38,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00b,
-0xf00b,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,
-0xe82c,0xe82c,0xf00c,0xf80c,0xf82c,0xf00b,0xf00c,0xf02c,0xf02c,0xe04b,0xd86c,0xd88c,0xd84b,0xd84b,0xe06c,0xe08c,
-0xd86c,0xd84b,0xd84b,0xe04c,0xe00b,0xe80b,0xf00c,0xf80c,0xf80c,0xf80c,0xf80d,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,
-0xf00c,0xf80c,0xf80c,0xf80c,0xf00b,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80b,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfcf8,0xfd18,0xfd38,0xf538,0xf4f8,0xf4d7,0xf518,0xf518,0xfcf8,0xfcf8,
-0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,0xf518,0xfcf8,0xfcf8,
-0xfd18,0xfd18,0xfd18,0xf4f7,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,
-0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80b,0xf80c,0xf80c,0xf80c,0xf80c,0xf82c,0xf02c,0xe80b,0xf80c,0xf80c,
-0xf80c,0xf00c,0xf00c,0xe82c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,
-0xf00b,0xf00b,0xf00b,0xf00b,0xf00c,0xf80c,0xf82c,0xf80b,0xf80b,0xf80b,0xf80c,0xf00c,0xf02c,0xf04c,0xf02c,0xf02c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,
-0xf00b,0xf00b,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd38,0xfd18,
-0xfd18,0xf4f7,0xf518,0xfd38,0xfd18,0xfd38,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,
-0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd38,0xfd18,0xfd18,0xfcf8,0xfcd7,0xfcd7,0xf518,0xfd38,0xf518,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
-0xf80c,0xf80b,0xf80b,0xf80c,0xf00c,0xe80b,0xe82c,0xe84c,0xe82c,0xf00c,0xf80c,0xf00c,0xf00c,0xe82c,0xf00c,0xf00c,
-0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xe80c,0xe82c,0xf04c,0xf04c,0xe82c,0xe80b,0xe80b,0xf00b,
-0xf00b,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xe80c,0xe80c,0xf02c,0xf00c,0xf00c,0xf02c,0xf00c,0xf00c,0xf00c,
-0xe82c,0xe82c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xe82c,0xe80b,0xe82c,0xf02c,0xf02c,0xf00c,0xf82c,0xf00b,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,
-0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xecf7,0xf518,0xfd59,0xf538,0xf538,0xf518,0xf4d7,0xfd18,
-0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xf518,
-0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xf518,
-0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
-0xecf7,0xecf7,0xfcf8,0xfcf8,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xe80c,0xf08d,
-0xf0ee,0xe8ad,0xe8cd,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf88d,0xf88d,0xf0ad,0xf0ad,0xf0cd,0xf0ad,0xf88d,
-0xf88d,0xf0ad,0xf0ee,0xe8cd,0xe88d,0xe88d,0xe8ad,0xe8cd,0xf0cd,0xf0ad,0xe88d,0xf0ad,0xf0ad,0xf0ad,0xf08d,0xf0ad,
-0xf08d,0xf08d,0xf08d,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xe88d,0xf08d,0xf0cd,0xe8cd,0xe8cd,0xf0ad,0xf0ad,0xf0ad,0xf0ad,
-0xf0ad,0xe8cd,0xe8cd,0xe8cd,0xe8ad,0xf0ad,0xf08d,0xf8ae,0xe80b,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xf518,0xf518,0xfd18,0xf518,0xf518,0xf4f7,0xf538,0xfd18,0xf476,0xfc97,0xfc96,0xfc76,0xfc57,0xfc77,0xfc77,0xf497,
-0xfc77,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,
-0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,
-0xf497,0xf497,0xfc77,0xfc77,0xf497,0xfc77,0xfc77,0xfc77,0xfc77,0xf497,0xf4d7,0xf4d7,0xfcb7,0xfc97,0xfc77,0xf497,
-0xf4f7,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf00c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xe80b,0xe84d,0xf9f2,0xfb37,0xfb57,0xfb77,0xfb97,0xfb97,0xfb97,
-0xfb77,0xfb77,0xfb77,0xfb77,0xfb77,0xfb76,0xfb96,0xfb96,0xfb96,0xfb97,0xfb77,0xfb77,0xfb76,0xfb77,0xfb77,0xfb77,
-0xfb77,0xfb97,0xfb96,0xfb96,0xfbb7,0xfbb7,0xfb97,0xfb76,0xfb77,0xfb97,0xfb97,0xfb77,0xfb97,0xfb97,0xfb97,0xfb97,
-0xfb76,0xfb56,0xfb76,0xfb97,0xfb96,0xfb96,0xfb96,0xfb96,0xfb76,0xfb76,0xfb96,0xfb96,0xfbb7,0xfb97,0xfb56,0xfb77,
-0xfb57,0xfaf6,0xf8ee,0xe82c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,
-0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xfcf8,0xfd18,0xfd18,
-0xfd38,0xec56,0xcab0,0xc20e,0xc26f,0xca4f,0xd22f,0xd22f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,
-0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,
-0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,
-0xca4f,0xca4f,0xca4f,0xca4f,0xba2e,0xc26f,0xca6f,0xca2f,0xc20e,0xca90,0xe3b4,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00b,
-0xf00c,0xf04d,0xe82c,0xe86c,0xe8ad,0xe0ad,0xd8cc,0xd0cc,0xd0ec,0xd0cc,0xd8cc,0xd8ac,0xd8ac,0xd8ac,0xd8cc,0xd0cc,
-0xd0cc,0xd0ec,0xd0ec,0xd0ec,0xd0cc,0xd8cc,0xd8cc,0xd8ac,0xe08c,0xe08c,0xd8cc,0xd0ec,0xd0ec,0xd0cc,0xd0cc,0xd0cc,
-0xd0cc,0xd8cd,0xd0cc,0xd0cc,0xd0cc,0xd8ed,0xd0ac,0xd0cd,0xd0cc,0xd0cc,0xd8cc,0xd8ed,0xd8cc,0xd0ac,0xd0cc,0xd0cc,
-0xd0cc,0xd8cc,0xd8cc,0xd8cc,0xd0cc,0xd0cc,0xd0cc,0xd8ed,0xd8ac,0xd8ac,0xe08c,0xf0cd,0xd80b,0xf04c,0xf00c,0xf00c,
-0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xfcf8,0xfd18,0xf4d7,0xfd18,0xfcf8,0xfc56,0xfcb8,0xfc77,0xfc77,
-0xfc57,0xfc57,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,
-0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,
-0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfcb8,0xfc97,
-0xfc77,0xfc77,0xfc78,0xfc97,0xfcb8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xe82c,0xe82c,
-0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,
-0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,
-0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,
-0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
-0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
-0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
-0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
-0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,
-0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
-0xfd18,0xfd18,0xfd18,0xfd18};
- 
+#ifndef SELECTOR_STAIRS_H
+#define SELECTOR_STARIS_H
+ 
+const uint16_t selector_stairs[] PROGMEM = {0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf00c,0xf00c,0xe82c,0xf00c,0xf00c,0xe82c,0xe82c,0xf80c,0xf80c,0xf00c,0xf00c,0xf02c,0xe80c,0xf00c,0xf80d,
+0xf80c,0xf80d,0xf80d,0xf00c,0xf00c,0xf00c,0xf02d,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf02c,0xf02c,
+0xf00c,0xf00d,0xf80d,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,0xf518,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00b,0xf80c,0xf80c,0xf80c,0xf82d,0xf00c,
+0xe80c,0xe80b,0xe80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf00c,0xf00c,0xe80b,0xf02d,0xf00c,0xf00c,0xf80d,0xf80c,0xf00b,
+0xf00b,0xf80d,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,
+0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
+0xf00c,0xf02c,0xf82d,0xf00c,0xf82d,0xf80c,0xf80c,0xf80c,0xf00b,0xf00b,0xf02c,0xf02c,0xf00c,0xf02c,0xf82c,0xf00b,
+0xf00b,0xf80b,0xf80c,0xf82c,0xf00c,0xf00c,0xf80c,0xf00c,0xf80c,0xf82c,0xf80c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,
+0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00b,0xf00c,0xf82c,0xf00c,0xf00c,0xf00c,0xf00b,0xf00c,0xe80b,
+0xe80b,0xe86c,0xe06c,0xd8ac,0xd0cc,0xc8ab,0xd92d,0xd94e,0xe12d,0xd8ed,0xd8ac,0xd8ac,0xd88b,0xd84b,0xe84c,0xe82c,
+0xf00b,0xf00b,0xe80b,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
+0xf518,0xf518,0xf518,0xf538,0xf538,0xf538,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf00c,0xf02c,0xf00c,0xf80b,0xf80c,0xf80c,0xf00b,0xe86c,0xd0ac,0xc96d,0xe353,0xf4b7,0xfdba,0xfede,
+0xff3f,0xff3f,0xff1f,0xfedf,0xfe3d,0xfd39,0xe3f4,0xdab0,0xc8cb,0xd86b,0xe82b,0xf02c,0xf02c,0xf02c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,
+0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00b,0xe80b,0xf80c,0xf80c,
+0xf00b,0xe00b,0xd08b,0xe20f,0xfcb8,0xfe9f,0xff1f,0xff7f,0xff9f,0xff9f,0xff9f,0xffbf,0xffbf,0xffbf,0xff9f,0xff9f,
+0xff7f,0xfeff,0xfd7b,0xfb33,0xd90c,0xd04a,0xd84b,0xe82c,0xf00c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,
+0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,
+0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf80b,0xf80c,0xf00b,0xf00c,0xf84c,0xe82b,0xd88c,0xd1ce,0xfd39,0xfefe,0xff7f,0xff7f,
+0xffbf,0xffbf,0xff5e,0xff9f,0xff9f,0xff9f,0xff9f,0xffbf,0xffbf,0xffdf,0xffbf,0xff9f,0xff5f,0xff3f,0xfe5c,0xeb93,
+0xc90c,0xd84b,0xe82c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,
+0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
+0xf538,0xf538,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xf00c,0xe04b,0xd0ac,0xeb33,0xfe9f,0xff5f,0xffbf,0xffbf,0xff9f,0xff7f,0xff5f,0xfede,0xfdfb,0xfd59,0xfd18,
+0xf518,0xfdba,0xfe9d,0xff3f,0xff5f,0xff7f,0xff9f,0xff7e,0xff9f,0xff3f,0xfcf9,0xd9ef,0xd02b,0xf02c,0xf80c,0xf80c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf538,0xf538,0xed38,0xed58,0xed58,0xed58,0xed38,0xed38,0xed38,0xed38,
+0xed58,0xed38,0xf538,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00b,0xf80b,0xf80b,0xe84c,0xc8ec,0xfc36,0xff3f,0xffbf,
+0xffbf,0xff9f,0xff5f,0xfe7e,0xfc57,0xe250,0xd92d,0xd08b,0xd88b,0xd88b,0xd08b,0xc8ab,0xc0cb,0xd1ce,0xfb74,0xfd5a,
+0xff1f,0xff1d,0xffbf,0xffbf,0xff7f,0xfe5d,0xe210,0xe04c,0xf80c,0xf80b,0xf82d,0xe80b,0xf02c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf538,
+0xed78,0xf61a,0xedfa,0xee1a,0xee1a,0xee1a,0xedfa,0xedfa,0xf61a,0xedfa,0xee1a,0xee1a,0xedd9,0xf5da,0xfd99,0xf517,
+0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf00b,0xf02c,0xe86c,0xc88b,0xfc98,0xff1f,0xff7f,0xffbf,0xff9f,0xff1f,0xfc77,0xc9ae,0xd8cc,0xe04b,
+0xe00a,0xf82c,0xf80c,0xf80b,0xf80b,0xf80c,0xe82c,0xe02b,0xd84b,0xc8cb,0xca6f,0xfe3c,0xff5f,0xff7e,0xffdf,0xff7f,
+0xfe3e,0xea10,0xd80b,0xf82c,0xf00c,0xf00c,0xe80b,0xf82d,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,
+0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf538,0xfebd,0xff7f,0xff7e,0xff9f,0xff9f,0xff9f,
+0xff7f,0xff7f,0xff9f,0xff7f,0xff9f,0xff9f,0xff9f,0xff5f,0xfe9c,0xf579,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xe04b,0xc8cb,0xfc36,
+0xff3f,0xff9f,0xff9f,0xff5f,0xfd9b,0xda30,0xc0ab,0xe0ac,0xe80b,0xf00b,0xf84c,0xf00b,0xf82c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xf00c,0xf02c,0xe84c,0xe08c,0xc8aa,0xf394,0xff1f,0xff9f,0xffdf,0xff5f,0xfe3d,0xe1f0,0xd84b,0xe82c,0xf00b,
+0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xed38,0xfebc,0xff9f,0xffbe,0xffdf,0xffdf,0xffdf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbe,0xffdf,
+0xffbf,0xff9f,0xfe9c,0xe557,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe80b,0xd0cc,0xe333,0xff1f,0xff5e,0xff7f,0xff5f,0xfcf8,0xc92d,0xe08c,
+0xe04b,0xf02c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00b,0xf00b,0xf00b,0xf80c,0xf80c,0xf00b,0xe02b,
+0xd0cc,0xdad1,0xfebe,0xff7f,0xffbf,0xff7f,0xfd5a,0xd14d,0xd84b,0xf00b,0xf82c,0xf00b,0xf00c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xed58,0xfedc,0xffbf,
+0xffdf,0xf7ff,0xf7ff,0xf7ff,0xffdf,0xffdf,0xffdf,0xf7df,0xf7ff,0xf7de,0xffbe,0xffbf,0xfedc,0xe578,0xf538,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xe82c,
+0xd86b,0xd1ae,0xfedf,0xff5e,0xff9f,0xff5f,0xfcd8,0xd0ec,0xe86c,0xe80b,0xe80b,0xf00c,0xf00b,0xf00b,0xf00c,0xf00c,
+0xf00b,0xf00c,0xf00c,0xf80c,0xf80c,0xf82d,0xf80d,0xf80c,0xf02c,0xe86c,0xd84b,0xd0ec,0xda90,0xfe9e,0xff9f,0xffbf,
+0xff5f,0xec35,0xd08b,0xf04c,0xe80b,0xf82c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,
+0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xed58,0xfedc,0xffbf,0xffdf,0xf7ff,0xf7de,0xf7df,0xf7de,0xffdf,
+0xf7be,0xf7df,0xf7ff,0xf7ff,0xffdf,0xffbf,0xfebc,0xe557,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xe04c,0xc8cb,0xfcd9,0xff3f,0xffbf,0xff7f,0xfdbb,
+0xd12c,0xe02a,0xf00c,0xf80c,0xf82c,0xf82c,0xf00b,0xf00c,0xf80c,0xf80c,0xf82d,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,
+0xf80c,0xf00c,0xe80c,0xe80c,0xe82c,0xe02b,0xd08b,0xf333,0xff5f,0xffbf,0xffbf,0xfede,0xe20f,0xe04b,0xe00b,0xf02c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xed58,0xfedc,0xffbf,0xffdf,0xf7ff,0xf7de,0xf7ff,0xffdf,0xffdf,0xffdf,0xf7df,0xf7ff,0xf7ff,0xffdf,0xffbf,
+0xfebc,0xe557,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,
+0xf80c,0xf80c,0xf80c,0xe06c,0xd250,0xfeff,0xff7f,0xff7f,0xfe9d,0xca0e,0xd06a,0xf04c,0xf80c,0xf00b,0xf00c,0xf80c,
+0xf80c,0xf80b,0xf80c,0xf80c,0xf00b,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80d,0xf80d,0xf80d,0xf80c,0xf00b,
+0xf04c,0xc8ab,0xfcf7,0xff5f,0xff7e,0xff5f,0xfcb8,0xd0cb,0xe84c,0xf00b,0xf80d,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,
+0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xed58,0xfebc,0xffbf,0xf7df,0xf7ff,
+0xf7de,0xf7ff,0xffdf,0xffdf,0xffdf,0xf7de,0xefde,0xefde,0xffdf,0xff9f,0xfe9c,0xed58,0xf538,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xd08b,0xfcb8,0xff5f,
+0xff9f,0xff5f,0xfc76,0xc0cb,0xe04b,0xf00b,0xf00b,0xf82c,0xf80c,0xf00b,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf00c,0xf00c,0xf02c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00b,0xe08c,0xb9cd,0xfefe,0xff9f,0xff5e,
+0xfedf,0xc9ce,0xe06c,0xf00c,0xf00c,0xf80d,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,
+0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xf518,0xed38,0xed58,0xe558,0xed58,0xed58,0xed58,0xed58,0xed58,
+0xed58,0xed58,0xed58,0xed58,0xed58,0xe578,0xf6dc,0xffdf,0xf7df,0xf7ff,0xf7ff,0xf7ff,0xffdf,0xffbe,0xffdf,0xf7df,
+0xf7ff,0xf7ff,0xffdf,0xff9e,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,
+0xf00c,0xf00c,0xf80d,0xf80c,0xf80c,0xf00c,0xe84b,0xd14d,0xfeff,0xff9e,0xffdf,0xff1e,0xb98c,0xd06a,0xf04c,0xf00b,
+0xf00b,0xf00c,0xf00b,0xf80c,0xf80c,0xf82d,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xe80c,0xe80c,0xf82d,0xf80d,
+0xf80c,0xf80c,0xf00c,0xf00b,0xf02c,0xd84a,0xb8eb,0xf496,0xff7f,0xff9f,0xff5f,0xf435,0xd08b,0xf82c,0xf00c,0xf00c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
+0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf538,0xf538,0xf518,0xfd18,0xf518,0xf538,0xf538,0xf518,0xfd18,
+0xfd18,0xed37,0xfedd,0xff5e,0xf75d,0xff5e,0xff3d,0xff3e,0xff3d,0xff5d,0xff3d,0xff3d,0xff3d,0xff3d,0xff5d,0xff5d,
+0xffbe,0xffde,0xf7fe,0xf7fe,0xf7fe,0xf7de,0xffde,0xffde,0xffdf,0xf7de,0xf7ff,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,
+0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00d,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,
+0xe08c,0xeab1,0xff3f,0xffdf,0xf7de,0xfebc,0xebd4,0xd98d,0xd0ab,0xd88b,0xd86b,0xe8ad,0xe82c,0xe80b,0xf00c,0xf00b,
+0xf00b,0xf84d,0xe82c,0xd80a,0xe86c,0xe84c,0xe80c,0xf82d,0xf00c,0xf00c,0xe80b,0xe02b,0xe08c,0xd06b,0xc88b,0xd9ae,
+0xe2f2,0xfd59,0xff7f,0xffbf,0xff9f,0xfdda,0xc8ab,0xe80b,0xe80b,0xf80d,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,
+0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfcf8,0xfcf8,0xf518,0xf518,
+0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xf538,0xf538,0xf518,0xfd18,0xfd18,0xed58,0xff1d,0xffdf,0xf7de,0xf7de,
+0xffbe,0xffbe,0xffdf,0xffdf,0xffdf,0xffdf,0xffbe,0xffde,0xffde,0xfffe,0xffde,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,
+0xf7de,0xf7de,0xffdf,0xf7de,0xf7ff,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf00c,0xf00d,0xf00c,0xf00c,0xf80c,0xf80c,0xe80b,0xd0ac,0xfc77,0xff7f,0xffdf,0xffbf,0xff9f,
+0xff5f,0xff1f,0xfddb,0xf456,0xd22f,0xb8ab,0xd8cc,0xe06c,0xe80b,0xf84d,0xf00b,0xe00b,0xc0cb,0xc14d,0xc8cb,0xd88c,
+0xe82c,0xf80c,0xf00c,0xe84c,0xd8ac,0xc0cc,0xc9ce,0xebb5,0xfd9a,0xfeff,0xff3f,0xff7f,0xffbf,0xffdf,0xffbf,0xff1f,
+0xd98e,0xf04c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,
+0xf518,0xf518,0xf518,0xf518,0xfd39,0xfd38,0xfd18,0xfd18,0xfd18,0xfd38,0xfd18,0xfcf8,0xfd18,0xfd18,0xfcf8,0xfd18,
+0xf538,0xf538,0xfd18,0xfd18,0xfcf7,0xed57,0xff3d,0xffdf,0xf7fe,0xf7ff,0xffdf,0xffdf,0xffde,0xffde,0xffde,0xffde,
+0xffde,0xffde,0xffde,0xf7de,0xffde,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,0xffdf,0xf7de,0xf7ff,0xf7fe,
+0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf80c,0xe82b,0xc0ab,0xfd9b,0xff7f,0xff7e,0xff7f,0xff5f,0xff3f,0xff1f,0xff5f,0xff3f,0xfeff,0xfe3e,
+0xfc37,0xea71,0xd12d,0xc04a,0xd0ac,0xf291,0xfd9b,0xfe9e,0xfe5e,0xfbd5,0xd10d,0xc86a,0xc8cc,0xe231,0xfc16,0xfdfd,
+0xfedf,0xfeff,0xff3f,0xff5f,0xff5f,0xff3e,0xff5e,0xffdf,0xffbf,0xff1f,0xea50,0xe02b,0xf00c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,
+0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,
+0xfd18,0xfcf8,0xf518,0xf518,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xf518,0xf518,0xfcf8,0xfcf8,0xfd18,0xed58,
+0xff3d,0xffdf,0xf7de,0xf7de,0xffbe,0xffdf,0xffde,0xf7de,0xf7de,0xf7de,0xffbe,0xffde,0xf7de,0xf7fe,0xffde,0xffde,
+0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,0xffdf,0xf7de,0xf7ff,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xe84c,0xb8eb,0xfe7d,
+0xff7f,0xff9f,0xfdda,0xba2d,0xf394,0xfd7b,0xfeff,0xff1f,0xff5f,0xff7f,0xff5f,0xff1f,0xfebe,0xfd9a,0xe496,0xff1f,
+0xff9f,0xff9f,0xff9f,0xff5f,0xfdba,0xecf7,0xfeff,0xff3f,0xff5f,0xff7f,0xff3f,0xff1f,0xfeff,0xfdfc,0xfc36,0xd2b0,
+0xcbd2,0xff1d,0xffbf,0xff5f,0xfb95,0xe06c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,
+0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xf518,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xf538,0xf538,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xf538,0xf538,0xfd18,0xfd18,0xfd38,0xed78,0xff3d,0xffdf,0xf7de,0xffff,0xffbe,0xffbe,
+0xffdf,0xffff,0xf7ff,0xffff,0xffde,0xfffe,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,
+0xffdf,0xf7de,0xf7ff,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00b,0xf80c,0xe86c,0xb94c,0xfeff,0xff7f,0xff7f,0xfcf8,0xc10b,0xd0ec,0xc0ab,
+0xc1ce,0xe3d4,0xfd9a,0xff3f,0xff3f,0xff5f,0xff5f,0xff5f,0xff9f,0xffbf,0xf7df,0xf7ff,0xf7de,0xff9e,0xff9f,0xff5e,
+0xff3e,0xff7f,0xff5f,0xfebe,0xfdbb,0xe3d5,0xb9ce,0xb8eb,0xd8ec,0xc0aa,0xc2b0,0xff3f,0xffbf,0xff5f,0xfbb5,0xd06b,
+0xe80b,0xf82d,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
+0xf518,0xf518,0xf538,0xf538,0xfd18,0xfd18,0xed38,0xed37,0xf517,0xf518,0xf518,0xf518,0xfd18,0xf518,0xf518,0xf538,
+0xf518,0xf518,0xed17,0xe557,0xff1d,0xffdf,0xffff,0xffff,0xffde,0xffbe,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,
+0xf7fe,0xf7fe,0xf7de,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,0xffdf,0xf7de,0xf7ff,0xf7fe,0xf7df,0xffbf,
+0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80b,
+0xf80c,0xe06c,0xb9ad,0xff1f,0xff7f,0xff5f,0xfc97,0xd0cb,0xd82a,0xe88c,0xd84b,0xd88c,0xd08b,0xd12d,0xea91,0xfc57,
+0xfe5e,0xfeff,0xff7f,0xffbf,0xf7de,0xf7ff,0xffdf,0xffbe,0xff7e,0xff5f,0xfeff,0xfd19,0xfb34,0xd12d,0xd08c,0xd8ac,
+0xe0ac,0xd82b,0xe84b,0xd08b,0xc26f,0xff3f,0xffbf,0xff7f,0xfc16,0xd8ac,0xe82c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,
+0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfcf8,0xfcd7,0xfcf8,
+0xed58,0xed58,0xed58,0xed37,0xed58,0xf538,0xf538,0xf538,0xed58,0xed58,0xed58,0xed58,0xed78,0xe598,0xff3d,0xffdf,
+0xf7de,0xf7ff,0xffde,0xffde,0xffff,0xf7ff,0xf7ff,0xf7ff,0xfffe,0xfffe,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7fe,0xf7fe,
+0xf7de,0xffde,0xf7de,0xf7de,0xffdf,0xf7de,0xf7ff,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xd84b,0xb98d,0xfeff,0xff7f,0xff3f,
+0xfcb8,0xd0ab,0xe04b,0xf00c,0xf00c,0xf00c,0xf80c,0xe00a,0xe08c,0xd0ab,0xb8eb,0xcab0,0xfefe,0xff9f,0xffdf,0xffde,
+0xffbe,0xff9f,0xff5f,0xf4f7,0xb14b,0xc8cb,0xd86c,0xe82c,0xf80c,0xf00b,0xf80c,0xf80b,0xf00b,0xe08b,0xd290,0xfefe,
+0xffbf,0xff7f,0xfc16,0xd06b,0xf04c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,
+0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfd59,0xf5fa,0xf63b,0xf65a,0xf63a,0xf63a,0xf63a,
+0xf63a,0xf63a,0xf63a,0xf63a,0xf63a,0xf63a,0xf65a,0xe63a,0xff9e,0xffdf,0xf7de,0xf7ff,0xf7de,0xffde,0xf7de,0xf7fe,
+0xf7fe,0xf7de,0xffde,0xf7de,0xf7fe,0xf7fe,0xffde,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,0xffdf,0xf7de,
+0xf7ff,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,
+0xf00c,0xf00c,0xf80c,0xf00b,0xf80c,0xe84c,0xc12c,0xfebe,0xff9f,0xff7f,0xfd3a,0xc8eb,0xd84b,0xf00b,0xf00c,0xf80c,
+0xf80c,0xf02c,0xe02b,0xe06c,0xd84b,0xd10d,0xf456,0xff5f,0xff9f,0xffbf,0xffbf,0xff3e,0xfe7d,0xc9ad,0xd08b,0xe04c,
+0xe04c,0xf04c,0xf00b,0xf80b,0xf80c,0xf80b,0xf80c,0xe02a,0xdab1,0xff1f,0xff7f,0xff5f,0xfb94,0xd06b,0xf04c,0xf00c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
+0xf538,0xf518,0xf518,0xf538,0xf538,0xf538,0xf538,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xfd18,0xf518,
+0xf538,0xf518,0xf518,0xed58,0xff7f,0xffbf,0xffbf,0xff9e,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xff9f,0xff9f,
+0xff9f,0xff9f,0xffdf,0xf7df,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,0xf7de,0xffde,0xffde,0xffde,0xf7de,0xf7de,
+0xffde,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,0xffde,0xf7de,0xf7fe,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,
+0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xe80b,
+0xc0ec,0xfdfc,0xff7f,0xff9f,0xfe1c,0xb8eb,0xe08c,0xf02c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf84d,0xd80a,
+0xc12c,0xfcf8,0xff7f,0xff9e,0xff7f,0xfede,0xead1,0xd06b,0xe80b,0xf82c,0xe80b,0xe82c,0xf80c,0xf80c,0xf82c,0xf00b,
+0xf80b,0xe88c,0xeb73,0xfefe,0xff9f,0xff3f,0xf2f2,0xe06c,0xf04c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,
+0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd38,0xf518,0xf518,0xf518,0xf517,0xf518,
+0xf518,0xf517,0xf518,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf538,0xe558,0xff7f,0xffbf,
+0xffdf,0xffdf,0xf7df,0xf7ff,0xf7df,0xf7df,0xf7df,0xffdf,0xffdf,0xffbf,0xffbf,0xffbf,0xffdf,0xf7ff,0xf7fe,0xf7fe,
+0xf7de,0xffde,0xf7de,0xf7de,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,
+0xf7de,0xf7de,0xffde,0xf7de,0xf7fe,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xe80b,0xf00c,0xf80c,0xf80c,0xe80b,0xd0ab,0xfcd9,0xff5f,0xff9f,0xfebe,0xca2f,
+0xd88b,0xf00b,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00b,0xe80b,0xe8ad,0xc10c,0xf5b9,0xff9f,0xff3f,0xcaf1,
+0xd0cc,0xe80b,0xf00c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf02c,0xe80b,0xf00b,0xd08b,0xfcf8,0xff7f,0xffbf,0xff5f,
+0xe1ef,0xe02b,0xe80b,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfcf8,0xfd18,0xfd38,0xfd18,0xfd18,0xfd38,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfcf8,0xfd18,0xed37,0xff9f,0xffbe,0xffbe,0xffbe,0xf7de,0xf7fe,0xf7fe,0xf7fe,
+0xffde,0xffde,0xffdf,0xffdf,0xffdf,0xffdf,0xf7df,0xf7ff,0xf7fe,0xf7fe,0xf7de,0xf7de,0xffde,0xffde,0xffde,0xffde,
+0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,0xffde,0xf7de,0xf7fe,0xf7fe,
+0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00b,
+0xf80c,0xf80c,0xf80c,0xe80b,0xd88c,0xfb74,0xff3f,0xff9f,0xff5f,0xe393,0xd88b,0xf00b,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80d,0xf80c,0xf00b,0xf82c,0xc86a,0xf4f8,0xff5f,0xfeff,0xb9cd,0xe06c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,
+0xf80c,0xf80c,0xe80b,0xe84c,0xe86c,0xc0cb,0xfe7c,0xffbf,0xff9f,0xfebe,0xd10c,0xe80b,0xf00c,0xf82c,0xf00c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xfcf8,
+0xfcf8,0xfd18,0xfcf8,0xfd18,0xfd18,0xf4f7,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
+0xfd18,0xed37,0xff9f,0xffdf,0xffdf,0xffdf,0xffde,0xf7fe,0xf7fe,0xf7fe,0xffde,0xffde,0xffdf,0xffdf,0xffdf,0xf7df,
+0xf7df,0xf7df,0xf7fe,0xf7fe,0xf7de,0xf7de,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,
+0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,0xffde,0xf7de,0xf7fe,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xe06c,0xda0f,
+0xff1f,0xffbf,0xff9f,0xfd7a,0xd08b,0xf86d,0xf00c,0xf00c,0xf02d,0xf00c,0xf00c,0xf00c,0xf04d,0xf02c,0xe80a,0xe0cc,
+0xfcf8,0xff3f,0xfeff,0xd270,0xe04b,0xf80b,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf04c,0xd86b,0xead2,
+0xff5f,0xffdf,0xff7f,0xf518,0xd0ab,0xf00c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,
+0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd38,0xfd18,
+0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd38,0xed58,0xff7e,0xf79e,0xffbe,0xffde,
+0xffde,0xffde,0xf7fe,0xf7de,0xffde,0xffde,0xffde,0xf7de,0xf7df,0xf7ff,0xf7df,0xf7df,0xf7de,0xf7de,0xf7de,0xf7de,
+0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,
+0xffde,0xf7de,0xf7fe,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xe82c,0xc8ec,0xfddb,0xff9f,0xff7e,0xff3f,0xea71,0xd82b,
+0xe80b,0xf02c,0xf02d,0xe80b,0xf00c,0xf00c,0xe80b,0xf04c,0xf82c,0xd04a,0xfc96,0xff3f,0xfeff,0xc1ce,0xe06c,0xf00b,
+0xf82d,0xf00c,0xf80c,0xf80b,0xf80c,0xf80c,0xf00c,0xe04b,0xc8cc,0xfd9b,0xff9f,0xff9f,0xff3f,0xd2f1,0xd86b,0xf82c,
+0xf80c,0xf00b,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xf518,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,0xf518,0xf518,0xed17,0xf538,0xf538,0xf538,0xf538,0xf538,0xf538,
+0xf538,0xed38,0xf558,0xed38,0xed17,0xe578,0xffbf,0xf7ff,0xffdf,0xffde,0xffde,0xffde,0xf7de,0xf7de,0xffde,0xffde,
+0xf7de,0xf7fe,0xf7ff,0xf7ff,0xf7df,0xffdf,0xffde,0xffde,0xffde,0xf7de,0xffde,0xffde,0xffde,0xffde,0xf7de,0xf7de,
+0xf7de,0xffde,0xffde,0xffde,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7de,0xffde,0xf7de,0xf7fe,0xf7fe,0xf7df,0xffbf,
+0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80d,0xf00c,0xf80c,
+0xf00c,0xf00b,0xf80c,0xd84a,0xeb73,0xfefe,0xffbf,0xff9f,0xfddb,0xb90c,0xe86c,0xf00c,0xe80b,0xf82d,0xf80c,0xf82d,
+0xf02c,0xe80a,0xf80c,0xd88b,0xfd19,0xff1f,0xfedf,0xca2f,0xd84b,0xf00c,0xf82d,0xf00c,0xf80c,0xf00c,0xf80c,0xf00c,
+0xe82c,0xd0ac,0xe353,0xff1f,0xffbf,0xff7f,0xfdbb,0xd12c,0xe04b,0xf00b,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,
+0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xf518,0xfd38,0xf538,
+0xed17,0xed37,0xed58,0xed58,0xe558,0xe558,0xe558,0xe578,0xe578,0xe578,0xe578,0xe578,0xe578,0xe557,0xe537,0xe5b9,
+0xf77d,0xf7ff,0xf7ff,0xf7be,0xffde,0xffde,0xf7fe,0xf7fe,0xffde,0xffde,0xf7fe,0xf7fe,0xf7ff,0xf7ff,0xffdf,0xffdf,
+0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,0xf7de,0xf7de,0xf7fe,0xf7fe,0xf7fe,0xf7de,0xffde,0xffde,0xf7fe,0xf7fe,
+0xf7de,0xffde,0xf7de,0xf7de,0xffde,0xf7de,0xf7fe,0xf7fe,0xf7df,0xffbf,0xfe9c,0xed58,0xf518,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80d,0xf02c,0xf00b,0xf80c,0xe82b,0xc10c,0xfe1c,
+0xff9f,0xffbf,0xff3f,0xec15,0xc88b,0xe82b,0xf02c,0xf00c,0xf80c,0xf00b,0xf00c,0xf82c,0xf00b,0xd86b,0xfcd8,0xff3f,
+0xfeff,0xc1ee,0xe08c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf00b,0xf04d,0xd06b,0xc9ae,0xfe7d,0xff5f,0xff9f,0xff1f,
+0xfb33,0xd00a,0xf04c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd38,0xf518,0xf518,0xed18,0xed38,0xfdda,0xfedd,0xff7f,0xff5f,0xff5f,
+0xff5f,0xff5f,0xff5f,0xff5f,0xff5f,0xff7f,0xff5e,0xff5f,0xff5f,0xff5e,0xffff,0xefff,0xf7fe,0xffdf,0xffde,0xffde,
+0xf7fe,0xf7fe,0xffde,0xf7de,0xf7fe,0xf7fe,0xf7ff,0xf7ff,0xffdf,0xffdf,0xffde,0xffde,0xffde,0xffde,0xffde,0xffde,
+0xf7de,0xf7de,0xf7fe,0xf7fe,0xf7fe,0xf7de,0xffde,0xf7de,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xffde,0xf7de,
+0xf7fe,0xf7fe,0xf7df,0xffbf,0xfebc,0xed58,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf00c,0xd86b,0xeb13,0xff3f,0xffbf,0xff9f,0xff3e,0xe2f1,0xd0ab,
+0xe84c,0xf00c,0xf80c,0xf80c,0xf00b,0xf00c,0xf80c,0xd86c,0xfcd8,0xff3f,0xfedf,0xca0f,0xe04c,0xf80c,0xf82d,0xf00b,
+0xf80c,0xf00b,0xf80c,0xe04b,0xb90c,0xfd9a,0xff7f,0xff9f,0xff5f,0xfd9a,0xd0cc,0xe82c,0xf82c,0xf80c,0xf80c,0xf80d,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
+0xf518,0xfd38,0xfd18,0xfd38,0xf538,0xf5b9,0xff9f,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbe,0xffbe,0xffbe,0xffbe,
+0xffbf,0xffbf,0xffbf,0xffbe,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,
+0xf7fe,0xf7fe,0xf7de,0xffde,0xffde,0xffde,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,
+0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xffff,0xffff,0xf7de,0xf7de,0xffff,0xffbf,0xfebb,0xed58,
+0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,
+0xf80c,0xf80c,0xe82c,0xc8ab,0xfd18,0xff5f,0xff9e,0xff9f,0xfe7c,0xd26f,0xc88b,0xe04c,0xf00b,0xf80c,0xf80c,0xf00b,
+0xf80c,0xd06b,0xf4d8,0xff3f,0xfeff,0xc9ef,0xe86c,0xf80b,0xf00b,0xf82c,0xe80b,0xf86d,0xd80b,0xd12d,0xfcd8,0xff3f,
+0xff9f,0xff9f,0xfebe,0xda50,0xe08c,0xf00b,0xf00b,0xf80c,0xf00c,0xf80d,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,
+0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,
+0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf4f8,0xfd18,0xf4f7,0xf518,0xf518,0xf5d9,
+0xffbf,0xffdf,0xf7df,0xf7ff,0xf7fe,0xf7fe,0xffde,0xffde,0xf7de,0xf7fe,0xf7ff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,
+0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7fe,0xf7fe,
+0xf7fe,0xf7de,0xffde,0xffdf,0xf7ff,0xf7de,0xffdf,0xffbe,0xfe9b,0xe557,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00b,0xe02b,0xc94d,0xfddb,
+0xff7f,0xffbf,0xff9f,0xfede,0xeb74,0xd10d,0xe02b,0xf02c,0xf00b,0xf02c,0xe82b,0xc8ab,0xfd18,0xff1f,0xfedf,0xc9ef,
+0xe04c,0xf80c,0xf02c,0xf00b,0xf04c,0xd84b,0xd1ce,0xfd59,0xff5f,0xffbf,0xffbf,0xff3f,0xfb74,0xd04a,0xe84c,0xf00b,
+0xf80c,0xf00c,0xf02d,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xf518,0xf517,0xf518,0xed17,0xf5d9,0xffbf,0xf7de,0xf7ff,0xf7ff,0xf7fe,0xf7fe,
+0xffde,0xf7de,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,
+0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,
+0xf7fe,0xf7fe,0xf7fe,0xf7de,0xffdf,0xffdf,0xffdf,0xffdf,0xf7ff,0xf7ff,0xf7ff,0xffff,0xffbe,0xffdf,0xffff,0xf7de,
+0xffde,0xff9e,0xfe9b,0xed57,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf00c,0xf00c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf82c,0xd86b,0xd9ef,0xfe5d,0xff3e,0xffbf,0xff9f,0xfeff,0xfc97,
+0xd18e,0xd0ab,0xd88b,0xe04b,0xe86c,0xc0aa,0xf518,0xff3f,0xfedf,0xca0f,0xd04a,0xe82b,0xe06c,0xd08b,0xc08a,0xf333,
+0xfe7d,0xff5f,0xffbf,0xff9f,0xff3f,0xf436,0xd08b,0xf04c,0xf00b,0xf00c,0xf82c,0xf00c,0xf02c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd38,0xf518,
+0xf518,0xf538,0xed37,0xf5d9,0xff9f,0xf7de,0xf7df,0xf7ff,0xf7fe,0xf7fe,0xf7de,0xf7de,0xf7fe,0xeffe,0xf7de,0xf7de,
+0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7de,0xf7fe,0xf7fe,
+0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7fe,0xf7de,0xffde,0xffbe,
+0xffbe,0xffbe,0xf7de,0xf7de,0xf7de,0xf7de,0xffbe,0xffdf,0xffde,0xf7be,0xffbe,0xffbf,0xfebc,0xe557,0xf538,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,
+0xf80c,0xf00b,0xf02c,0xd88c,0xc9ce,0xfe5e,0xff5f,0xff9f,0xff9f,0xff3f,0xfede,0xf496,0xc18d,0xc0aa,0xd08b,0xc90b,
+0xecd7,0xff3f,0xfede,0xc26f,0xc90c,0xc88b,0xb92b,0xdb32,0xfdfb,0xff7f,0xffbf,0xffbf,0xffbf,0xff3f,0xfc36,0xd0cb,
+0xe84b,0xf00b,0xf80c,0xf80c,0xf00b,0xf02c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,
+0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf538,0xf517,0xf518,0xf538,0xed37,0xedd9,0xff9f,0xffdf,
+0xffdf,0xf7ff,0xf7ff,0xffff,0xffdf,0xffdf,0xf7ff,0xf7ff,0xf7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,
+0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffbf,0xfebc,0xe557,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xe80b,0xd8ac,0xc9ce,
+0xfd9b,0xff3f,0xff7f,0xffbf,0xff7f,0xff5f,0xfedf,0xfd7a,0xfbd5,0xd2d1,0xf5d9,0xff7f,0xff1e,0xc3b2,0xe373,0xfcb8,
+0xfdfc,0xff3f,0xff7f,0xffbf,0xffbf,0xff9f,0xfefe,0xe393,0xd08b,0xf02c,0xf84c,0xf00b,0xf80c,0xf80c,0xf00c,0xf00c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xf518,0xf518,0xf538,0xf518,0xf518,0xf518,0xf538,0xf5da,0xff3e,0xff9f,0xff9f,0xff9f,0xff9f,0xff9f,0xff9e,0xff9e,
+0xffbe,0xffbe,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,
+0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,0xffbf,
+0xffbf,0xffbf,0xffbf,0xffbf,0xff9f,0xff9f,0xffbf,0xffbf,0xffbf,0xffbf,0xff9e,0xff9f,0xffbf,0xff9f,0xff9f,0xff5e,
+0xfe7b,0xed78,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80d,0xf80c,0xf00b,0xe80b,0xe06c,0xc8ec,0xfbd6,0xfedf,0xff1e,0xff9f,0xffbf,
+0xff9f,0xff9f,0xff5f,0xff7f,0xffbf,0xf7bf,0xffdf,0xffbf,0xff7f,0xff5f,0xff7f,0xff7f,0xff7f,0xff7f,0xff3f,0xfd7a,
+0xda50,0xd0ac,0xe80b,0xf80c,0xe80b,0xf84d,0xf00c,0xf00c,0xf80d,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,
+0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,
+0xfd38,0xfd79,0xfe3b,0xfe7c,0xfe7c,0xfe7c,0xfe7b,0xfe7b,0xfe5b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,
+0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe9b,0xfe9b,0xfe9b,0xfe9b,
+0xfe9b,0xfe9b,0xfe9b,0xfe9b,0xfe9b,0xfe9b,0xfe9b,0xfe9b,0xfe9b,0xfe9b,0xfe9b,0xfe9b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,
+0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe7b,0xfe9b,0xfe9b,0xfe7b,0xfe5b,0xfdda,0xf558,0xf518,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf00c,
+0xf80c,0xf80c,0xf80c,0xe80b,0xe86d,0xc86b,0xd1ee,0xfcd8,0xfebe,0xff5f,0xff7f,0xff9f,0xff9f,0xffbf,0xffdf,0xffdf,
+0xffdf,0xffbf,0xff9f,0xff9f,0xff7f,0xff3f,0xff1f,0xfddb,0xeb73,0xb8eb,0xd84b,0xf00c,0xf80c,0xf80c,0xf00c,0xf02c,
+0xe80c,0xf02c,0xf80c,0xf80c,0xf80b,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcd7,0xfd18,0xf517,0xed58,0xed58,0xed58,0xed58,
+0xed37,0xf537,0xf537,0xf537,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,
+0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,
+0xed37,0xed37,0xed37,0xed37,0xed37,0xed37,0xed57,0xed57,0xed57,0xed57,0xed57,0xed57,0xed57,0xed57,0xed58,0xed57,
+0xed57,0xed57,0xed37,0xf558,0xfd38,0xf517,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xe82c,
+0xd86b,0xd0ab,0xe1af,0xfb74,0xfd5b,0xfebf,0xff3f,0xff5f,0xff3f,0xff5f,0xff5f,0xff5f,0xff5f,0xff1f,0xfddc,0xfc98,
+0xea71,0xd0ec,0xd04a,0xe86c,0xf00b,0xf80c,0xf80d,0xf00c,0xf00c,0xe82c,0xe82c,0xe80c,0xf80c,0xf80c,0xf80c,0xf00c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
+0xf518,0xf518,0xfd18,0xfd18,0xf518,0xf518,0xf558,0xed37,0xed38,0xed38,0xf538,0xf518,0xf518,0xf518,0xf538,0xf538,
+0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,
+0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf518,0xf538,
+0xf538,0xf538,0xf538,0xf538,0xf538,0xf538,0xf538,0xf538,0xf538,0xf538,0xf538,0xf538,0xf518,0xf518,0xf518,0xf517,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,
+0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,
+0xe80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf00c,0xe82c,0xe82c,0xf00c,0xf80c,0xf02c,0xe82b,0xe80b,0xe04b,0xd0cc,0xc98d,
+0xd2b1,0xdb93,0xf416,0xfc36,0xfc36,0xebd5,0xd312,0xca4f,0xc14d,0xc88b,0xe8ad,0xe80b,0xf00b,0xf82c,0xf80c,0xf80c,
+0xf80d,0xf00c,0xf00d,0xe80d,0xe82c,0xe80c,0xf00c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,
+0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xf518,0xfd18,0xf518,0xf4f7,0xf518,
+0xfd38,0xf538,0xf538,0xf538,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xf518,0xf517,0xf518,0xfd38,0xfd18,0xfcf8,0xfcf7,0xfd18,0xfd38,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00b,
+0xf00b,0xf80c,0xf80c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,
+0xe82c,0xe82c,0xf00c,0xf80c,0xf82c,0xf00b,0xf00c,0xf02c,0xf02c,0xe04b,0xd86c,0xd88c,0xd84b,0xd84b,0xe06c,0xe08c,
+0xd86c,0xd84b,0xd84b,0xe04c,0xe00b,0xe80b,0xf00c,0xf80c,0xf80c,0xf80c,0xf80d,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,
+0xf00c,0xf80c,0xf80c,0xf80c,0xf00b,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80b,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfcf8,0xfd18,0xfd38,0xf538,0xf4f8,0xf4d7,0xf518,0xf518,0xfcf8,0xfcf8,
+0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,0xf518,0xfcf8,0xfcf8,
+0xfd18,0xfd18,0xfd18,0xf4f7,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,
+0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80b,0xf80c,0xf80c,0xf80c,0xf80c,0xf82c,0xf02c,0xe80b,0xf80c,0xf80c,
+0xf80c,0xf00c,0xf00c,0xe82c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,
+0xf00b,0xf00b,0xf00b,0xf00b,0xf00c,0xf80c,0xf82c,0xf80b,0xf80b,0xf80b,0xf80c,0xf00c,0xf02c,0xf04c,0xf02c,0xf02c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,
+0xf00b,0xf00b,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd38,0xfd18,
+0xfd18,0xf4f7,0xf518,0xfd38,0xfd18,0xfd38,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,
+0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd38,0xfd18,0xfd18,0xfcf8,0xfcd7,0xfcd7,0xf518,0xfd38,0xf518,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,
+0xf80c,0xf80b,0xf80b,0xf80c,0xf00c,0xe80b,0xe82c,0xe84c,0xe82c,0xf00c,0xf80c,0xf00c,0xf00c,0xe82c,0xf00c,0xf00c,
+0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf00c,0xe80c,0xe82c,0xf04c,0xf04c,0xe82c,0xe80b,0xe80b,0xf00b,
+0xf00b,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xe80c,0xe80c,0xf02c,0xf00c,0xf00c,0xf02c,0xf00c,0xf00c,0xf00c,
+0xe82c,0xe82c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xe82c,0xe80b,0xe82c,0xf02c,0xf02c,0xf00c,0xf82c,0xf00b,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,
+0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xecf7,0xf518,0xfd59,0xf538,0xf538,0xf518,0xf4d7,0xfd18,
+0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xf518,
+0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xf518,
+0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xf518,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
+0xecf7,0xecf7,0xfcf8,0xfcf8,0xfd18,0xfd18,0xf518,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xe80c,0xf08d,
+0xf0ee,0xe8ad,0xe8cd,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xf88d,0xf88d,0xf0ad,0xf0ad,0xf0cd,0xf0ad,0xf88d,
+0xf88d,0xf0ad,0xf0ee,0xe8cd,0xe88d,0xe88d,0xe8ad,0xe8cd,0xf0cd,0xf0ad,0xe88d,0xf0ad,0xf0ad,0xf0ad,0xf08d,0xf0ad,
+0xf08d,0xf08d,0xf08d,0xf0ad,0xf0ad,0xf0ad,0xf0ad,0xe88d,0xf08d,0xf0cd,0xe8cd,0xe8cd,0xf0ad,0xf0ad,0xf0ad,0xf0ad,
+0xf0ad,0xe8cd,0xe8cd,0xe8cd,0xe8ad,0xf0ad,0xf08d,0xf8ae,0xe80b,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xf518,0xf518,0xfd18,0xf518,0xf518,0xf4f7,0xf538,0xfd18,0xf476,0xfc97,0xfc96,0xfc76,0xfc57,0xfc77,0xfc77,0xf497,
+0xfc77,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,
+0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,0xf497,
+0xf497,0xf497,0xfc77,0xfc77,0xf497,0xfc77,0xfc77,0xfc77,0xfc77,0xf497,0xf4d7,0xf4d7,0xfcb7,0xfc97,0xfc77,0xf497,
+0xf4f7,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf00c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xe80b,0xe84d,0xf9f2,0xfb37,0xfb57,0xfb77,0xfb97,0xfb97,0xfb97,
+0xfb77,0xfb77,0xfb77,0xfb77,0xfb77,0xfb76,0xfb96,0xfb96,0xfb96,0xfb97,0xfb77,0xfb77,0xfb76,0xfb77,0xfb77,0xfb77,
+0xfb77,0xfb97,0xfb96,0xfb96,0xfbb7,0xfbb7,0xfb97,0xfb76,0xfb77,0xfb97,0xfb97,0xfb77,0xfb97,0xfb97,0xfb97,0xfb97,
+0xfb76,0xfb56,0xfb76,0xfb97,0xfb96,0xfb96,0xfb96,0xfb96,0xfb76,0xfb76,0xfb96,0xfb96,0xfbb7,0xfb97,0xfb56,0xfb77,
+0xfb57,0xfaf6,0xf8ee,0xe82c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,
+0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xfcf8,0xfd18,0xfd18,
+0xfd38,0xec56,0xcab0,0xc20e,0xc26f,0xca4f,0xd22f,0xd22f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,
+0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,
+0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,0xca4f,
+0xca4f,0xca4f,0xca4f,0xca4f,0xba2e,0xc26f,0xca6f,0xca2f,0xc20e,0xca90,0xe3b4,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf00b,
+0xf00c,0xf04d,0xe82c,0xe86c,0xe8ad,0xe0ad,0xd8cc,0xd0cc,0xd0ec,0xd0cc,0xd8cc,0xd8ac,0xd8ac,0xd8ac,0xd8cc,0xd0cc,
+0xd0cc,0xd0ec,0xd0ec,0xd0ec,0xd0cc,0xd8cc,0xd8cc,0xd8ac,0xe08c,0xe08c,0xd8cc,0xd0ec,0xd0ec,0xd0cc,0xd0cc,0xd0cc,
+0xd0cc,0xd8cd,0xd0cc,0xd0cc,0xd0cc,0xd8ed,0xd0ac,0xd0cd,0xd0cc,0xd0cc,0xd8cc,0xd8ed,0xd8cc,0xd0ac,0xd0cc,0xd0cc,
+0xd0cc,0xd8cc,0xd8cc,0xd8cc,0xd0cc,0xd0cc,0xd0cc,0xd8ed,0xd8ac,0xd8ac,0xe08c,0xf0cd,0xd80b,0xf04c,0xf00c,0xf00c,
+0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xfd18,0xfd18,0xfcf8,0xfd18,0xf4d7,0xfd18,0xfcf8,0xfc56,0xfcb8,0xfc77,0xfc77,
+0xfc57,0xfc57,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,
+0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,
+0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfc77,0xfcb8,0xfc97,
+0xfc77,0xfc77,0xfc78,0xfc97,0xfcb8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf00c,0xf00c,0xf00c,0xe82c,0xe82c,
+0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,
+0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,
+0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,
+0xe82c,0xe82c,0xe82c,0xe82c,0xe82c,0xf00c,0xf00c,0xf00c,0xf00c,0xf00c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
+0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
+0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,
+0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfcf8,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,
+0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xf80c,0xe02c,0xe9f0,0xfbb5,
+0xeb73,0xfcd8,0xfcf8,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xf518,0xf518,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,0xfd18,
+0xfd18,0xfd18,0xfd18,0xfd18};
+ 
 #endif
\ No newline at end of file